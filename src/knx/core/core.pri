@@ -1,7 +1,9 @@
 INCLUDEPATH += $$PWD
 
 SOURCES += \
-    $$PWD/qknxbytearray.cpp
+    $$PWD/qknxbytearray.cpp \
+    $$PWD/qknxbytearrayview.cpp
 
 HEADERS += \
-    $$PWD/qknxbytearray.h
+    $$PWD/qknxbytearray.h \
+    $$PWD/qknxbytearrayview.h
@@ -39,9 +39,13 @@
 ****************************************************************************/
 
 #include "qknxbytearray.h"
+#include "qknxbytearrayview.h"
+
+#include <QtCore/qhash.h>
 
 #include <new>
 
+
 QT_BEGIN_NAMESPACE
 
 /*!
@@ -78,6 +82,14 @@ QT_BEGIN_NAMESPACE
     constData(). These functions return a pointer to the beginning of the data.
     The pointer is guaranteed to remain valid until a non-const function is
     called on the byte array.
+
+    Most KNX frames, addresses, and structures are only a few bytes long.
+    QKnxByteArray therefore stores up to 15 bytes directly inside the object,
+    so that building and parsing such small arrays does not allocate any heap
+    memory. Larger arrays are stored in an implicitly shared buffer. The
+    pointers returned by data() or constData() of a small array refer to
+    memory inside the byte array object itself and thus do not survive moving
+    or swapping the byte array.
 */
 
 /*!
@@ -97,8 +109,13 @@ QT_BEGIN_NAMESPACE
     character \a ch.
 */
 QKnxByteArray::QKnxByteArray(int size, quint8 ch)
-    : m_bytes(size, char(ch))
-{}
+    : m_size(0)
+{
+    if (size <= 0)
+        return;
+    setSize(size);
+    memset(data(), ch, size);
+}
 
 /*!
     \internal
@@ -106,8 +123,11 @@ QKnxByteArray::QKnxByteArray(int size, quint8 ch)
     Constructs a byte array of the size \a size with uninitialized contents.
 */
 QKnxByteArray::QKnxByteArray(int size, Qt::Initialization)
-    : m_bytes(size, Qt::Uninitialized)
-{}
+    : m_size(0)
+{
+    if (size > 0)
+        setSize(size);
+}
 
 /*!
     Constructs a byte array from \a data containing the number of bytes
@@ -122,15 +142,26 @@ QKnxByteArray::QKnxByteArray(int size, Qt::Initialization)
     QKnxByteArray makes a deep copy of the string data.
 */
 QKnxByteArray::QKnxByteArray(const char *data, int size)
-    : m_bytes(data, size)
+    : QKnxByteArray(reinterpret_cast<const quint8 *> (data), size)
 {}
 
 /*!
     \overload QKnxByteArray()
 */
 QKnxByteArray::QKnxByteArray(const quint8 *data, int size)
-    : m_bytes(reinterpret_cast<const char*> (data), size)
-{}
+{
+    if (!data)
+        return;
+
+    if (size < 0)
+        size = int(qstrlen(reinterpret_cast<const char *> (data)));
+
+    m_size = 0;
+    if (size > 0) {
+        setSize(size);
+        memcpy(this->data(), data, size);
+    }
+}
 
 /*!
     Constructs a byte array from the \c {std::initializer_list} specified by
@@ -139,27 +170,33 @@ QKnxByteArray::QKnxByteArray(const quint8 *data, int size)
 QKnxByteArray::QKnxByteArray(std::initializer_list<quint8> args)
 {
     if (args.size() > 0) {
-        auto d = new (std::nothrow) quint8[args.size()];
-        if (!d)
-            return;
-        memcpy(d, args.begin(), (args.end() - args.begin()) * sizeof(quint8));
-        m_bytes = QByteArray(reinterpret_cast<const char*> (d), int(args.size()));
-        delete []d;
+        m_size = 0;
+        setSize(int(args.size()));
+        memcpy(data(), args.begin(), args.size() * sizeof(quint8));
     }
 }
 
 /*!
-    \fn QKnxByteArray::QKnxByteArray(const QKnxByteArray &other)
-
     Constructs a copy of \a other.
 */
+QKnxByteArray::QKnxByteArray(const QKnxByteArray &other) Q_DECL_NOTHROW
+    : m_size(other.m_size)
+{
+    if (m_size == HeapSize)
+        new (&m_heap) QByteArray(other.m_heap);
+    else
+        memcpy(m_inline.bytes, other.m_inline.bytes, sizeof(m_inline.bytes));
+}
 
 /*!
     Assigns \a other to this KNX byte array and returns a reference.
 */
 QKnxByteArray &QKnxByteArray::operator=(const QKnxByteArray &other) Q_DECL_NOTHROW
 {
-    m_bytes.operator=(other.m_bytes);
+    if (this != &other) {
+        QKnxByteArray copy(other);
+        swap(copy);
+    }
     return *this;
 }
 
@@ -167,28 +204,80 @@ QKnxByteArray &QKnxByteArray::operator=(const QKnxByteArray &other) Q_DECL_NOTHR
     \fn QKnxByteArray::QKnxByteArray(QKnxByteArray &&other)
 
     Move-constructs a QKnxByteArray instance, making it point to the same
-    object that \a other was pointing to.
+    object that \a other was pointing to. The data is taken over without
+    touching its reference count, and \a other is left empty. Small arrays
+    that are stored inside the object are copied.
 */
 
 /*!
     \fn QKnxByteArray &QKnxByteArray::operator=(QKnxByteArray &&other)
 
-    Move-assigns \a other to this QKnxByteArray instance.
+    Move-assigns \a other to this QKnxByteArray instance. The data is taken
+    over without touching its reference count.
 */
 
 /*!
-    \fn void QKnxByteArray::swap(QKnxByteArray &other)
-
     Swaps the byte array \a other with this byte array. This operation is very
     fast and never fails.
 */
+void QKnxByteArray::swap(QKnxByteArray &other) Q_DECL_NOTHROW
+{
+    if (this == &other)
+        return;
+
+    if (m_size == HeapSize && other.m_size == HeapSize) {
+        m_heap.swap(other.m_heap);
+        return;
+    }
+
+    // moveFrom() leaves its argument null and without any resources
+    QKnxByteArray tmp(std::move(other));
+    other.moveFrom(*this);
+    moveFrom(tmp);
+}
 
 /*!
-    Returns a copy of this byte array as \l QByteArray.
+    Returns the contents of this byte array as \l QByteArray.
+
+    Large byte arrays return the QByteArray that holds their data. For small
+    byte arrays, the QByteArray is created on the first call, which is safe
+    to happen from several threads at once, and kept until the byte array is
+    modified. The returned reference is invalidated by any non-const call on
+    the byte array and by destroying, moving, or swapping it. Use view() to
+    access the bytes without creating a QByteArray.
 */
 const QByteArray &QKnxByteArray::toByteArray() const
 {
-    return m_bytes;
+    if (m_size == NullSize) {
+        static const QByteArray null;
+        return null;
+    }
+    if (m_size == HeapSize)
+        return m_heap;
+
+    if (auto copy = m_inline.copy.loadAcquire())
+        return *copy;
+
+    auto copy = new QByteArray(reinterpret_cast<const char *> (m_inline.bytes), m_size);
+    if (m_inline.copy.testAndSetOrdered(nullptr, copy))
+        return *copy;
+
+    delete copy; // another thread created it first
+    return *m_inline.copy.loadAcquire();
+}
+
+/*!
+    \since 6.2
+
+    Returns a view on the bytes of this byte array. The view is valid until a
+    non-const function is called on the byte array or the byte array is
+    destroyed, moved, or swapped.
+
+    \sa toByteArray()
+*/
+QKnxByteArrayView QKnxByteArray::view() const Q_DECL_NOTHROW
+{
+    return QKnxByteArrayView(*this);
 }
 
 /*!
@@ -196,18 +285,25 @@ const QByteArray &QKnxByteArray::toByteArray() const
 */
 QKnxByteArray QKnxByteArray::fromByteArray(const QByteArray &byteArray)
 {
-    QKnxByteArray ba(0, Qt::Uninitialized);
-    ba.m_bytes = byteArray;
+    if (byteArray.isNull())
+        return {};
+
+    QKnxByteArray ba;
+    if (byteArray.size() > InlineCapacity) {
+        new (&ba.m_heap) QByteArray(byteArray);
+        ba.m_size = HeapSize;
+    } else {
+        ba.m_size = qint8(byteArray.size());
+        memcpy(ba.m_inline.bytes, byteArray.constData(), byteArray.size());
+    }
     return ba;
 }
 
 /*!
+    \fn bool QKnxByteArray::isNull() const
+
     Returns \c true if this byte array is null; otherwise returns \c false.
 */
-bool QKnxByteArray::isNull() const
-{
-    return m_bytes.isNull();
-}
 
 /*!
     \fn bool QKnxByteArray::isEmpty() const
@@ -228,7 +324,9 @@ bool QKnxByteArray::isNull() const
 */
 void QKnxByteArray::clear()
 {
-    m_bytes.clear();
+    destroy();
+    new (&m_inline) Inline {};
+    m_size = NullSize;
 }
 
 /*!
@@ -243,13 +341,97 @@ void QKnxByteArray::clear()
 */
 void QKnxByteArray::resize(int size)
 {
-    if (size == m_bytes.size())
+    const int oldSize = this->size();
+    if (size == oldSize)
+        return;
+
+    setSize(qMax(size, 0));
+    if (size > oldSize)
+        memset(data() + oldSize, 0x00, size - oldSize);
+}
+
+/*!
+    \internal
+
+    Sets the size of the byte array to \a size, keeping the existing bytes in
+    front. Newly added bytes are left uninitialized. The data is moved between
+    the inline and the heap storage as needed.
+*/
+void QKnxByteArray::setSize(int size)
+{
+    Q_ASSERT(size >= 0);
+
+    if (m_size == HeapSize) {
+        if (size > InlineCapacity) {
+            m_heap.resize(size);
+        } else {
+            const QByteArray heap = std::move(m_heap);
+            m_heap.~QByteArray();
+            new (&m_inline) Inline {};
+            memcpy(m_inline.bytes, heap.constData(), size);
+            m_size = qint8(size);
+        }
         return;
+    }
+
+    dropCopy();
+    if (size <= InlineCapacity) {
+        m_size = qint8(size);
+        m_inline.bytes[size] = 0x00;
+        return;
+    }
+
+    QByteArray heap(size, Qt::Uninitialized);
+    memcpy(heap.data(), m_inline.bytes, qMax(int(m_size), 0));
+    new (&m_heap) QByteArray(std::move(heap));
+    m_size = HeapSize;
+}
 
-    if (size > m_bytes.size())
-        m_bytes.append(size - m_bytes.size(), 0x00);
+/*!
+    \internal
+
+    Releases the heap storage or the QByteArray created by toByteArray(). The
+    inline storage is left untouched and may be reused afterwards.
+*/
+void QKnxByteArray::destroy() Q_DECL_NOTHROW
+{
+    if (m_size == HeapSize)
+        m_heap.~QByteArray();
     else
-        m_bytes.resize(size);
+        delete m_inline.copy.loadRelaxed();
+}
+
+/*!
+    \internal
+
+    Deletes the QByteArray created by toByteArray() for an inline byte array
+    before its bytes change.
+*/
+void QKnxByteArray::dropCopy() Q_DECL_NOTHROW
+{
+    Q_ASSERT(m_size != HeapSize);
+    delete m_inline.copy.fetchAndStoreRelaxed(nullptr);
+}
+
+/*!
+    \internal
+
+    Takes over the contents of \a other and leaves it null. This byte array
+    must not hold any heap storage or QByteArray created by toByteArray().
+*/
+void QKnxByteArray::moveFrom(QKnxByteArray &other) Q_DECL_NOTHROW
+{
+    m_size = other.m_size;
+    if (other.m_size == HeapSize) {
+        new (&m_heap) QByteArray(std::move(other.m_heap));
+        other.m_heap.~QByteArray();
+        new (&other.m_inline) Inline {};
+    } else {
+        memcpy(m_inline.bytes, other.m_inline.bytes, sizeof(m_inline.bytes));
+        m_inline.copy.storeRelaxed(other.m_inline.copy.fetchAndStoreRelaxed(nullptr));
+    }
+    other.m_size = NullSize;
+    other.m_inline.bytes[0] = 0x00;
 }
 
 /*!
@@ -297,8 +479,17 @@ void QKnxByteArray::resize(int size)
 */
 QKnxByteArray QKnxByteArray::repeated(int times) const
 {
-    QKnxByteArray ba(0, Qt::Uninitialized);
-    ba.m_bytes = m_bytes.repeated(times);
+    const int s = size();
+    if (s == 0)
+        return *this;
+
+    if (times <= 1)
+        return (times == 1 ? *this : QKnxByteArray());
+
+    QKnxByteArray ba(s * times, Qt::Uninitialized);
+    auto d = ba.data();
+    for (int i = 0; i < times; ++i, d += s)
+        memcpy(d, constData(), s);
     return ba;
 }
 
@@ -309,7 +500,10 @@ QKnxByteArray QKnxByteArray::repeated(int times) const
 */
 QKnxByteArray &QKnxByteArray::fill(quint8 ch, int size)
 {
-    m_bytes.fill(ch, size);
+    if (size >= 0)
+        resize(size);
+    if (const int s = this->size())
+        memset(data(), ch, s);
     return *this;
 }
 
@@ -356,10 +550,26 @@ QKnxByteArray QKnxByteArray::right(int len) const
 */
 QKnxByteArray QKnxByteArray::mid(int pos, int len) const
 {
-    const auto m = m_bytes.mid(pos, len);
-    if (m.isEmpty())
+    const int s = size();
+    if (pos > s)
         return {};
-    return QKnxByteArray(m.constData(), m.size());
+
+    if (pos < 0) {
+        if (len < 0 || len + pos >= s)
+            return (s > 0 ? *this : QKnxByteArray());
+        if (len + pos <= 0)
+            return {};
+        len += pos;
+        pos = 0;
+    } else if (uint(len) > uint(s - pos)) {
+        len = s - pos;
+    }
+
+    if (len <= 0)
+        return {};
+    if (pos == 0 && len == s)
+        return *this;
+    return QKnxByteArray(constData() + pos, len);
 }
 
 /*!
@@ -379,8 +589,7 @@ QKnxByteArray QKnxByteArray::mid(int pos, int len) const
 */
 QKnxByteArray &QKnxByteArray::prepend(quint8 ch)
 {
-    m_bytes.prepend(char(ch));
-    return *this;
+    return insertData(0, &ch, 1);
 }
 
 /*!
@@ -389,8 +598,9 @@ QKnxByteArray &QKnxByteArray::prepend(quint8 ch)
 */
 QKnxByteArray &QKnxByteArray::prepend(const QKnxByteArray &ba)
 {
-    m_bytes.prepend(reinterpret_cast<const char*> (ba.constData()), ba.size());
-    return *this;
+    if (isEmpty() && ba.m_size == HeapSize)
+        return (*this = ba);
+    return insertData(0, ba.constData(), ba.size());
 }
 
 /*!
@@ -410,8 +620,7 @@ QKnxByteArray &QKnxByteArray::prepend(const QKnxByteArray &ba)
 */
 QKnxByteArray &QKnxByteArray::insert(int i, quint8 ch)
 {
-    m_bytes.insert(i, char(ch));
-    return *this;
+    return insertData(i, &ch, 1);
 }
 
 /*!
@@ -425,7 +634,18 @@ QKnxByteArray &QKnxByteArray::insert(int i, quint8 ch)
 */
 QKnxByteArray &QKnxByteArray::insert(int i, int count, quint8 ch)
 {
-    m_bytes.insert(i, count, char(ch));
+    if (i < 0 || count <= 0)
+        return *this;
+
+    const int oldSize = size();
+    setSize(qMax(i, oldSize) + count);
+
+    auto d = data();
+    if (i > oldSize)
+        memset(d + oldSize, 0x20, i - oldSize);
+    else
+        memmove(d + i + count, d + i, oldSize - i);
+    memset(d + i, ch, count);
     return *this;
 }
 
@@ -435,7 +655,36 @@ QKnxByteArray &QKnxByteArray::insert(int i, int count, quint8 ch)
 */
 QKnxByteArray &QKnxByteArray::insert(int i, const QKnxByteArray &ba)
 {
-    m_bytes.insert(i, reinterpret_cast<const char*> (ba.constData()), ba.size());
+    return insertData(i, ba.constData(), ba.size());
+}
+
+/*!
+    \internal
+
+    Inserts \a len bytes read from \a data at the index position \a i. If \a i
+    is greater than the value returned by size(), the array is first extended
+    using space characters. \a data may point into this byte array.
+*/
+QKnxByteArray &QKnxByteArray::insertData(int i, const quint8 *data, int len)
+{
+    if (i < 0 || len <= 0 || !data)
+        return *this;
+
+    const auto begin = constData();
+    if (data >= begin && data < begin + size()) {
+        const QKnxByteArray copy(data, len);
+        return insertData(i, copy.constData(), len);
+    }
+
+    const int oldSize = size();
+    setSize(qMax(i, oldSize) + len);
+
+    auto d = this->data();
+    if (i > oldSize)
+        memset(d + oldSize, 0x20, i - oldSize);
+    else
+        memmove(d + i + len, d + i, oldSize - i);
+    memcpy(d + i, data, len);
     return *this;
 }
 
@@ -446,7 +695,9 @@ QKnxByteArray &QKnxByteArray::insert(int i, const QKnxByteArray &ba)
 */
 QKnxByteArray& QKnxByteArray::append(quint8 ch)
 {
-    m_bytes.append(char(ch));
+    const int s = size();
+    setSize(s + 1);
+    data()[s] = ch;
     return *this;
 }
 
@@ -455,8 +706,9 @@ QKnxByteArray& QKnxByteArray::append(quint8 ch)
 */
 QKnxByteArray &QKnxByteArray::append(const QKnxByteArray &ba)
 {
-    m_bytes.append(reinterpret_cast<const char*> (ba.constData()), ba.size());
-    return *this;
+    if (isEmpty() && ba.m_size == HeapSize)
+        return (*this = ba);
+    return insertData(size(), ba.constData(), ba.size());
 }
 
 /*!
@@ -476,8 +728,15 @@ QKnxByteArray &QKnxByteArray::append(const QKnxByteArray &ba)
 */
 QKnxByteArray &QKnxByteArray::replace(int index, int len, const QKnxByteArray &after)
 {
-    m_bytes.replace(index, len, reinterpret_cast<const char*> (after.constData()), after.size());
-    return *this;
+    const int alen = after.size();
+    if (len == alen && index >= 0 && (index + alen) <= size()) {
+        memmove(data() + index, after.constData(), alen);
+        return *this;
+    }
+
+    const QKnxByteArray copy(after);
+    remove(index, len);
+    return insertData(index, copy.constData(), alen);
 }
 
 /*!
@@ -488,8 +747,7 @@ QKnxByteArray &QKnxByteArray::replace(int index, int len, const QKnxByteArray &a
 */
 QKnxByteArray &QKnxByteArray::replace(quint8 before, const QKnxByteArray &after)
 {
-    m_bytes.replace(char(before), after.toByteArray());
-    return *this;
+    return replace(QKnxByteArray(&before, 1), after);
 }
 
 /*!
@@ -500,7 +758,27 @@ QKnxByteArray &QKnxByteArray::replace(quint8 before, const QKnxByteArray &after)
 */
 QKnxByteArray &QKnxByteArray::replace(const QKnxByteArray &before, const QKnxByteArray &after)
 {
-    m_bytes.replace(before.toByteArray(), after.toByteArray());
+    if (isNull() || before == after)
+        return *this;
+
+    const int blen = before.size();
+    if (blen == 0)
+        return (*this = fromByteArray(QByteArray(toByteArray()).replace(QByteArray(),
+            after.toByteArray())));
+
+    int index = indexOf(before);
+    if (index < 0)
+        return *this;
+
+    QKnxByteArray result(0, Qt::Uninitialized);
+    int last = 0;
+    for (; index >= 0; index = indexOf(before, last)) {
+        result.insertData(result.size(), constData() + last, index - last);
+        result.insertData(result.size(), after.constData(), after.size());
+        last = index + blen;
+    }
+    result.insertData(result.size(), constData() + last, size() - last);
+    swap(result);
     return *this;
 }
 
@@ -512,7 +790,18 @@ QKnxByteArray &QKnxByteArray::replace(const QKnxByteArray &before, const QKnxByt
 */
 QKnxByteArray &QKnxByteArray::replace(quint8 before, quint8 after)
 {
-    m_bytes.replace(char(before), char(after));
+    if (before == after)
+        return *this;
+
+    int index = indexOf(before);
+    if (index < 0)
+        return *this;
+
+    auto d = data();
+    for (const int s = size(); index < s; ++index) {
+        if (d[index] == before)
+            d[index] = after;
+    }
     return *this;
 }
 
@@ -526,7 +815,16 @@ QKnxByteArray &QKnxByteArray::replace(quint8 before, quint8 after)
 */
 QKnxByteArray &QKnxByteArray::remove(int pos, int len)
 {
-    m_bytes.remove(pos, len);
+    const int s = size();
+    if (len <= 0 || uint(pos) >= uint(s))
+        return *this;
+
+    if (len >= s - pos) {
+        setSize(pos);
+    } else {
+        memmove(data() + pos, constData() + pos + len, s - pos - len);
+        setSize(s - len);
+    }
     return *this;
 }
 
@@ -566,7 +864,15 @@ QKnxByteArray &QKnxByteArray::remove(int pos, int len)
 */
 int QKnxByteArray::indexOf(quint8 ch, int from) const
 {
-    return m_bytes.indexOf(char(ch), from);
+    const int s = size();
+    if (from < 0)
+        from = qMax(from + s, 0);
+    if (from >= s)
+        return -1;
+
+    const auto d = constData();
+    const auto n = static_cast<const quint8 *> (memchr(d + from, ch, s - from));
+    return n ? int(n - d) : -1;
 }
 
 /*!
@@ -576,7 +882,24 @@ int QKnxByteArray::indexOf(quint8 ch, int from) const
 */
 int QKnxByteArray::indexOf(const QKnxByteArray &ba, int from) const
 {
-    return m_bytes.indexOf(ba.toByteArray(), from);
+    const int ol = ba.size();
+    if (ol == 0)
+        return from;
+    if (ol == 1)
+        return indexOf(ba.at(0), from);
+
+    const int l = size();
+    if (from < 0)
+        from = qMax(from + l, 0);
+    if (from > l - ol)
+        return -1;
+
+    const auto d = constData(), n = ba.constData();
+    for (int i = from; i <= l - ol; ++i) {
+        if (d[i] == n[0] && memcmp(d + i, n, ol) == 0)
+            return i;
+    }
+    return -1;
 }
 
 /*!
@@ -589,7 +912,18 @@ int QKnxByteArray::indexOf(const QKnxByteArray &ba, int from) const
 */
 int QKnxByteArray::lastIndexOf(quint8 ch, int from) const
 {
-    return m_bytes.lastIndexOf(char(ch), from);
+    const int s = size();
+    if (from < 0)
+        from += s;
+    else if (from > s)
+        from = s - 1;
+
+    const auto d = constData();
+    for (; from >= 0; --from) {
+        if (d[from] == ch)
+            return from;
+    }
+    return -1;
 }
 
 /*!
@@ -600,7 +934,25 @@ int QKnxByteArray::lastIndexOf(quint8 ch, int from) const
 */
 int QKnxByteArray::lastIndexOf(const QKnxByteArray &ba, int from) const
 {
-    return m_bytes.lastIndexOf(ba.toByteArray(), from);
+    const int ol = ba.size();
+    if (ol == 1)
+        return lastIndexOf(ba.at(0), from);
+
+    const int l = size();
+    const int delta = l - ol;
+    if (from < 0)
+        from = delta;
+    if (from < 0 || from > l)
+        return -1;
+    if (from > delta)
+        from = delta;
+
+    const auto d = constData(), n = ba.constData();
+    for (; from >= 0; --from) {
+        if (memcmp(d + from, n, ol) == 0)
+            return from;
+    }
+    return -1;
 }
 
 /*!
@@ -625,7 +977,7 @@ int QKnxByteArray::lastIndexOf(const QKnxByteArray &ba, int from) const
 */
 bool QKnxByteArray::startsWith(quint8 ch) const
 {
-    return m_bytes.startsWith(char(ch));
+    return size() > 0 && constData()[0] == ch;
 }
 
 /*!
@@ -634,7 +986,12 @@ bool QKnxByteArray::startsWith(quint8 ch) const
 */
 bool QKnxByteArray::startsWith(const QKnxByteArray &ba) const
 {
-    return m_bytes.startsWith(ba.toByteArray());
+    const int s = ba.size();
+    if (s == 0)
+        return true;
+    if (size() < s)
+        return false;
+    return memcmp(constData(), ba.constData(), s) == 0;
 }
 
 /*!
@@ -645,7 +1002,8 @@ bool QKnxByteArray::startsWith(const QKnxByteArray &ba) const
 */
 bool QKnxByteArray::endsWith(quint8 ch) const
 {
-    return m_bytes.endsWith(char(ch));
+    const int s = size();
+    return s > 0 && constData()[s - 1] == ch;
 }
 
 /*!
@@ -654,7 +1012,12 @@ bool QKnxByteArray::endsWith(quint8 ch) const
 */
 bool QKnxByteArray::endsWith(const QKnxByteArray &ba) const
 {
-    return m_bytes.endsWith(ba.toByteArray());
+    const int s = ba.size();
+    if (s == 0)
+        return true;
+    if (size() < s)
+        return false;
+    return memcmp(constData() + size() - s, ba.constData(), s) == 0;
 }
 
 /*!
@@ -673,11 +1036,21 @@ bool QKnxByteArray::endsWith(const QKnxByteArray &ba) const
 */
 QKnxByteArray QKnxByteArray::toHex(quint8 separator) const
 {
-    if (!size())
+    const int s = size();
+    if (!s)
         return {};
 
-    QKnxByteArray hex(0, Qt::Uninitialized);
-    hex.m_bytes = m_bytes.toHex(separator);
+    static const char digits[] = "0123456789abcdef";
+    QKnxByteArray hex(separator ? (s * 3 - 1) : (s * 2), Qt::Uninitialized);
+
+    auto h = hex.data();
+    const auto d = constData();
+    for (int i = 0; i < s; ++i) {
+        if (separator && i > 0)
+            *h++ = separator;
+        *h++ = quint8(digits[d[i] >> 4]);
+        *h++ = quint8(digits[d[i] & 0x0f]);
+    }
     return hex;
 }
 
@@ -686,9 +1059,7 @@ QKnxByteArray QKnxByteArray::toHex(quint8 separator) const
 */
 QKnxByteArray QKnxByteArray::fromHex(const QByteArray &hexEncoded)
 {
-    QKnxByteArray hex(0, Qt::Uninitialized);
-    hex.m_bytes = QByteArray::fromHex(hexEncoded);
-    return hex;
+    return fromByteArray(QByteArray::fromHex(hexEncoded));
 }
 
 /*!
@@ -698,7 +1069,7 @@ QKnxByteArray QKnxByteArray::fromHex(const QByteArray &hexEncoded)
 */
 QKnxByteArray QKnxByteArray::fromHex(const QKnxByteArray &hexEncoded)
 {
-    return QKnxByteArray::fromHex(hexEncoded.m_bytes);
+    return QKnxByteArray::fromHex(hexEncoded.toByteArray());
 }
 
 /*!
@@ -887,7 +1258,7 @@ QKnxByteArray QKnxByteArray::fromHex(const QKnxByteArray &hexEncoded)
 
 /*!
     \relates QKnxByteArray
-    \fn const QKnxByteArray operator+(const QKnxByteArray &a1, const QKnxByteArray &a2)
+    \fn QKnxByteArray operator+(const QKnxByteArray &a1, const QKnxByteArray &a2)
 
     Returns a byte array that is the result of concatenating the byte
     array \a a1 and byte array \a a2.
@@ -896,7 +1267,17 @@ QKnxByteArray QKnxByteArray::fromHex(const QKnxByteArray &hexEncoded)
 /*!
     \overload operator+()
     \relates QKnxByteArray
-    \fn const QKnxByteArray operator+(const QKnxByteArray &ba, quint8 ch)
+    \fn QKnxByteArray operator+(QKnxByteArray &&a1, const QKnxByteArray &a2)
+
+    Returns a byte array that is the result of concatenating the byte
+    array \a a1 and byte array \a a2. The byte array \a a2 is appended to the
+    storage of \a a1, which makes chained concatenations of temporaries cheap.
+*/
+
+/*!
+    \overload operator+()
+    \relates QKnxByteArray
+    \fn QKnxByteArray operator+(const QKnxByteArray &ba, quint8 ch)
 
     Returns a byte array that is the result of concatenating the byte
     array \a ba and character \a ch.
@@ -905,7 +1286,16 @@ QKnxByteArray QKnxByteArray::fromHex(const QKnxByteArray &hexEncoded)
 /*!
     \overload operator+()
     \relates QKnxByteArray
-    \fn const QKnxByteArray operator+(quint8 ch, const QKnxByteArray &ba)
+    \fn QKnxByteArray operator+(QKnxByteArray &&ba, quint8 ch)
+
+    Returns a byte array that is the result of concatenating the byte
+    array \a ba and character \a ch, reusing the storage of \a ba.
+*/
+
+/*!
+    \overload operator+()
+    \relates QKnxByteArray
+    \fn QKnxByteArray operator+(quint8 ch, const QKnxByteArray &ba)
 
     Returns a byte array that is the result of concatenating the character
     \a ch and byte array \a ba.
@@ -929,7 +1319,7 @@ QDebug operator<<(QDebug debug, const QKnxByteArray &byteArray)
 */
 size_t qHash(const QKnxByteArray &ba, uint seed) Q_DECL_NOTHROW
 {
-    return qHash(ba.toByteArray(), seed);
+    return qHashBits(ba.constData(), size_t(ba.size()), seed);
 }
 
 QT_END_NAMESPACE
@@ -41,6 +41,7 @@
 #ifndef QKNXBYTEARRAY_H
 #define QKNXBYTEARRAY_H
 
+#include <QtCore/qatomic.h>
 #include <QtCore/qbytearray.h>
 #include <QtCore/qdebug.h>
 
@@ -50,11 +51,12 @@
 
 QT_BEGIN_NAMESPACE
 
+class QKnxByteArrayView;
 class Q_KNX_EXPORT QKnxByteArray
 {
 public:
-    inline QKnxByteArray() = default;
-    inline ~QKnxByteArray() = default;
+    inline QKnxByteArray() Q_DECL_NOTHROW {}
+    inline ~QKnxByteArray() { destroy(); }
 
     QKnxByteArray(int size, quint8 ch);
     QKnxByteArray(int size, Qt::Initialization);
@@ -64,47 +66,54 @@ public:
 
     QKnxByteArray(std::initializer_list<quint8> args);
 
-    inline QKnxByteArray(const QKnxByteArray &other) Q_DECL_NOTHROW
-        : m_bytes(other.m_bytes)
-    {}
+    QKnxByteArray(const QKnxByteArray &other) Q_DECL_NOTHROW;
     QKnxByteArray &operator=(const QKnxByteArray &other) Q_DECL_NOTHROW;
 
     inline QKnxByteArray(QKnxByteArray &&other) Q_DECL_NOTHROW
-        : m_bytes(other.m_bytes)
-    {}
+    {
+        moveFrom(other);
+    }
     inline QKnxByteArray &operator=(QKnxByteArray &&other) Q_DECL_NOTHROW
     {
-        m_bytes.operator=(other.m_bytes);
+        swap(other);
         return *this;
     }
 
-    inline void swap(QKnxByteArray &other) Q_DECL_NOTHROW { m_bytes.swap(other.m_bytes); }
+    void swap(QKnxByteArray &other) Q_DECL_NOTHROW;
 
     const QByteArray &toByteArray() const;
+    QKnxByteArrayView view() const Q_DECL_NOTHROW;
     static QKnxByteArray fromByteArray(const QByteArray &ba);
 
-    bool isNull() const;
+    inline bool isNull() const { return m_size == NullSize; }
     inline bool isEmpty() const { return size() == 0; }
 
-    inline int size() const { return m_bytes.size(); }
+    inline int size() const
+    {
+        return m_size >= 0 ? int(m_size) : (m_size == HeapSize ? m_heap.size() : 0);
+    }
 
     void clear();
     void resize(int size);
 
-    inline quint8 at(int i) const { return m_bytes.at(i); }
+    inline quint8 at(int i) const
+    {
+        Q_ASSERT(uint(i) < uint(size()));
+        return constData()[i];
+    }
 
     inline void set(int i, quint8 val) {
         Q_ASSERT(i >= 0 && i < size());
-        m_bytes[i] = val;
+        data()[i] = val;
     }
 
     inline void setValue(int i, quint8 val)
     {
-        if (i >= 0 && i < m_bytes.size()) m_bytes[i] = val;
+        if (i >= 0 && i < size()) data()[i] = val;
     }
     inline quint8 value(int i, quint8 defaultValue = {}) const
     {
-        return (uint(i) >= uint(size()) ? defaultValue : quint8(m_bytes.at(i)));
+        return (uint(i) >= uint(size()) ? defaultValue : constData()[i]);
     }
 
     QKnxByteArray repeated(int times) const;
@@ -136,11 +145,21 @@ public:
 
     QKnxByteArray &remove(int index, int len);
 
-    inline quint8 *data() { return reinterpret_cast <quint8 *> (m_bytes.data()); }
-    inline const quint8 *data() const {
-        return reinterpret_cast <const quint8 *> (m_bytes.data()); }
-    inline const quint8 *constData() const {
-        return reinterpret_cast <const quint8 *> (m_bytes.constData()); }
+    inline quint8 *data()
+    {
+        if (m_size == HeapSize)
+            return reinterpret_cast <quint8 *> (m_heap.data());
+        if (m_inline.copy.loadRelaxed())
+            dropCopy();
+        return m_inline.bytes;
+    }
+    inline const quint8 *data() const { return constData(); }
+    inline const quint8 *constData() const
+    {
+        if (m_size == HeapSize)
+            return reinterpret_cast <const quint8 *> (m_heap.constData());
+        return m_inline.bytes;
+    }
 
     int indexOf(quint8 ch, int from = 0) const;
     int indexOf(const QKnxByteArray &ba, int from = 0) const;
@@ -167,14 +186,14 @@ public:
     typedef std::reverse_iterator<iterator> reverse_iterator;
     typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
 
-    inline iterator begin() { return reinterpret_cast <quint8 *> (m_bytes.begin()); }
-    inline const_iterator begin() const { return reinterpret_cast <const quint8 *> (m_bytes.begin()); }
-    inline const_iterator cbegin() const { return reinterpret_cast <const quint8 *> (m_bytes.cbegin()); }
-    inline const_iterator constBegin() const { return reinterpret_cast <const quint8 *> (m_bytes.constBegin()); }
-    inline iterator end() { return reinterpret_cast <quint8 *> (m_bytes.end()); }
-    inline const_iterator end() const { return reinterpret_cast <const quint8 *> (m_bytes.end()); }
-    inline const_iterator cend() const { return reinterpret_cast <const quint8 *> (m_bytes.cend()); }
-    inline const_iterator constEnd() const { return reinterpret_cast <const quint8 *> (m_bytes.constEnd()); }
+    inline iterator begin() { return data(); }
+    inline const_iterator begin() const { return constData(); }
+    inline const_iterator cbegin() const { return constData(); }
+    inline const_iterator constBegin() const { return constData(); }
+    inline iterator end() { return data() + size(); }
+    inline const_iterator end() const { return constData() + size(); }
+    inline const_iterator cend() const { return constData() + size(); }
+    inline const_iterator constEnd() const { return constData() + size(); }
 
     reverse_iterator rbegin() { return reverse_iterator(end()); }
     reverse_iterator rend() { return reverse_iterator(begin()); }
@@ -196,7 +215,29 @@ public:
     inline QKnxByteArray &operator+=(const QKnxByteArray &ba) { return append(ba); }
 
 private:
-    QByteArray m_bytes;
+    void setSize(int size);
+    QKnxByteArray &insertData(int i, const quint8 *data, int len);
+
+    void destroy() Q_DECL_NOTHROW;
+    void dropCopy() Q_DECL_NOTHROW;
+    void moveFrom(QKnxByteArray &other) Q_DECL_NOTHROW;
+
+    enum : int { InlineCapacity = 15 };
+    enum : qint8 { HeapSize = -1, NullSize = -2 };
+
+    // Arrays of up to InlineCapacity bytes live in m_inline (followed by the
+    // null-terminator), larger ones are kept in the implicitly shared m_heap.
+    // For inline arrays, copy holds the QByteArray returned by toByteArray().
+    struct Inline
+    {
+        quint8 bytes[InlineCapacity + 1];
+        mutable QBasicAtomicPointer<QByteArray> copy;
+    };
+    union {
+        QByteArray m_heap;
+        Inline m_inline {};
+    };
+    qint8 m_size { NullSize };
 };
 
 inline bool operator==(const QKnxByteArray &a1, const QKnxByteArray &a2) Q_DECL_NOTHROW
@@ -208,17 +249,33 @@ inline bool operator!=(const QKnxByteArray &a1, const QKnxByteArray &a2) Q_DECL_
     return !(a1 == a2);
 }
 
-inline const QKnxByteArray operator+(const QKnxByteArray &a1, const QKnxByteArray &a2)
+inline QKnxByteArray operator+(const QKnxByteArray &a1, const QKnxByteArray &a2)
+{
+    QKnxByteArray ba(a1);
+    ba += a2;
+    return ba;
+}
+inline QKnxByteArray operator+(QKnxByteArray &&a1, const QKnxByteArray &a2)
+{
+    a1 += a2;
+    return std::move(a1);
+}
+inline QKnxByteArray operator+(const QKnxByteArray &ba, quint8 ch)
 {
-    return QKnxByteArray(a1) += a2;
+    QKnxByteArray tmp(ba);
+    tmp += ch;
+    return tmp;
 }
-inline const QKnxByteArray operator+(const QKnxByteArray &ba, quint8 ch)
+inline QKnxByteArray operator+(QKnxByteArray &&ba, quint8 ch)
 {
-    return QKnxByteArray(ba) += ch;
+    ba += ch;
+    return std::move(ba);
 }
-inline const QKnxByteArray operator+(quint8 ch, const QKnxByteArray &ba)
+inline QKnxByteArray operator+(quint8 ch, const QKnxByteArray &ba)
 {
-    return QKnxByteArray(1, ch) += ba;
+    QKnxByteArray tmp(1, ch);
+    tmp += ba;
+    return tmp;
 }
 
 Q_KNX_EXPORT QDebug operator<<(QDebug debug, const QKnxByteArray &);
@@ -0,0 +1,246 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtKnx module.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qknxbytearrayview.h"
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QKnxByteArrayView
+    \inmodule QtKnx
+    \ingroup qtknx-general-classes
+
+    \brief The QKnxByteArrayView class provides a read-only view on a
+    contiguous range of unsigned bytes.
+
+    A KNX byte array view references memory owned by someone else, for example
+    a received datagram or a \l QKnxByteArray, and consists of a pointer and a
+    length only. Constructing, copying, or slicing a view with left(), right(),
+    or mid() never allocates memory.
+
+    All \c fromBytes() functions of the frame, header, and structure classes
+    accept a view, so that a received datagram can be parsed without creating
+    intermediate copies of its parts. Only the payload of the parsed object is
+    copied once into storage owned by the object.
+
+    \note The referenced memory must stay valid for as long as the view is used.
+
+    \sa QKnxByteArray
+*/
+
+/*!
+    \fn QKnxByteArrayView::QKnxByteArrayView()
+
+    Constructs a null byte array view.
+*/
+
+/*!
+    \fn QKnxByteArrayView::QKnxByteArrayView(const quint8 *data, int size)
+
+    Constructs a byte array view on the first \a size bytes of \a data. If
+    \a data is \c nullptr or \a size is negative, an empty view is constructed.
+*/
+
+/*!
+    \fn QKnxByteArrayView::QKnxByteArrayView(const QKnxByteArray &bytes)
+
+    Constructs a byte array view on the contents of \a bytes. The view is
+    invalidated as soon as \a bytes is modified or destroyed.
+*/
+
+/*!
+    \fn QKnxByteArrayView::QKnxByteArrayView(const QByteArray &bytes)
+
+    Constructs a byte array view on the contents of \a bytes. The view is
+    invalidated as soon as \a bytes is modified or destroyed.
+*/
+
+/*!
+    \fn bool QKnxByteArrayView::isNull() const
+
+    Returns \c true if the view does not reference any memory; otherwise
+    returns \c false.
+*/
+
+/*!
+    \fn bool QKnxByteArrayView::isEmpty() const
+
+    Returns \c true if the view has the size 0; otherwise returns \c false.
+*/
+
+/*!
+    \fn int QKnxByteArrayView::size() const
+
+    Returns the number of bytes referenced by this view.
+*/
+
+/*!
+    \fn const quint8 *QKnxByteArrayView::data() const
+
+    Returns a pointer to the first byte referenced by this view.
+*/
+
+/*!
+    \fn const quint8 *QKnxByteArrayView::constData() const
+
+    Returns a pointer to the first byte referenced by this view.
+*/
+
+/*!
+    \fn quint8 QKnxByteArrayView::at(int i) const
+
+    Returns the byte at the index position \a i in the view.
+
+    \a i must be a valid index position in the view (that is, between
+    0 and the value returned by size()).
+*/
+
+/*!
+    \fn quint8 QKnxByteArrayView::value(int i, quint8 defaultValue = {}) const
+
+    Returns the byte at the index position \a i in the view. If the index \a i
+    is out of bounds, the function returns \a defaultValue.
+*/
+
+/*!
+    \fn QKnxByteArrayView QKnxByteArrayView::left(int len) const
+
+    Returns a view on the leftmost \a len bytes of this view. The entire view
+    is returned if \a len is greater than the value returned by size().
+*/
+
+/*!
+    \fn QKnxByteArrayView QKnxByteArrayView::right(int len) const
+
+    Returns a view on the rightmost \a len bytes of this view. The entire view
+    is returned if \a len is greater than the value returned by size().
+*/
+
+/*!
+    \fn QKnxByteArrayView QKnxByteArrayView::mid(int pos, int len = -1) const
+
+    Returns a view on \a len bytes of this view, starting at the position
+    \a pos. If \a len is \c -1 (the default), or \a pos added to \a len
+    exceeds the value returned by size(), the returned view contains all
+    bytes starting from the position \a pos to the end of this view.
+*/
+
+/*!
+    \fn QKnxByteArray QKnxByteArrayView::toByteArray() const
+
+    Returns a deep copy of the referenced bytes as \l QKnxByteArray.
+*/
+
+/*!
+    \fn QKnxByteArrayView::const_iterator QKnxByteArrayView::begin() const
+
+    Returns a const \l{STL-style iterators}{STL-style iterator} pointing to the
+    first byte in the view.
+*/
+
+/*!
+    \fn QKnxByteArrayView::const_iterator QKnxByteArrayView::cbegin() const
+
+    Returns a const \l{STL-style iterators}{STL-style iterator} pointing to the
+    first byte in the view.
+*/
+
+/*!
+    \fn QKnxByteArrayView::const_iterator QKnxByteArrayView::end() const
+
+    Returns a const \l{STL-style iterators}{STL-style iterator} pointing to the
+    imaginary byte after the last byte in the view.
+*/
+
+/*!
+    \fn QKnxByteArrayView::const_iterator QKnxByteArrayView::cend() const
+
+    Returns a const \l{STL-style iterators}{STL-style iterator} pointing to the
+    imaginary byte after the last byte in the view.
+*/
+
+/*! \typedef QKnxByteArrayView::value_type
+    \internal
+*/
+
+/*! \typedef QKnxByteArrayView::const_pointer
+    \internal
+*/
+
+/*! \typedef QKnxByteArrayView::const_reference
+    \internal
+*/
+
+/*! \typedef QKnxByteArrayView::const_iterator
+    \internal
+*/
+
+/*! \typedef QKnxByteArrayView::size_type
+    \internal
+*/
+
+/*!
+    \relates QKnxByteArrayView
+    \fn bool operator==(QKnxByteArrayView lhs, QKnxByteArrayView rhs)
+
+    Returns \c true if the bytes referenced by \a lhs are equal to the bytes
+    referenced by \a rhs; otherwise returns \c false.
+*/
+
+/*!
+    \relates QKnxByteArrayView
+    \fn bool operator!=(QKnxByteArrayView lhs, QKnxByteArrayView rhs)
+
+    Returns \c true if the bytes referenced by \a lhs are not equal to the
+    bytes referenced by \a rhs; otherwise returns \c false.
+*/
+
+/*!
+    \relates QKnxByteArrayView
+
+    Writes the bytes referenced by \a view to the \a debug stream.
+*/
+QDebug operator<<(QDebug debug, QKnxByteArrayView view)
+{
+    debug << QByteArray::fromRawData(reinterpret_cast<const char *> (view.constData()),
+        view.size());
+    return debug;
+}
+
+QT_END_NAMESPACE
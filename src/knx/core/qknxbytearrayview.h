@@ -0,0 +1,144 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtKnx module.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QKNXBYTEARRAYVIEW_H
+#define QKNXBYTEARRAYVIEW_H
+
+#include <QtCore/qbytearray.h>
+
+#include <QtKnx/qknxbytearray.h>
+#include <QtKnx/qtknxglobal.h>
+
+QT_BEGIN_NAMESPACE
+
+class QKnxByteArrayView
+{
+public:
+    typedef quint8 value_type;
+    typedef const quint8 *const_pointer;
+    typedef const quint8 &const_reference;
+    typedef const quint8 *const_iterator;
+    typedef int size_type;
+
+    Q_DECL_CONSTEXPR QKnxByteArrayView() Q_DECL_NOTHROW = default;
+
+    Q_DECL_CONSTEXPR QKnxByteArrayView(const quint8 *data, int size) Q_DECL_NOTHROW
+        : m_data(data)
+        , m_size(data && size > 0 ? size : 0)
+    {}
+
+    QKnxByteArrayView(const QKnxByteArray &bytes) Q_DECL_NOTHROW
+        : m_data(bytes.constData())
+        , m_size(bytes.size())
+    {}
+
+    QKnxByteArrayView(const QByteArray &bytes) Q_DECL_NOTHROW
+        : m_data(reinterpret_cast<const quint8 *> (bytes.constData()))
+        , m_size(bytes.size())
+    {}
+
+    Q_DECL_CONSTEXPR bool isNull() const Q_DECL_NOTHROW { return !m_data; }
+    Q_DECL_CONSTEXPR bool isEmpty() const Q_DECL_NOTHROW { return m_size == 0; }
+    Q_DECL_CONSTEXPR int size() const Q_DECL_NOTHROW { return m_size; }
+
+    Q_DECL_CONSTEXPR const quint8 *data() const Q_DECL_NOTHROW { return m_data; }
+    Q_DECL_CONSTEXPR const quint8 *constData() const Q_DECL_NOTHROW { return m_data; }
+
+    Q_DECL_CONSTEXPR quint8 at(int i) const { return m_data[i]; }
+    Q_DECL_CONSTEXPR quint8 value(int i, quint8 defaultValue = {}) const Q_DECL_NOTHROW
+    {
+        return (uint(i) >= uint(m_size) ? defaultValue : m_data[i]);
+    }
+
+    Q_REQUIRED_RESULT QKnxByteArrayView left(int len) const Q_DECL_NOTHROW
+    {
+        if (len >= m_size)
+            return *this;
+        return { m_data, len < 0 ? 0 : len };
+    }
+
+    Q_REQUIRED_RESULT QKnxByteArrayView right(int len) const Q_DECL_NOTHROW
+    {
+        if (len >= m_size)
+            return *this;
+        if (len < 0)
+            len = 0;
+        return { m_data + m_size - len, len };
+    }
+
+    Q_REQUIRED_RESULT QKnxByteArrayView mid(int pos, int len = -1) const Q_DECL_NOTHROW
+    {
+        if (pos < 0 || pos >= m_size)
+            return {};
+        if (len < 0 || len > m_size - pos)
+            len = m_size - pos;
+        return { m_data + pos, len };
+    }
+
+    QKnxByteArray toByteArray() const
+    {
+        return QKnxByteArray(m_data, m_size);
+    }
+
+    Q_DECL_CONSTEXPR const_iterator begin() const Q_DECL_NOTHROW { return m_data; }
+    Q_DECL_CONSTEXPR const_iterator cbegin() const Q_DECL_NOTHROW { return m_data; }
+    Q_DECL_CONSTEXPR const_iterator end() const Q_DECL_NOTHROW { return m_data + m_size; }
+    Q_DECL_CONSTEXPR const_iterator cend() const Q_DECL_NOTHROW { return m_data + m_size; }
+
+private:
+    const quint8 *m_data { nullptr };
+    int m_size { 0 };
+};
+Q_DECLARE_TYPEINFO(QKnxByteArrayView, Q_PRIMITIVE_TYPE);
+
+inline bool operator==(QKnxByteArrayView lhs, QKnxByteArrayView rhs) Q_DECL_NOTHROW
+{
+    return (lhs.size() == rhs.size())
+        && (lhs.size() == 0 || memcmp(lhs.constData(), rhs.constData(), lhs.size()) == 0);
+}
+inline bool operator!=(QKnxByteArrayView lhs, QKnxByteArrayView rhs) Q_DECL_NOTHROW
+{
+    return !(lhs == rhs);
+}
+
+Q_KNX_EXPORT QDebug operator<<(QDebug debug, QKnxByteArrayView view);
+
+QT_END_NAMESPACE
+
+#endif
@@ -18,6 +18,8 @@ PUBLIC_HEADERS += $$PWD/qknx1bit.h \
     $$PWD/qknxchar.h \
     $$PWD/qknxcharstring.h \
     $$PWD/qknxdatapointtype.h \
+    $$PWD/qknxdatapointtypecodec.h \
+    $$PWD/qknxdatapointtypedescriptor.h \
     $$PWD/qknxdatapointtypefactory.h \
     $$PWD/qknxdatetime.h \
     $$PWD/qknxelectricalenergy.h \
@@ -48,6 +50,7 @@ SOURCES += $$PWD/qknx1bit.cpp \
     $$PWD/qknxchar.cpp \
     $$PWD/qknxcharstring.cpp \
     $$PWD/qknxdatapointtype.cpp \
+    $$PWD/qknxdatapointtypecodec.cpp \
     $$PWD/qknxdatapointtypefactory.cpp \
     $$PWD/qknxdatetime.cpp \
     $$PWD/qknxelectricalenergy.cpp \
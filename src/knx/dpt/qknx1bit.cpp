@@ -110,9 +110,11 @@ QKnx1Bit::QKnx1Bit(bool bit)
 QKnx1Bit::QKnx1Bit(int subType, bool bit)
     : QKnxFixedSizeDatapointType(MainType, subType, TypeSize)
 {
-    setDescription(tr("1-bit"));
-    setRangeText(tr("false"), tr("true"));
-    setRange(QVariant(0x00), QVariant(0x01));
+    QKnxDatapointTypePrivate::setupMetaData(this, [this]() {
+        setDescription(tr("1-bit"));
+        setRangeText(tr("false"), tr("true"));
+        QKnxDatapointTypePrivate::setRange(this, descriptor());
+    });
 
     setBit(bit);
 }
@@ -150,8 +152,10 @@ CLASS::CLASS() \
 CLASS::CLASS(State state) \
     : QKnx1Bit(SubType, bool(state)) \
 { \
-    setDescription(tr(DESCRIPTION)); \
-    setRangeText(tr(RANGE_TEXT_MINIMUM), tr(RANGE_TEXT_MAXIMUM)); \
+    QKnxDatapointTypePrivate::setupMetaData(this, [this]() { \
+        setDescription(tr(DESCRIPTION)); \
+        setRangeText(tr(RANGE_TEXT_MINIMUM), tr(RANGE_TEXT_MAXIMUM)); \
+    }); \
 } \
 CLASS::State CLASS::value() const \
 { \
@@ -31,6 +31,7 @@
 #define QKNX1BIT_H
 
 #include <QtKnx/qknxdatapointtype.h>
+#include <QtKnx/qknxdatapointtypedescriptor.h>
 #include <QtKnx/qtknxglobal.h>
 
 QT_BEGIN_NAMESPACE
@@ -44,6 +45,11 @@ public:
     static const constexpr int TypeSize = 0x01;
     static const constexpr int MainType = 0x01;
 
+    static constexpr QKnxDatapointTypeDescriptor<bool> descriptor()
+    {
+        return { MainType, 0, TypeSize, false, true, 1., "" };
+    }
+
     bool bit() const;
     bool setBit(bool value);
 
@@ -70,6 +76,11 @@ public: \
     explicit CLASS(State state); \
 \
     static const constexpr int SubType = SUB_TYPE; \
+\
+    static constexpr QKnxDatapointTypeDescriptor<bool> descriptor() \
+    { \
+        return { MainType, SubType, TypeSize, false, true, 1., "" }; \
+    } \
 \
     State value() const; \
     bool setValue(State state); \
@@ -86,10 +86,12 @@ QKnx1BitControlled::QKnx1BitControlled()
 QKnx1BitControlled::QKnx1BitControlled(int subType, bool state, bool control)
     : QKnxFixedSizeDatapointType(MainType, subType, TypeSize)
 {
-    setDescription(tr("1-bit controlled"));
+    QKnxDatapointTypePrivate::setupMetaData(this, [this]() {
+        setDescription(tr("1-bit controlled"));
 
-    setRange(QVariant(0x00), QVariant(0x03));
-    setRangeText(tr("No control, false"), tr("Controlled, true"));
+        setRange(QVariant(0x00), QVariant(0x03));
+        setRangeText(tr("No control, false"), tr("Controlled, true"));
+    });
     setValueBit(state);
     setControlBit(control);
 }
@@ -152,9 +154,14 @@ CLASS::CLASS() \
     : CLASS(State(0), Control::NoControl) \
 {} \
 CLASS::CLASS(State state, Control control) \
-    : QKnx1BitControlled(SubType, CLASS1(), bool(state), bool(control)) \
+    : QKnx1BitControlled(SubType, bool(state), bool(control)) \
 { \
-    setDescription(tr(DESCRIPTION)); \
+    QKnxDatapointTypePrivate::setupMetaData(this, [this]() { \
+        const CLASS1 dpt; \
+        setMinimumText(QKnx1BitControlled::tr("No control, %1").arg(dpt.minimumText())); \
+        setMaximumText(QKnx1BitControlled::tr("Controlled, %1").arg(dpt.maximumText())); \
+        setDescription(tr(DESCRIPTION)); \
+    }); \
 } \
 CLASS::State CLASS::state() const \
 { \
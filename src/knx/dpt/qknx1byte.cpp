@@ -68,9 +68,11 @@ QKnx1Byte::QKnx1Byte(quint8 value)
 QKnx1Byte::QKnx1Byte(int subType, quint8 value)
     : QKnxFixedSizeDatapointType(MainType, subType, TypeSize)
 {
-    setDescription(tr("1-byte"));
-    setRange(QVariant(0x00), QVariant(0xff));
-    setRangeText(tr("Value: 0"), tr("Value: 255"));
+    QKnxDatapointTypePrivate::setupMetaData(this, [this]() {
+        setDescription(tr("1-byte"));
+        setRange(QVariant(0x00), QVariant(0xff));
+        setRangeText(tr("Value: 0"), tr("Value: 255"));
+    });
 
     setValue(value);
 }
@@ -176,9 +178,11 @@ QKnxScloMode::QKnxScloMode()
 QKnxScloMode::QKnxScloMode(Mode mode)
     : QKnx1Byte(SubType, 0)
 {
-    setDescription(tr("SCLO Mode"));
-    setRange(QVariant(0x00), QVariant(0x02));
-    setRangeText(tr("Autonomous, 0"), tr("Master, 2"));
+    QKnxDatapointTypePrivate::setupMetaData(this, [this]() {
+        setDescription(tr("SCLO Mode"));
+        setRange(QVariant(0x00), QVariant(0x02));
+        setRangeText(tr("Autonomous, 0"), tr("Master, 2"));
+    });
     setMode(mode);
 }
 
@@ -256,9 +260,11 @@ QKnxBuildingMode::QKnxBuildingMode()
 QKnxBuildingMode::QKnxBuildingMode(Mode mode)
     : QKnx1Byte(SubType, 0)
 {
-    setDescription(tr("Building Mode"));
-    setRange(QVariant(0x00), QVariant(0x02));
-    setRangeText(tr("Building in use, 0"), tr("Building protection, 2"));
+    QKnxDatapointTypePrivate::setupMetaData(this, [this]() {
+        setDescription(tr("Building Mode"));
+        setRange(QVariant(0x00), QVariant(0x02));
+        setRangeText(tr("Building in use, 0"), tr("Building protection, 2"));
+    });
     setMode(mode);
 }
 
@@ -332,9 +338,11 @@ QKnxOccupyMode::QKnxOccupyMode()
 QKnxOccupyMode::QKnxOccupyMode(Mode mode)
     : QKnx1Byte(SubType, 0)
 {
-    setDescription(tr("Occupied"));
-    setRange(QVariant(0x00), QVariant(0x02));
-    setRangeText(tr("Occupied, 0"), tr("Not occupied, 2"));
+    QKnxDatapointTypePrivate::setupMetaData(this, [this]() {
+        setDescription(tr("Occupied"));
+        setRange(QVariant(0x00), QVariant(0x02));
+        setRangeText(tr("Occupied, 0"), tr("Not occupied, 2"));
+    });
     setMode(mode);
 }
 
@@ -411,9 +419,11 @@ QKnxPriority::QKnxPriority()
 QKnxPriority::QKnxPriority(Priority priority)
     : QKnx1Byte(SubType, 0)
 {
-    setDescription(tr("Priority"));
-    setRange(QVariant(0x00), QVariant(0x03));
-    setRangeText(tr("High, 0"), tr("void, 3"));
+    QKnxDatapointTypePrivate::setupMetaData(this, [this]() {
+        setDescription(tr("Priority"));
+        setRange(QVariant(0x00), QVariant(0x03));
+        setRangeText(tr("High, 0"), tr("void, 3"));
+    });
     setPriority(priority);
 }
 
@@ -486,9 +496,11 @@ QKnxLightApplicationMode::QKnxLightApplicationMode()
 QKnxLightApplicationMode::QKnxLightApplicationMode(Mode mode)
     : QKnx1Byte(SubType, 0)
 {
-    setDescription(tr("Light application mode"));
-    setRange(QVariant(0x00), QVariant(0x02));
-    setRangeText(tr("Normal, 0"), tr("Night round, 2"));
+    QKnxDatapointTypePrivate::setupMetaData(this, [this]() {
+        setDescription(tr("Light application mode"));
+        setRange(QVariant(0x00), QVariant(0x02));
+        setRangeText(tr("Normal, 0"), tr("Night round, 2"));
+    });
     setMode(mode);
 }
 
@@ -591,9 +603,11 @@ QKnxApplicationArea::QKnxApplicationArea()
 QKnxApplicationArea::QKnxApplicationArea(Area area)
     : QKnx1Byte(SubType, 0)
 {
-    setDescription(tr("Application Area"));
-    setRange(QVariant(0x00), QVariant(0x32));
-    setRangeText(tr("no fault, 0"), tr("Shutters and blinds, 50"));
+    QKnxDatapointTypePrivate::setupMetaData(this, [this]() {
+        setDescription(tr("Application Area"));
+        setRange(QVariant(0x00), QVariant(0x32));
+        setRangeText(tr("no fault, 0"), tr("Shutters and blinds, 50"));
+    });
     setArea(area);
 }
 
@@ -706,9 +720,11 @@ QKnxAlarmClassType::QKnxAlarmClassType()
 QKnxAlarmClassType::QKnxAlarmClassType(Type type)
     : QKnx1Byte(SubType, 0)
 {
-    setDescription(tr("Alarm"));
-    setRange(QVariant(0x01), QVariant(0x03));
-    setRangeText(tr("Simple alarm, 1"), tr("Extended alarm, 3"));
+    QKnxDatapointTypePrivate::setupMetaData(this, [this]() {
+        setDescription(tr("Alarm"));
+        setRange(QVariant(0x01), QVariant(0x03));
+        setRangeText(tr("Simple alarm, 1"), tr("Extended alarm, 3"));
+    });
     setType(type);
 }
 
@@ -792,9 +808,11 @@ QKnxPsuMode::QKnxPsuMode()
 QKnxPsuMode::QKnxPsuMode(Mode mode)
     : QKnx1Byte(SubType, 0)
 {
-    setDescription(tr("PSU Mode"));
-    setRange(QVariant(0x00), QVariant(0x02));
-    setRangeText(tr("Disabled, 0"), tr("Automatic, 2"));
+    QKnxDatapointTypePrivate::setupMetaData(this, [this]() {
+        setDescription(tr("PSU Mode"));
+        setRange(QVariant(0x00), QVariant(0x02));
+        setRangeText(tr("Disabled, 0"), tr("Automatic, 2"));
+    });
     setMode(mode);
 }
 
@@ -908,9 +926,11 @@ QKnxErrorClassSystem::QKnxErrorClassSystem()
 QKnxErrorClassSystem::QKnxErrorClassSystem(Error error)
     : QKnx1Byte(SubType, 0)
 {
-    setDescription(tr("System error class"));
-    setRange(QVariant(0x00), QVariant(0x12));
-    setRangeText(tr("No fault, 0"), tr("Group object type exceeds, 18"));
+    QKnxDatapointTypePrivate::setupMetaData(this, [this]() {
+        setDescription(tr("System error class"));
+        setRange(QVariant(0x00), QVariant(0x12));
+        setRangeText(tr("No fault, 0"), tr("Group object type exceeds, 18"));
+    });
     setError(error);
 }
 
@@ -988,9 +1008,11 @@ QKnxErrorClassHvac::QKnxErrorClassHvac()
 QKnxErrorClassHvac::QKnxErrorClassHvac(Error error)
     : QKnx1Byte(SubType, 0)
 {
-    setDescription(tr("HVAC error class"));
-    setRange(QVariant(0x00), QVariant(0x04));
-    setRangeText(tr("No fault, 0"), tr("Other fault, 4"));
+    QKnxDatapointTypePrivate::setupMetaData(this, [this]() {
+        setDescription(tr("HVAC error class"));
+        setRange(QVariant(0x00), QVariant(0x04));
+        setRangeText(tr("No fault, 0"), tr("Other fault, 4"));
+    });
     setError(error);
 }
 
@@ -1084,9 +1106,11 @@ QKnxTimeDelay::QKnxTimeDelay()
 QKnxTimeDelay::QKnxTimeDelay(Delay delay)
     : QKnx1Byte(SubType, 0)
 {
-    setDescription(tr("Time delay"));
-    setRange(QVariant(0x00), QVariant(0x19));
-    setRangeText(tr("Not active, 0"), tr("Twenty four hours, 25"));
+    QKnxDatapointTypePrivate::setupMetaData(this, [this]() {
+        setDescription(tr("Time delay"));
+        setRange(QVariant(0x00), QVariant(0x19));
+        setRangeText(tr("Not active, 0"), tr("Twenty four hours, 25"));
+    });
     setDelay(delay);
 }
 
@@ -1168,9 +1192,11 @@ QKnxBeaufortWindForceScale::QKnxBeaufortWindForceScale()
 QKnxBeaufortWindForceScale::QKnxBeaufortWindForceScale(Force force)
     : QKnx1Byte(SubType, 0)
 {
-    setDescription(tr("Wind force scale (0..12)"));
-    setRange(QVariant(0x00), QVariant(0x0c));
-    setRangeText(tr("Calm (no wind), 0"), tr("Hurricane, 12"));
+    QKnxDatapointTypePrivate::setupMetaData(this, [this]() {
+        setDescription(tr("Wind force scale (0..12)"));
+        setRange(QVariant(0x00), QVariant(0x0c));
+        setRangeText(tr("Calm (no wind), 0"), tr("Hurricane, 12"));
+    });
     setForce(force);
 }
 
@@ -1247,9 +1273,11 @@ QKnxSensorSelect::QKnxSensorSelect()
 QKnxSensorSelect::QKnxSensorSelect(Mode mode)
     : QKnx1Byte(SubType, 0)
 {
-    setDescription(tr("Sensor mode"));
-    setRange(QVariant(0x00), QVariant(0x04));
-    setRangeText(tr("Inactive, 0"), tr("Temperature sensor input, 12"));
+    QKnxDatapointTypePrivate::setupMetaData(this, [this]() {
+        setDescription(tr("Sensor mode"));
+        setRange(QVariant(0x00), QVariant(0x04));
+        setRangeText(tr("Inactive, 0"), tr("Temperature sensor input, 12"));
+    });
     setMode(mode);
 }
 
@@ -1321,9 +1349,11 @@ QKnxActuatorConnectType::QKnxActuatorConnectType()
 QKnxActuatorConnectType::QKnxActuatorConnectType(Type type)
     : QKnx1Byte(SubType, 0)
 {
-    setDescription(tr("Actuator connect type"));
-    setRange(QVariant(0x01), QVariant(0x02));
-    setRangeText(tr("Sensor connection, 1"), tr("Controller connection, 2"));
+    QKnxDatapointTypePrivate::setupMetaData(this, [this]() {
+        setDescription(tr("Actuator connect type"));
+        setRange(QVariant(0x01), QVariant(0x02));
+        setRangeText(tr("Sensor connection, 1"), tr("Controller connection, 2"));
+    });
     setType(type);
 }
 
@@ -1418,9 +1448,11 @@ QKnxCloudCover::QKnxCloudCover()
 QKnxCloudCover::QKnxCloudCover(Scale scale)
     : QKnx1Byte(SubType, 0)
 {
-    setDescription(tr("Cloud cover"));
-    setRange(QVariant(0x00), QVariant(0x09));
-    setRangeText(tr("Cloudless, 0"), tr("Sky is obstructed from view, 9"));
+    QKnxDatapointTypePrivate::setupMetaData(this, [this]() {
+        setDescription(tr("Cloud cover"));
+        setRange(QVariant(0x00), QVariant(0x09));
+        setRangeText(tr("Cloudless, 0"), tr("Sky is obstructed from view, 9"));
+    });
     setCloudCover(scale);
 }
 
@@ -71,8 +71,10 @@ QKnx2BitSet::QKnx2BitSet(quint8 value)
 QKnx2BitSet::QKnx2BitSet(int subType, quint8 value)
     : QKnxFixedSizeDatapointType(MainType, subType, TypeSize)
 {
-    setDescription(tr("2-bit set"));
-    setRange(QVariant(0x00), QVariant(0x03));
+    QKnxDatapointTypePrivate::setupMetaData(this, [this]() {
+        setDescription(tr("2-bit set"));
+        setRange(QVariant(0x00), QVariant(0x03));
+    });
     setValue(value);
 }
 
@@ -150,8 +152,10 @@ QKnxOnOffAction::QKnxOnOffAction()
 QKnxOnOffAction::QKnxOnOffAction(Action action)
     : QKnx2BitSet(SubType, quint8(action))
 {
-    setDescription(tr("On/Off Action"));
-    setRangeText(tr("Minimum Off, 0"), tr("Maximum On/Off, 3"));
+    QKnxDatapointTypePrivate::setupMetaData(this, [this]() {
+        setDescription(tr("On/Off Action"));
+        setRangeText(tr("Minimum Off, 0"), tr("Maximum On/Off, 3"));
+    });
 }
 
 /*!
@@ -221,9 +225,11 @@ QKnxAlarmReaction::QKnxAlarmReaction()
 QKnxAlarmReaction::QKnxAlarmReaction(Alarm alarm)
     : QKnx2BitSet(SubType, quint8(alarm))
 {
-    setDescription(tr("Alarm reaction"));
-    setRangeText(tr("No alarm is used, 0"), tr("Alarm position is down, 2"));
-    setRange(QVariant(0x00), QVariant(0x02));
+    QKnxDatapointTypePrivate::setupMetaData(this, [this]() {
+        setDescription(tr("Alarm reaction"));
+        setRangeText(tr("No alarm is used, 0"), tr("Alarm position is down, 2"));
+        setRange(QVariant(0x00), QVariant(0x02));
+    });
     setAlarm(alarm);
 }
 
@@ -291,8 +297,10 @@ QKnxUpDownAction::QKnxUpDownAction()
 QKnxUpDownAction::QKnxUpDownAction(Action action)
     : QKnx2BitSet(SubType, quint8(action))
 {
-    setDescription(tr("Up/Down Action"));
-    setRangeText(tr("Minimum Up, 0"), tr("Maximum Down/Up, 3"));
+    QKnxDatapointTypePrivate::setupMetaData(this, [this]() {
+        setDescription(tr("Up/Down Action"));
+        setRangeText(tr("Minimum Up, 0"), tr("Maximum Down/Up, 3"));
+    });
 }
 
 /*!
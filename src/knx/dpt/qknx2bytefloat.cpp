@@ -29,9 +29,7 @@
 
 #include "qknx2bytefloat.h"
 #include "qknxdatapointtype_p.h"
-
-#include "qknxutils.h"
-#include "qmath.h"
+#include "qknxdatapointtypecodec.h"
 
 QT_BEGIN_NAMESPACE
 
@@ -180,9 +178,11 @@ QKnx2ByteFloat::QKnx2ByteFloat(float value)
 QKnx2ByteFloat::QKnx2ByteFloat(int subType, float value)
     : QKnxFixedSizeDatapointType(MainType, subType, TypeSize)
 {
-    setDescription(tr("2-byte float"));
-    setRangeText(tr("Minimum Value, -671 088.64"), tr("Maximum Value, 670 760.96"));
-    setRange(QVariant::fromValue(-671088.64), QVariant::fromValue(670760.96));
+    QKnxDatapointTypePrivate::setupMetaData(this, [this]() {
+        setDescription(tr("2-byte float"));
+        setRangeText(tr("Minimum Value, -671 088.64"), tr("Maximum Value, 670 760.96"));
+        QKnxDatapointTypePrivate::setRange(this, descriptor());
+    });
 
     setValue(value);
 }
@@ -192,16 +192,7 @@ QKnx2ByteFloat::QKnx2ByteFloat(int subType, float value)
 */
 float QKnx2ByteFloat::value() const
 {
-    quint16 temp = QKnxUtils::QUint16::fromBytes(bytes());
-    quint16 encodedM = (temp & 0x87ff);
-    // Turning on bits reserved for E.
-    // Only needed for reinterpretation of negative values
-    if (encodedM > 2047)
-        encodedM += 0x7800;
-
-    qint16 M = qint16(encodedM);
-    quint8 E = (temp & 0x7800) >> 11;
-    return float(0.01 * (M) * qPow(2, qreal(E)));
+    return QKnxDatapointTypeCodec::decode<QKnx2ByteFloat>({ constData(), size() });
 }
 
 /*!
@@ -215,18 +206,10 @@ bool QKnx2ByteFloat::setValue(float value)
     if (value < minimum().toFloat() || value > maximum().toFloat())
         return false;
 
-    quint8 E = 0;
-    if (qAbs(qreal(value)) > 20.48)
-        E = quint8(qFloor(qLn(qAbs(qreal(value) * 100 / 2048.)) / qLn(2) + 1));
-    qint32 M = qint32(qRound((value*float(qPow(2, -E)) * 100)));
-    if (E > 15 || M > 2047 || M < -2048)
+    quint8 encoded[TypeSize];
+    if (!QKnxDatapointTypeCodec::encode<QKnx2ByteFloat>(value, encoded))
         return false; // Should never happen considering the ranges of value.
-
-    quint16 encodedM = quint16(M);
-    if (value < 0)
-        encodedM &= 0x87ff;
-    encodedM |= E << 11;
-    setBytes(QKnxUtils::QUint16::bytes(encodedM), 0, 2);
+    setBytes(QKnxByteArray(encoded, TypeSize), 0, TypeSize);
     return true;
 }
 
@@ -239,15 +222,16 @@ bool QKnx2ByteFloat::isValid() const
         && value() >= minimum().toFloat() && value() <= maximum().toFloat();
 }
 
-#define CREATE_CLASS_BODY(CLASS, DESCRIPTION, RANGE_TEXT_MINIMUM, RANGE_TEXT_MAXIMUM, UNIT, \
-    RANGE_VALUE_MINIMUM, RANGE_VALUE_MAXIMUM) \
+#define CREATE_CLASS_BODY(CLASS, DESCRIPTION, RANGE_TEXT_MINIMUM, RANGE_TEXT_MAXIMUM) \
 CLASS::CLASS() \
     : QKnx2ByteFloat(SubType, 0.0) \
 { \
-    setUnit(tr(UNIT)); \
-    setDescription(tr(DESCRIPTION)); \
-    setRangeText(tr(RANGE_TEXT_MINIMUM), tr(RANGE_TEXT_MAXIMUM)); \
-    setRange(QVariant::fromValue(RANGE_VALUE_MINIMUM), QVariant::fromValue(RANGE_VALUE_MAXIMUM)); \
+    QKnxDatapointTypePrivate::setupMetaData(this, [this]() { \
+        setUnit(tr(descriptor().unit)); \
+        setDescription(tr(DESCRIPTION)); \
+        setRangeText(tr(RANGE_TEXT_MINIMUM), tr(RANGE_TEXT_MAXIMUM)); \
+        QKnxDatapointTypePrivate::setRange(this, descriptor()); \
+    }); \
 } \
 CLASS::CLASS(float value) \
     : CLASS() \
@@ -256,49 +240,46 @@ CLASS::CLASS(float value) \
 }
 
 CREATE_CLASS_BODY(QKnxTemperatureCelsius, "Temperature in degree Celsius",
-    "Minimum Value, -273", "Maximum Value, 670 760","degree Celsius", -273, 670760)
+    "Minimum Value, -273", "Maximum Value, 670 760")
 CREATE_CLASS_BODY(QKnxTemperatureKelvin, "Temperature in degree Kelvin",
-    "Minimum Value, -670 760", "Maximum Value, 670 760", "degree Kelvin", -670760, 670760)
+    "Minimum Value, -670 760", "Maximum Value, 670 760")
 CREATE_CLASS_BODY(QKnxTemperatureChange, "Change in Temperature (K) per hour",
-    "Minimum Value, -670 760", "Maximum Value, 670 760", "Lux", -670760, 670760)
-CREATE_CLASS_BODY(QKnxValueLux, "Brightness in Lux",
-    "Minimum Value, 0", "Maximum Value, 670 760", "Lux", 0, 670760)
+    "Minimum Value, -670 760", "Maximum Value, 670 760")
+CREATE_CLASS_BODY(QKnxValueLux, "Brightness in Lux", "Minimum Value, 0", "Maximum Value, 670 760")
 CREATE_CLASS_BODY(QKnxWindSpeed, "Wind Speed in meter per second",
-    "Minimum Value, 0", "Maximum Value, 670 760", "m/s", 0, 670760)
-CREATE_CLASS_BODY(QKnxPressure, "Pressure in Pascal",
-    "Minimum Value, 0", "Maximum Value, 670 760", "Pa", 0, 670760)
-CREATE_CLASS_BODY(QKnxHumidity, "Humidity in percent",
-    "Minimum Value, 0", "Maximum Value, 670 760", "Percent", 0, 670760)
+    "Minimum Value, 0", "Maximum Value, 670 760")
+CREATE_CLASS_BODY(QKnxPressure, "Pressure in Pascal", "Minimum Value, 0", "Maximum Value, 670 760")
+CREATE_CLASS_BODY(QKnxHumidity, "Humidity in percent", "Minimum Value, 0", "Maximum Value, 670 760")
 CREATE_CLASS_BODY(QKnxAirQuality, "Air Quality in ppm",
-    "Minimum Value, 0", "Maximum Value, 670 760", "ppm", 0, 670760)
+    "Minimum Value, 0", "Maximum Value, 670 760")
 CREATE_CLASS_BODY(QKnxAirFlow, "Air Flow in m3/h",
-    "Minimum Value, -670 760", "Maximum Value, 670 760", "m3/h", -670760, 670760)
+    "Minimum Value, -670 760", "Maximum Value, 670 760")
 CREATE_CLASS_BODY(QKnxTimeSecond, "Time in second",
-    "Minimum Value, -670 760", "Maximum Value, 670 760", "s", -670760, 670760)
+    "Minimum Value, -670 760", "Maximum Value, 670 760")
 CREATE_CLASS_BODY(QKnxTimeMilliSecond, "Time in milli-Second",
-    "Minimum Value, -670 760", "Maximum Value, 670 760", "ms", -670760, 670760)
+    "Minimum Value, -670 760", "Maximum Value, 670 760")
 CREATE_CLASS_BODY(QKnxVoltage, "Voltage in milli-Volt",
-    "Minimum Value, -670 760", "Maximum Value, 670 760", "mV", -670760, 670760)
+    "Minimum Value, -670 760", "Maximum Value, 670 760")
 CREATE_CLASS_BODY(QKnxCurrent, "Current in milli-Amper",
-    "Minimum Value, -670 760", "Maximum Value, 670 760", "mA", -670760, 670760)
+    "Minimum Value, -670 760", "Maximum Value, 670 760")
 CREATE_CLASS_BODY(QKnxPowerDensity, "Power Density in Watt per square meter",
-    "Minimum Value, -670 760", "Maximum Value, 670 760", "W/m2", -670760, 670760)
+    "Minimum Value, -670 760", "Maximum Value, 670 760")
 CREATE_CLASS_BODY(QKnxKelvinPerPercent, "Kelvin per Percent",
-    "Minimum Value, -670 760", "Maximum Value, 670 760", "K/Percent", -670760, 670760)
+    "Minimum Value, -670 760", "Maximum Value, 670 760")
 CREATE_CLASS_BODY(QKnxPower, "Power in kilo Watt",
-    "Minimum Value, -670 760", "Maximum Value, 670 760", "kW", -670760, 670760)
+    "Minimum Value, -670 760", "Maximum Value, 670 760")
 CREATE_CLASS_BODY(QKnxVolumeFlow, "Volume Flow in liter per hour",
-    "Minimum Value, -670 760", "Maximum Value, 670 760", "l/h", -670760, 670760)
+    "Minimum Value, -670 760", "Maximum Value, 670 760")
 CREATE_CLASS_BODY(QKnxAmountRain, "Amount of Rain in liter per square meter",
-    "Minimum Value, -671 088.64", "Maximum Value, 670 760", "l/m2", -671088.64, 670760.96)
+    "Minimum Value, -671 088.64", "Maximum Value, 670 760")
 CREATE_CLASS_BODY(QKnxTemperatureFahrenheit, "Temperature in Fahrenheit",
-    "Minimum Value, -459.6", "Maximum Value, 670 760", "degree F", -459.6, 670760.96)
+    "Minimum Value, -459.6", "Maximum Value, 670 760")
 CREATE_CLASS_BODY(QKnxWindSpeedKmPerHour, "Wind Speed in kilometer per hour",
-    "Minimum Value, 0", "Maximum Value, 670 760.96", "km/h", 0, 670760.96)
+    "Minimum Value, 0", "Maximum Value, 670 760.96")
 CREATE_CLASS_BODY(QKnxValueAbsoluteHumidity, "Absolute air humidity in grams per cubic meter",
-    "Minimum Value, 0", "Maximum Value, 670 760.96", "g/m3", 0, 670760.96)
+    "Minimum Value, 0", "Maximum Value, 670 760.96")
 CREATE_CLASS_BODY(QKnxConcentration, "Air pollution in micrograms per cubic meter",
-    "Minimum Value, 0", "Maximum Value, 670 760.96", "micro-g/m3", 0, 670760.96)
+    "Minimum Value, 0", "Maximum Value, 670 760.96")
 
 #undef CREATE_CLASS_BODY
 
@@ -31,6 +31,7 @@
 #define QKNX2BYTEFLOAT_H
 
 #include <QtKnx/qknxdatapointtype.h>
+#include <QtKnx/qknxdatapointtypedescriptor.h>
 #include <QtKnx/qtknxglobal.h>
 
 QT_BEGIN_NAMESPACE
@@ -45,6 +46,11 @@ public:
     static const constexpr int TypeSize = 0x02;
     static const constexpr int MainType = 0x09;
 
+    static constexpr QKnxDatapointTypeDescriptor<float> descriptor()
+    {
+        return { MainType, 0, TypeSize, -671088.64f, 670760.96f, 1., "" };
+    }
+
     virtual float value() const;
     virtual bool setValue(float value);
 
@@ -54,7 +60,7 @@ protected:
     QKnx2ByteFloat(int subType, float value);
 };
 
-#define CREATE_CLASS_DECLARATION(CLASS, SUB_TYPE) \
+#define CREATE_CLASS_DECLARATION(CLASS, SUB_TYPE, MINIMUM, MAXIMUM, COEFFICIENT, UNIT) \
 class Q_KNX_EXPORT CLASS : public QKnx2ByteFloat \
 { \
 public: \
@@ -63,30 +69,57 @@ public: \
     static const constexpr int TypeSize = 0x02; \
     static const constexpr int MainType = 0x09; \
     static const constexpr int SubType = SUB_TYPE; \
+\
+    static constexpr QKnxDatapointTypeDescriptor<float> descriptor() \
+    { \
+        return { MainType, SubType, TypeSize, MINIMUM, MAXIMUM, COEFFICIENT, UNIT }; \
+    } \
 };
 
-CREATE_CLASS_DECLARATION(QKnxTemperatureCelsius, 0x01)
-CREATE_CLASS_DECLARATION(QKnxTemperatureKelvin, 0x02)
-CREATE_CLASS_DECLARATION(QKnxTemperatureChange, 0x03)
-CREATE_CLASS_DECLARATION(QKnxValueLux, 0x04)
-CREATE_CLASS_DECLARATION(QKnxWindSpeed, 0x05)
-CREATE_CLASS_DECLARATION(QKnxPressure, 0x06)
-CREATE_CLASS_DECLARATION(QKnxHumidity, 0x07)
-CREATE_CLASS_DECLARATION(QKnxAirQuality, 0x08)
-CREATE_CLASS_DECLARATION(QKnxAirFlow, 0x09)
-CREATE_CLASS_DECLARATION(QKnxTimeSecond, 0x0a)
-CREATE_CLASS_DECLARATION(QKnxTimeMilliSecond, 0x0b)
-CREATE_CLASS_DECLARATION(QKnxVoltage, 0x14)
-CREATE_CLASS_DECLARATION(QKnxCurrent, 0x15)
-CREATE_CLASS_DECLARATION(QKnxPowerDensity, 0x16)
-CREATE_CLASS_DECLARATION(QKnxKelvinPerPercent, 0x17)
-CREATE_CLASS_DECLARATION(QKnxPower, 0x18)
-CREATE_CLASS_DECLARATION(QKnxVolumeFlow, 0x19)
-CREATE_CLASS_DECLARATION(QKnxAmountRain, 0x1a)
-CREATE_CLASS_DECLARATION(QKnxTemperatureFahrenheit, 0x1b)
-CREATE_CLASS_DECLARATION(QKnxWindSpeedKmPerHour, 0x1c)
-CREATE_CLASS_DECLARATION(QKnxValueAbsoluteHumidity, 0x1d)
-CREATE_CLASS_DECLARATION(QKnxConcentration, 0x1e)
+CREATE_CLASS_DECLARATION(QKnxTemperatureCelsius, 0x01, -273.f, 670760.f, 1.,
+    QT_TRANSLATE_NOOP("QKnxDatapointType", "degree Celsius"))
+CREATE_CLASS_DECLARATION(QKnxTemperatureKelvin, 0x02, -670760.f, 670760.f, 1.,
+    QT_TRANSLATE_NOOP("QKnxDatapointType", "degree Kelvin"))
+CREATE_CLASS_DECLARATION(QKnxTemperatureChange, 0x03, -670760.f, 670760.f, 1.,
+    QT_TRANSLATE_NOOP("QKnxDatapointType", "Lux"))
+CREATE_CLASS_DECLARATION(QKnxValueLux, 0x04, 0.f, 670760.f, 1.,
+    QT_TRANSLATE_NOOP("QKnxDatapointType", "Lux"))
+CREATE_CLASS_DECLARATION(QKnxWindSpeed, 0x05, 0.f, 670760.f, 1.,
+    QT_TRANSLATE_NOOP("QKnxDatapointType", "m/s"))
+CREATE_CLASS_DECLARATION(QKnxPressure, 0x06, 0.f, 670760.f, 1.,
+    QT_TRANSLATE_NOOP("QKnxDatapointType", "Pa"))
+CREATE_CLASS_DECLARATION(QKnxHumidity, 0x07, 0.f, 670760.f, 1.,
+    QT_TRANSLATE_NOOP("QKnxDatapointType", "Percent"))
+CREATE_CLASS_DECLARATION(QKnxAirQuality, 0x08, 0.f, 670760.f, 1.,
+    QT_TRANSLATE_NOOP("QKnxDatapointType", "ppm"))
+CREATE_CLASS_DECLARATION(QKnxAirFlow, 0x09, -670760.f, 670760.f, 1.,
+    QT_TRANSLATE_NOOP("QKnxDatapointType", "m3/h"))
+CREATE_CLASS_DECLARATION(QKnxTimeSecond, 0x0a, -670760.f, 670760.f, 1.,
+    QT_TRANSLATE_NOOP("QKnxDatapointType", "s"))
+CREATE_CLASS_DECLARATION(QKnxTimeMilliSecond, 0x0b, -670760.f, 670760.f, 1.,
+    QT_TRANSLATE_NOOP("QKnxDatapointType", "ms"))
+CREATE_CLASS_DECLARATION(QKnxVoltage, 0x14, -670760.f, 670760.f, 1.,
+    QT_TRANSLATE_NOOP("QKnxDatapointType", "mV"))
+CREATE_CLASS_DECLARATION(QKnxCurrent, 0x15, -670760.f, 670760.f, 1.,
+    QT_TRANSLATE_NOOP("QKnxDatapointType", "mA"))
+CREATE_CLASS_DECLARATION(QKnxPowerDensity, 0x16, -670760.f, 670760.f, 1.,
+    QT_TRANSLATE_NOOP("QKnxDatapointType", "W/m2"))
+CREATE_CLASS_DECLARATION(QKnxKelvinPerPercent, 0x17, -670760.f, 670760.f, 1.,
+    QT_TRANSLATE_NOOP("QKnxDatapointType", "K/Percent"))
+CREATE_CLASS_DECLARATION(QKnxPower, 0x18, -670760.f, 670760.f, 1.,
+    QT_TRANSLATE_NOOP("QKnxDatapointType", "kW"))
+CREATE_CLASS_DECLARATION(QKnxVolumeFlow, 0x19, -670760.f, 670760.f, 1.,
+    QT_TRANSLATE_NOOP("QKnxDatapointType", "l/h"))
+CREATE_CLASS_DECLARATION(QKnxAmountRain, 0x1a, -671088.64f, 670760.96f, 1.,
+    QT_TRANSLATE_NOOP("QKnxDatapointType", "l/m2"))
+CREATE_CLASS_DECLARATION(QKnxTemperatureFahrenheit, 0x1b, -459.6f, 670760.96f, 1.,
+    QT_TRANSLATE_NOOP("QKnxDatapointType", "degree F"))
+CREATE_CLASS_DECLARATION(QKnxWindSpeedKmPerHour, 0x1c, 0.f, 670760.96f, 1.,
+    QT_TRANSLATE_NOOP("QKnxDatapointType", "km/h"))
+CREATE_CLASS_DECLARATION(QKnxValueAbsoluteHumidity, 0x1d, 0.f, 670760.96f, 1.,
+    QT_TRANSLATE_NOOP("QKnxDatapointType", "g/m3"))
+CREATE_CLASS_DECLARATION(QKnxConcentration, 0x1e, 0.f, 670760.96f, 1.,
+    QT_TRANSLATE_NOOP("QKnxDatapointType", "micro-g/m3"))
 
 #undef CREATE_CLASS_DECLARATION
 
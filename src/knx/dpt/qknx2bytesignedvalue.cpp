@@ -90,9 +90,11 @@ QKnx2ByteSignedValue::QKnx2ByteSignedValue(double value)
 QKnx2ByteSignedValue::QKnx2ByteSignedValue(int subType, double value)
     : QKnxFixedSizeDatapointType(MainType, subType, TypeSize)
 {
-    setDescription(tr("2-byte signed value"));
-    setRangeText(tr("Minimum Value, -32 768"), tr("Maximum Value, 32 767"));
-    setRange(QVariant::fromValue(-32768), QVariant::fromValue(32767));
+    QKnxDatapointTypePrivate::setupMetaData(this, [this]() {
+        setDescription(tr("2-byte signed value"));
+        setRangeText(tr("Minimum Value, -32 768"), tr("Maximum Value, 32 767"));
+        QKnxDatapointTypePrivate::setRange(this, descriptor());
+    });
 
     setValue(value);
 }
@@ -126,16 +128,17 @@ bool QKnx2ByteSignedValue::isValid() const
         && value() >= minimum().toDouble() && value() <= maximum().toDouble();
 }
 
-#define CREATE_CLASS_BODY(CLASS, DESCRIPTION, RANGE_TEXT_MINIMUM, RANGE_TEXT_MAXIMUM, UNIT, \
-    RANGE_VALUE_MINIMUM, RANGE_VALUE_MAXIMUM, COEFFICIENT) \
+#define CREATE_CLASS_BODY(CLASS, DESCRIPTION, RANGE_TEXT_MINIMUM, RANGE_TEXT_MAXIMUM) \
 CLASS::CLASS() \
     : QKnx2ByteSignedValue(SubType, 0.0) \
 { \
-    setUnit(tr(UNIT)); \
-    setCoefficient(COEFFICIENT); \
-    setDescription(tr(DESCRIPTION)); \
-    setRangeText(tr(RANGE_TEXT_MINIMUM), tr(RANGE_TEXT_MAXIMUM)); \
-    setRange(QVariant::fromValue(RANGE_VALUE_MINIMUM), QVariant::fromValue(RANGE_VALUE_MAXIMUM)); \
+    QKnxDatapointTypePrivate::setupMetaData(this, [this]() { \
+        setUnit(tr(descriptor().unit)); \
+        setCoefficient(descriptor().coefficient); \
+        setDescription(tr(DESCRIPTION)); \
+        setRangeText(tr(RANGE_TEXT_MINIMUM), tr(RANGE_TEXT_MAXIMUM)); \
+        QKnxDatapointTypePrivate::setRange(this, descriptor()); \
+    }); \
 } \
 CLASS::CLASS(double value) \
     : CLASS() \
@@ -144,24 +147,23 @@ CLASS::CLASS(double value) \
 }
 
 CREATE_CLASS_BODY(QKnxValue2Count, "Pulses difference",
-    "Minimum Value, -32 768", "Maximum Value, 32 767","pulse", -32768, 32767, 1.)
+    "Minimum Value, -32 768", "Maximum Value, 32 767")
 CREATE_CLASS_BODY(QKnxPercentV16, "Percentage difference",
-    "Minimum Value, -327,68", "Maximum Value, 327,67", "percent", -327.68, 327.67,
-    327.67/32767)
+    "Minimum Value, -327,68", "Maximum Value, 327,67")
 CREATE_CLASS_BODY(QKnxDeltaTimeMsec, "Time lag (ms)",
-    "Minimum Value, -32 768", "Maximum Value, 32 767", "ms", -32768, 32767, 1.)
+    "Minimum Value, -32 768", "Maximum Value, 32 767")
 CREATE_CLASS_BODY(QKnxDeltaTime10Msec, "Time lag (10 ms)",
-    "Minimum Value, -32 7680", "Maximum Value, 32 7670", "ms", -327680, 327670, 327670/32767.)
+    "Minimum Value, -32 7680", "Maximum Value, 32 7670")
 CREATE_CLASS_BODY(QKnxDeltaTime100Msec, "Time lag (100 ms)",
-    "Minimum Value, -32 76800", "Maximum Value, 32 76700", "ms", -3276800, 3276700, 3276700/32767.)
+    "Minimum Value, -32 76800", "Maximum Value, 32 76700")
 CREATE_CLASS_BODY(QKnxDeltaTimeSec, "Time lag (s)",
-    "Minimum Value, -32 768", "Maximum Value, 32 767", "s", -32768, 32767, 1.)
+    "Minimum Value, -32 768", "Maximum Value, 32 767")
 CREATE_CLASS_BODY(QKnxDeltaTimeMin, "Time lag (min)",
-    "Minimum Value, -32 768", "Maximum Value, 32 767", "min", -32768, 32767, 1.)
+    "Minimum Value, -32 768", "Maximum Value, 32 767")
 CREATE_CLASS_BODY(QKnxDeltaTimeHrs, "Time lag (hrs)",
-    "Minimum Value, -32 768", "Maximum Value, 32 767", "hrs", -32768, 32767, 1.)
+    "Minimum Value, -32 768", "Maximum Value, 32 767")
 CREATE_CLASS_BODY(QKnxRotationAngle, "Rotation angle (degree)",
-    "Minimum Value, -32 768", "Maximum Value, 32 767", "degree", -32768, 32767, 1.)
+    "Minimum Value, -32 768", "Maximum Value, 32 767")
 
 #undef CREATE_CLASS_BODY
 
@@ -31,6 +31,7 @@
 #define QKNX2BYTESIGNEDVALUE_H
 
 #include <QtKnx/qknxdatapointtype.h>
+#include <QtKnx/qknxdatapointtypedescriptor.h>
 #include <QtKnx/qtknxglobal.h>
 
 QT_BEGIN_NAMESPACE
@@ -44,6 +45,11 @@ public:
     static const constexpr int TypeSize = 0x02;
     static const constexpr int MainType = 0x08;
 
+    static constexpr QKnxDatapointTypeDescriptor<double> descriptor()
+    {
+        return { MainType, 0, TypeSize, -32768, 32767, 1., "" };
+    }
+
     double value() const;
     bool setValue(double value);
 
@@ -53,24 +59,38 @@ protected:
     QKnx2ByteSignedValue(int subType, double value);
 };
 
-#define CREATE_CLASS_DECLARATION(CLASS, SUB_TYPE) \
+#define CREATE_CLASS_DECLARATION(CLASS, SUB_TYPE, MINIMUM, MAXIMUM, COEFFICIENT, UNIT) \
 class Q_KNX_EXPORT CLASS : public QKnx2ByteSignedValue \
 { \
 public: \
     CLASS(); \
     explicit CLASS(double value); \
     static const constexpr int SubType = SUB_TYPE; \
+\
+    static constexpr QKnxDatapointTypeDescriptor<double> descriptor() \
+    { \
+        return { MainType, SubType, TypeSize, MINIMUM, MAXIMUM, COEFFICIENT, UNIT }; \
+    } \
 };
 
-CREATE_CLASS_DECLARATION(QKnxValue2Count, 0x01)
-CREATE_CLASS_DECLARATION(QKnxPercentV16, 0x0a)
-CREATE_CLASS_DECLARATION(QKnxDeltaTimeMsec, 0x02)
-CREATE_CLASS_DECLARATION(QKnxDeltaTime10Msec, 0x03)
-CREATE_CLASS_DECLARATION(QKnxDeltaTime100Msec, 0x04)
-CREATE_CLASS_DECLARATION(QKnxDeltaTimeSec, 0x05)
-CREATE_CLASS_DECLARATION(QKnxDeltaTimeMin, 0x06)
-CREATE_CLASS_DECLARATION(QKnxDeltaTimeHrs, 0x07)
-CREATE_CLASS_DECLARATION(QKnxRotationAngle, 0x0b)
+CREATE_CLASS_DECLARATION(QKnxValue2Count, 0x01, -32768, 32767, 1.,
+    QT_TRANSLATE_NOOP("QKnxDatapointType", "pulse"))
+CREATE_CLASS_DECLARATION(QKnxPercentV16, 0x0a, -327.68, 327.67, 327.67/32767,
+    QT_TRANSLATE_NOOP("QKnxDatapointType", "percent"))
+CREATE_CLASS_DECLARATION(QKnxDeltaTimeMsec, 0x02, -32768, 32767, 1.,
+    QT_TRANSLATE_NOOP("QKnxDatapointType", "ms"))
+CREATE_CLASS_DECLARATION(QKnxDeltaTime10Msec, 0x03, -327680, 327670, 327670/32767.,
+    QT_TRANSLATE_NOOP("QKnxDatapointType", "ms"))
+CREATE_CLASS_DECLARATION(QKnxDeltaTime100Msec, 0x04, -3276800, 3276700, 3276700/32767.,
+    QT_TRANSLATE_NOOP("QKnxDatapointType", "ms"))
+CREATE_CLASS_DECLARATION(QKnxDeltaTimeSec, 0x05, -32768, 32767, 1.,
+    QT_TRANSLATE_NOOP("QKnxDatapointType", "s"))
+CREATE_CLASS_DECLARATION(QKnxDeltaTimeMin, 0x06, -32768, 32767, 1.,
+    QT_TRANSLATE_NOOP("QKnxDatapointType", "min"))
+CREATE_CLASS_DECLARATION(QKnxDeltaTimeHrs, 0x07, -32768, 32767, 1.,
+    QT_TRANSLATE_NOOP("QKnxDatapointType", "hrs"))
+CREATE_CLASS_DECLARATION(QKnxRotationAngle, 0x0b, -32768, 32767, 1.,
+    QT_TRANSLATE_NOOP("QKnxDatapointType", "degree"))
 
 #undef CREATE_CLASS_DECLARATION
 
@@ -97,9 +97,11 @@ QKnx2ByteUnsignedValue::QKnx2ByteUnsignedValue(quint32 value)
 QKnx2ByteUnsignedValue::QKnx2ByteUnsignedValue(int subType, quint32 value)
     : QKnxFixedSizeDatapointType(MainType, subType, TypeSize)
 {
-    setDescription(tr("2-byte unsigned value"));
-    setRange(QVariant(0x0000), QVariant(0xffff));
-    setRangeText(tr("0"), tr("65535"));
+    QKnxDatapointTypePrivate::setupMetaData(this, [this]() {
+        setDescription(tr("2-byte unsigned value"));
+        QKnxDatapointTypePrivate::setRange(this, descriptor());
+        setRangeText(tr("0"), tr("65535"));
+    });
     setValue(value);
 }
 
@@ -132,16 +134,17 @@ bool QKnx2ByteUnsignedValue::isValid() const
         && value() >= minimum().toUInt() && value() <= maximum().toUInt();
 }
 
-#define CREATE_CLASS_BODY(CLASS, DESCRIPTION, RANGE_TEXT_MINIMUM, RANGE_TEXT_MAXIMUM, UNIT, \
-    RANGE_VALUE_MINIMUM, RANGE_VALUE_MAXIMUM, COEFFICIENT) \
+#define CREATE_CLASS_BODY(CLASS, DESCRIPTION, RANGE_TEXT_MINIMUM, RANGE_TEXT_MAXIMUM) \
 CLASS::CLASS() \
     : QKnx2ByteUnsignedValue(SubType, 0) \
 { \
-    setUnit(tr(UNIT)); \
-    setCoefficient(COEFFICIENT); \
-    setDescription(tr(DESCRIPTION)); \
-    setRangeText(tr(RANGE_TEXT_MINIMUM), tr(RANGE_TEXT_MAXIMUM)); \
-    setRange(QVariant::fromValue(RANGE_VALUE_MINIMUM), QVariant::fromValue(RANGE_VALUE_MAXIMUM)); \
+    QKnxDatapointTypePrivate::setupMetaData(this, [this]() { \
+        setUnit(tr(descriptor().unit)); \
+        setCoefficient(descriptor().coefficient); \
+        setDescription(tr(DESCRIPTION)); \
+        setRangeText(tr(RANGE_TEXT_MINIMUM), tr(RANGE_TEXT_MAXIMUM)); \
+        QKnxDatapointTypePrivate::setRange(this, descriptor()); \
+    }); \
 } \
 CLASS::CLASS(quint32 value) \
     : CLASS() \
@@ -149,29 +152,21 @@ CLASS::CLASS(quint32 value) \
     setValue(value); \
 }
 
-CREATE_CLASS_BODY(QKnxValue2Ucount, "Pulses",
-    "Minimum Value, 0", "Maximum Value, 65535", "pulse", 0, 65535, 1.)
+CREATE_CLASS_BODY(QKnxValue2Ucount, "Pulses", "Minimum Value, 0", "Maximum Value, 65535")
 CREATE_CLASS_BODY(QKnxPropDataType, "Property Data Type",
-    "Minimum Value, 0", "Maximum Value, 65535", "", 0, 65535, 1.)
-CREATE_CLASS_BODY(QKnxTimePeriodMsec, "Time (ms)",
-    "Minimum Value, 0", "Maximum Value, 65535", "ms", 0, 65535, 1.)
+    "Minimum Value, 0", "Maximum Value, 65535")
+CREATE_CLASS_BODY(QKnxTimePeriodMsec, "Time (ms)", "Minimum Value, 0", "Maximum Value, 65535")
 CREATE_CLASS_BODY(QKnxTimePeriod10Msec, "Time (multiple of 10ms)",
-    "Minimum Value, 0", "Maximum Value, 655350", "ms", 0, 655350, 655350/65535.)
+    "Minimum Value, 0", "Maximum Value, 655350")
 CREATE_CLASS_BODY(QKnxTimePeriod100Msec, "Time (multiple of 100ms)",
-    "Minimum Value, 0", "Maximum Value, 6553500", "ms", 0, 6553500, 6553500/65535.)
-CREATE_CLASS_BODY(QKnxTimePeriodSec, "Time (s)",
-    "Minimum Value, 0", "Maximum Value, 65535", "s", 0, 65535, 1.)
-CREATE_CLASS_BODY(QKnxTimePeriodMin, "Time (min)",
-    "Minimum Value, 0", "Maximum Value, 65535", "min", 0, 65535, 1.)
-CREATE_CLASS_BODY(QKnxTimePeriodHrs, "Time (h)",
-    "Minimum Value, 0", "Maximum Value, 65535", "h", 0, 65535, 1.)
-CREATE_CLASS_BODY(QKnxLengthMilliMeter, "Length (mm)",
-    "Minimum Value, 0", "Maximum Value, 65535", "mm", 0, 65535, 1.)
+    "Minimum Value, 0", "Maximum Value, 6553500")
+CREATE_CLASS_BODY(QKnxTimePeriodSec, "Time (s)", "Minimum Value, 0", "Maximum Value, 65535")
+CREATE_CLASS_BODY(QKnxTimePeriodMin, "Time (min)", "Minimum Value, 0", "Maximum Value, 65535")
+CREATE_CLASS_BODY(QKnxTimePeriodHrs, "Time (h)", "Minimum Value, 0", "Maximum Value, 65535")
+CREATE_CLASS_BODY(QKnxLengthMilliMeter, "Length (mm)", "Minimum Value, 0", "Maximum Value, 65535")
 CREATE_CLASS_BODY(QKnxUEICurrentMilliA, "Current (mA)",
-    "Minimum Value, 0 (no bus poser supply functionality available)", "Maximum Value, 65535", "mA",
-    0, 65535, 1.)
-CREATE_CLASS_BODY(QKnxBrightness, "Brightness (lux)",
-    "Minimum Value, 0", "Maximum Value, 65535", "lux", 0, 65535, 1.)
+    "Minimum Value, 0 (no bus poser supply functionality available)", "Maximum Value, 65535")
+CREATE_CLASS_BODY(QKnxBrightness, "Brightness (lux)", "Minimum Value, 0", "Maximum Value, 65535")
 
 #undef CREATE_CLASS_BODY
 
@@ -31,6 +31,7 @@
 #define QKNX2BYTEUNSIGNEDVALUE_H
 
 #include <QtKnx/qknxdatapointtype.h>
+#include <QtKnx/qknxdatapointtypedescriptor.h>
 #include <QtKnx/qtknxglobal.h>
 
 QT_BEGIN_NAMESPACE
@@ -44,6 +45,11 @@ public:
     static const constexpr int TypeSize = 0x02;
     static const constexpr int MainType = 0x07;
 
+    static constexpr QKnxDatapointTypeDescriptor<quint32> descriptor()
+    {
+        return { MainType, 0, TypeSize, 0, 65535, 1., "" };
+    }
+
     quint32 value() const;
     bool setValue(quint32 value);
 
@@ -54,26 +60,42 @@ protected:
 };
 
 
-#define CREATE_CLASS_DECLARATION(CLASS, SUB_TYPE) \
+#define CREATE_CLASS_DECLARATION(CLASS, SUB_TYPE, MINIMUM, MAXIMUM, COEFFICIENT, UNIT) \
 class Q_KNX_EXPORT CLASS : public QKnx2ByteUnsignedValue \
 { \
 public: \
     CLASS(); \
     explicit CLASS(quint32 value); \
     static const constexpr int SubType = SUB_TYPE; \
+\
+    static constexpr QKnxDatapointTypeDescriptor<quint32> descriptor() \
+    { \
+        return { MainType, SubType, TypeSize, MINIMUM, MAXIMUM, COEFFICIENT, UNIT }; \
+    } \
 };
 
-CREATE_CLASS_DECLARATION(QKnxValue2Ucount, 0x01)
-CREATE_CLASS_DECLARATION(QKnxPropDataType, 0x0a)
-CREATE_CLASS_DECLARATION(QKnxTimePeriodMsec, 0x02)
-CREATE_CLASS_DECLARATION(QKnxTimePeriod10Msec, 0x03)
-CREATE_CLASS_DECLARATION(QKnxTimePeriod100Msec, 0x04)
-CREATE_CLASS_DECLARATION(QKnxTimePeriodSec, 0x05)
-CREATE_CLASS_DECLARATION(QKnxTimePeriodMin, 0x06)
-CREATE_CLASS_DECLARATION(QKnxTimePeriodHrs, 0x07)
-CREATE_CLASS_DECLARATION(QKnxLengthMilliMeter, 0x0b)
-CREATE_CLASS_DECLARATION(QKnxUEICurrentMilliA, 0x0c)
-CREATE_CLASS_DECLARATION(QKnxBrightness, 0x0d)
+CREATE_CLASS_DECLARATION(QKnxValue2Ucount, 0x01, 0, 65535, 1.,
+    QT_TRANSLATE_NOOP("QKnxDatapointType", "pulse"))
+CREATE_CLASS_DECLARATION(QKnxPropDataType, 0x0a, 0, 65535, 1.,
+    QT_TRANSLATE_NOOP("QKnxDatapointType", ""))
+CREATE_CLASS_DECLARATION(QKnxTimePeriodMsec, 0x02, 0, 65535, 1.,
+    QT_TRANSLATE_NOOP("QKnxDatapointType", "ms"))
+CREATE_CLASS_DECLARATION(QKnxTimePeriod10Msec, 0x03, 0, 655350, 655350/65535.,
+    QT_TRANSLATE_NOOP("QKnxDatapointType", "ms"))
+CREATE_CLASS_DECLARATION(QKnxTimePeriod100Msec, 0x04, 0, 6553500, 6553500/65535.,
+    QT_TRANSLATE_NOOP("QKnxDatapointType", "ms"))
+CREATE_CLASS_DECLARATION(QKnxTimePeriodSec, 0x05, 0, 65535, 1.,
+    QT_TRANSLATE_NOOP("QKnxDatapointType", "s"))
+CREATE_CLASS_DECLARATION(QKnxTimePeriodMin, 0x06, 0, 65535, 1.,
+    QT_TRANSLATE_NOOP("QKnxDatapointType", "min"))
+CREATE_CLASS_DECLARATION(QKnxTimePeriodHrs, 0x07, 0, 65535, 1.,
+    QT_TRANSLATE_NOOP("QKnxDatapointType", "h"))
+CREATE_CLASS_DECLARATION(QKnxLengthMilliMeter, 0x0b, 0, 65535, 1.,
+    QT_TRANSLATE_NOOP("QKnxDatapointType", "mm"))
+CREATE_CLASS_DECLARATION(QKnxUEICurrentMilliA, 0x0c, 0, 65535, 1.,
+    QT_TRANSLATE_NOOP("QKnxDatapointType", "mA"))
+CREATE_CLASS_DECLARATION(QKnxBrightness, 0x0d, 0, 65535, 1.,
+    QT_TRANSLATE_NOOP("QKnxDatapointType", "lux"))
 
 #undef CREATE_CLASS_DECLARATION
 
@@ -74,9 +74,11 @@ QKnx32BitSet::QKnx32BitSet(quint32 value)
 QKnx32BitSet::QKnx32BitSet(int subType, quint32 value)
     : QKnxFixedSizeDatapointType(MainType, subType, TypeSize)
 {
-    setDescription(tr("32-bit set"));
-    setRange(QVariant(0x00), QVariant(0xffffffff));
-    setRangeText(tr("No bits set"), tr("All bits set"));
+    QKnxDatapointTypePrivate::setupMetaData(this, [this]() {
+        setDescription(tr("32-bit set"));
+        setRange(QVariant(0x00), QVariant(0xffffffff));
+        setRangeText(tr("No bits set"), tr("All bits set"));
+    });
     setValue(value);
 }
 
@@ -187,7 +189,9 @@ QKnxCombinedInfoOnOff::QKnxCombinedInfoOnOff()
 QKnxCombinedInfoOnOff::QKnxCombinedInfoOnOff(const QList<OutputInfo> &infos)
     : QKnx32BitSet(SubType, 0)
 {
-    setDescription(tr("Bit-combined info On/Off"));
+    QKnxDatapointTypePrivate::setupMetaData(this, [this]() {
+        setDescription(tr("Bit-combined info On/Off"));
+    });
 
     for (const auto &info : qAsConst(infos))
         setValue(info.Output, info.OutputState, info.OutputValidity);
@@ -93,9 +93,11 @@ QKnx3BitControlled::QKnx3BitControlled(bool control, NumberOfIntervals n)
 QKnx3BitControlled::QKnx3BitControlled(int subType, bool control, NumberOfIntervals n)
     : QKnxFixedSizeDatapointType(MainType, subType, TypeSize)
 {
-    setDescription(tr("3-bit controlled"));
-    setRange(QVariant(0x00), QVariant(0x0f));
-    setRangeText(tr("No control, Break"), tr("Controlled, 32 intervals"));
+    QKnxDatapointTypePrivate::setupMetaData(this, [this]() {
+        setDescription(tr("3-bit controlled"));
+        setRange(QVariant(0x00), QVariant(0x0f));
+        setRangeText(tr("No control, Break"), tr("Controlled, 32 intervals"));
+    });
 
     setControlBit(control);
     setNumberOfIntervals(n);
@@ -195,8 +197,10 @@ QKnxControlDimming::QKnxControlDimming()
 QKnxControlDimming::QKnxControlDimming(Control control, NumberOfIntervals interval)
     : QKnx3BitControlled(SubType, bool(control), interval)
 {
-    setDescription(tr("Control Dimming"));
-    setRangeText(tr("Decrease, Break"), tr("Increase, 32 intervals"));
+    QKnxDatapointTypePrivate::setupMetaData(this, [this]() {
+        setDescription(tr("Control Dimming"));
+        setRangeText(tr("Decrease, Break"), tr("Increase, 32 intervals"));
+    });
 }
 
 /*!
@@ -259,8 +263,10 @@ QKnxControlBlinds::QKnxControlBlinds()
 QKnxControlBlinds::QKnxControlBlinds(Control control, NumberOfIntervals interval)
     : QKnx3BitControlled (SubType, bool(control), interval)
 {
-    setDescription(tr("Control Blinds"));
-    setRangeText(tr("Up, Break"), tr("Down, 32 intervals"));
+    QKnxDatapointTypePrivate::setupMetaData(this, [this]() {
+        setDescription(tr("Control Blinds"));
+        setRangeText(tr("Up, Break"), tr("Down, 32 intervals"));
+    });
 }
 
 /*!
@@ -86,9 +86,11 @@ QKnx4ByteSignedValue::QKnx4ByteSignedValue(qint32 value)
 QKnx4ByteSignedValue::QKnx4ByteSignedValue(int subType, qint32 value)
     : QKnxFixedSizeDatapointType(MainType, subType, TypeSize)
 {
-    setDescription(tr("4-byte signed value"));
-    setRange(QVariant::fromValue(INT_MIN), QVariant::fromValue(INT_MAX));
-    setRangeText(tr("Minimum Value, -2 147 483 648"), tr("Maximum Value, 2 147 483 647"));
+    QKnxDatapointTypePrivate::setupMetaData(this, [this]() {
+        setDescription(tr("4-byte signed value"));
+        setRange(QVariant::fromValue(INT_MIN), QVariant::fromValue(INT_MAX));
+        setRangeText(tr("Minimum Value, -2 147 483 648"), tr("Maximum Value, 2 147 483 647"));
+    });
 
     setValue(value);
 }
@@ -127,8 +129,10 @@ bool QKnx4ByteSignedValue::isValid() const
 CLASS::CLASS() \
     : QKnx4ByteSignedValue(SubType, 0) \
 { \
-    setUnit(tr(UNIT)); \
-    setDescription(tr(DESCRIPTION)); \
+    QKnxDatapointTypePrivate::setupMetaData(this, [this]() { \
+        setUnit(tr(UNIT)); \
+        setDescription(tr(DESCRIPTION)); \
+    }); \
 } \
 CLASS::CLASS(qint32 value) \
     : CLASS() \
@@ -72,9 +72,11 @@ QKnx4ByteUnsignedValue::QKnx4ByteUnsignedValue(quint32 value)
 QKnx4ByteUnsignedValue::QKnx4ByteUnsignedValue(int subType, quint32 value)
     : QKnxFixedSizeDatapointType(MainType, subType, TypeSize)
 {
-    setDescription(tr("4-byte unsigned value"));
-    setRangeText(tr("Minimum Value, 0"), tr("Maximum Value, 4 294 967 295"));
-    setRange(QVariant::fromValue(0), QVariant::fromValue(4294967295));
+    QKnxDatapointTypePrivate::setupMetaData(this, [this]() {
+        setDescription(tr("4-byte unsigned value"));
+        setRangeText(tr("Minimum Value, 0"), tr("Maximum Value, 4 294 967 295"));
+        setRange(QVariant::fromValue(0), QVariant::fromValue(4294967295));
+    });
     setValue(value);
 }
 
@@ -106,7 +108,9 @@ QKnxValue4UCount::QKnxValue4UCount()
 QKnxValue4UCount::QKnxValue4UCount(quint32 value)
     : QKnx4ByteUnsignedValue(SubType, value)
 {
-    setUnit(tr("counter pulses"));
+    QKnxDatapointTypePrivate::setupMetaData(this, [this]() {
+        setUnit(tr("counter pulses"));
+    });
 }
 
 /*!
@@ -74,9 +74,11 @@ QKnx8BitSet::QKnx8BitSet(quint8 value)
 QKnx8BitSet::QKnx8BitSet(int subType, quint8 value)
     : QKnxFixedSizeDatapointType(MainType, subType, TypeSize)
 {
-    setDescription(tr("8-bit set"));
-    setRange(QVariant(0x00), QVariant(0xff));
-    setRangeText(tr("No bits set"), tr("All bits set"));
+    QKnxDatapointTypePrivate::setupMetaData(this, [this]() {
+        setDescription(tr("8-bit set"));
+        setRange(QVariant(0x00), QVariant(0xff));
+        setRangeText(tr("No bits set"), tr("All bits set"));
+    });
 
     setByte(value);
 }
@@ -169,8 +171,10 @@ QKnxGeneralStatus::QKnxGeneralStatus()
 QKnxGeneralStatus::QKnxGeneralStatus(Attributes attributes)
     : QKnx8BitSet(SubType, 0)
 {
-    setDescription(tr("General Status"));
-    setRange(QVariant(0x00), QVariant(0x1f));
+    QKnxDatapointTypePrivate::setupMetaData(this, [this]() {
+        setDescription(tr("General Status"));
+        setRange(QVariant(0x00), QVariant(0x1f));
+    });
     setValue(attributes);
 }
 
@@ -275,8 +279,10 @@ QKnxDeviceControl::QKnxDeviceControl()
 QKnxDeviceControl::QKnxDeviceControl(Attributes attributes)
     : QKnx8BitSet(SubType, 0)
 {
-    setDescription(tr("Device Control"));
-    setRange(QVariant(0x00), QVariant(0x15));
+    QKnxDatapointTypePrivate::setupMetaData(this, [this]() {
+        setDescription(tr("Device Control"));
+        setRange(QVariant(0x00), QVariant(0x15));
+    });
     setValue(attributes);
 }
 
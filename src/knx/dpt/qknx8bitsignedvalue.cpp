@@ -78,9 +78,11 @@ QKnx8BitSignedValue::QKnx8BitSignedValue(qint8 value)
 QKnx8BitSignedValue::QKnx8BitSignedValue(int subType, qint8 value)
     : QKnxFixedSizeDatapointType(MainType, subType, TypeSize)
 {
-    setRangeText(tr("-128"), tr("127"));
-    setRange(QVariant(0x00), QVariant(0xff));
-    setDescription(tr("8-bit signed value"));
+    QKnxDatapointTypePrivate::setupMetaData(this, [this]() {
+        setRangeText(tr("-128"), tr("127"));
+        QKnxDatapointTypePrivate::setRange(this, descriptor());
+        setDescription(tr("8-bit signed value"));
+    });
 
     setValue(value);
 }
@@ -101,15 +103,16 @@ void QKnx8BitSignedValue::setValue(qint8 value)
     QKnxDatapointType::setByte(0, quint8(value));
 }
 
-#define CREATE_CLASS_BODY(CLASS, DESCRIPTION, RANGE_TEXT_MINIMUM, RANGE_TEXT_MAXIMUM, UNIT, \
-    RANGE_VALUE_MINIMUM, RANGE_VALUE_MAXIMUM) \
+#define CREATE_CLASS_BODY(CLASS, DESCRIPTION, RANGE_TEXT_MINIMUM, RANGE_TEXT_MAXIMUM) \
 CLASS::CLASS() \
     : QKnx8BitSignedValue(SubType, 0) \
 { \
-    setUnit(tr(UNIT)); \
-    setDescription(tr(DESCRIPTION)); \
-    setRangeText(tr(RANGE_TEXT_MINIMUM), tr(RANGE_TEXT_MAXIMUM)); \
-    setRange(QVariant::fromValue(RANGE_VALUE_MINIMUM), QVariant::fromValue(RANGE_VALUE_MAXIMUM)); \
+    QKnxDatapointTypePrivate::setupMetaData(this, [this]() { \
+        setUnit(tr(descriptor().unit)); \
+        setDescription(tr(DESCRIPTION)); \
+        setRangeText(tr(RANGE_TEXT_MINIMUM), tr(RANGE_TEXT_MAXIMUM)); \
+        QKnxDatapointTypePrivate::setRange(this, descriptor()); \
+    }); \
 } \
 CLASS::CLASS(qint8 value) \
     : CLASS() \
@@ -118,9 +121,9 @@ CLASS::CLASS(qint8 value) \
 }
 
 CREATE_CLASS_BODY(QKnxPercentV8, "Percentage (-128% ... 127%)",
-    "Minimum Value, -128", "Maximum Value, 127", "%", 0x00, 0xff)
+    "Minimum Value, -128", "Maximum Value, 127")
 CREATE_CLASS_BODY(QKnxValue1Count, "Counter pulses (-128 ... 127)",
-    "Minimum Value, -128", "Maximum Value, 127", "counter pulses", 0x00, 0xff)
+    "Minimum Value, -128", "Maximum Value, 127")
 
 #undef CREATE_CLASS_BODY
 
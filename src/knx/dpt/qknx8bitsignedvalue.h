@@ -31,6 +31,7 @@
 #define QKNX8BITSIGNEDVALUE_H
 
 #include <QtKnx/qknxdatapointtype.h>
+#include <QtKnx/qknxdatapointtypedescriptor.h>
 #include <QtKnx/qtknxglobal.h>
 
 QT_BEGIN_NAMESPACE
@@ -44,6 +45,11 @@ public:
     static const constexpr int TypeSize = 0x01;
     static const constexpr int MainType = 0x06;
 
+    static constexpr QKnxDatapointTypeDescriptor<qint8> descriptor()
+    {
+        return { MainType, 0, TypeSize, -128, 127, 1., "" };
+    }
+
     qint8 value() const;
     void setValue(qint8 value);
 
@@ -51,17 +57,24 @@ protected:
     QKnx8BitSignedValue(int subType, qint8 value);
 };
 
-#define CREATE_CLASS_DECLARATION(CLASS, SUB_TYPE) \
+#define CREATE_CLASS_DECLARATION(CLASS, SUB_TYPE, MINIMUM, MAXIMUM, COEFFICIENT, UNIT) \
 class Q_KNX_EXPORT CLASS : public QKnx8BitSignedValue \
 { \
 public: \
     CLASS(); \
     explicit CLASS(qint8 value); \
     static const constexpr int SubType = SUB_TYPE; \
+\
+    static constexpr QKnxDatapointTypeDescriptor<qint8> descriptor() \
+    { \
+        return { MainType, SubType, TypeSize, MINIMUM, MAXIMUM, COEFFICIENT, UNIT }; \
+    } \
 };
 
-CREATE_CLASS_DECLARATION(QKnxPercentV8, 0x01)
-CREATE_CLASS_DECLARATION(QKnxValue1Count, 0x0a)
+CREATE_CLASS_DECLARATION(QKnxPercentV8, 0x01, -128, 127, 1.,
+    QT_TRANSLATE_NOOP("QKnxDatapointType", "%"))
+CREATE_CLASS_DECLARATION(QKnxValue1Count, 0x0a, -128, 127, 1.,
+    QT_TRANSLATE_NOOP("QKnxDatapointType", "counter pulses"))
 
 #undef CREATE_CLASS_DECLARATION
 
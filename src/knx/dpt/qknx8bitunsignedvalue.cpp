@@ -29,6 +29,7 @@
 
 #include "qknx8bitunsignedvalue.h"
 #include "qknxdatapointtype_p.h"
+#include "qknxdatapointtypecodec.h"
 
 QT_BEGIN_NAMESPACE
 
@@ -82,9 +83,11 @@ QKnx8BitUnsignedValue::QKnx8BitUnsignedValue(double value)
 QKnx8BitUnsignedValue::QKnx8BitUnsignedValue(int subType, double value)
     : QKnxFixedSizeDatapointType(MainType, subType, TypeSize)
 {
-    setDescription(tr("8-bit unsigned value"));
-    setRange(QVariant(0x00), QVariant(0xff));
-    setRangeText(tr("0"), tr("255"));
+    QKnxDatapointTypePrivate::setupMetaData(this, [this]() {
+        setDescription(tr("8-bit unsigned value"));
+        QKnxDatapointTypePrivate::setRange(this, descriptor());
+        setRangeText(tr("0"), tr("255"));
+    });
 
     setValue(value);
 }
@@ -96,7 +99,8 @@ double QKnx8BitUnsignedValue::value() const
 {
     if (!isValid())
         return -1;
-    return byte(0) * coefficient();
+    return QKnxDatapointTypeCodec::decode<QKnx8BitUnsignedValue>({ constData(), size() })
+        * coefficient();
 }
 
 /*!
@@ -120,16 +124,17 @@ bool QKnxTariff::isValid() const
     return QKnxDatapointType::isValid() && byte(0) < 255;
 }
 
-#define CREATE_CLASS_BODY(CLASS, DESCRIPTION, RANGE_TEXT_MINIMUM, RANGE_TEXT_MAXIMUM, UNIT, \
-    RANGE_VALUE_MINIMUM, RANGE_VALUE_MAXIMUM, COEFFICIENT) \
+#define CREATE_CLASS_BODY(CLASS, DESCRIPTION, RANGE_TEXT_MINIMUM, RANGE_TEXT_MAXIMUM) \
 CLASS::CLASS() \
     : QKnx8BitUnsignedValue(SubType, 0.0) \
 { \
-    setUnit(tr(UNIT)); \
-    setCoefficient(COEFFICIENT); \
-    setDescription(tr(DESCRIPTION)); \
-    setRangeText(tr(RANGE_TEXT_MINIMUM), tr(RANGE_TEXT_MAXIMUM)); \
-    setRange(QVariant::fromValue(RANGE_VALUE_MINIMUM), QVariant::fromValue(RANGE_VALUE_MAXIMUM)); \
+    QKnxDatapointTypePrivate::setupMetaData(this, [this]() { \
+        setUnit(tr(descriptor().unit)); \
+        setCoefficient(descriptor().coefficient); \
+        setDescription(tr(DESCRIPTION)); \
+        setRangeText(tr(RANGE_TEXT_MINIMUM), tr(RANGE_TEXT_MAXIMUM)); \
+        QKnxDatapointTypePrivate::setRange(this, descriptor()); \
+    }); \
 } \
 CLASS::CLASS(double value) \
     : CLASS() \
@@ -137,18 +142,12 @@ CLASS::CLASS(double value) \
     setValue(value); \
 }
 
-CREATE_CLASS_BODY(QKnxScaling, "Percentage (0..100%)",
-    "Minimum Value, 0", "Maximum Value, 100", "percent", 0, 100, 100 / 255.)
-CREATE_CLASS_BODY(QKnxAngle, "Angle (degrees)",
-    "Minimum Value, 0", "Maximum Value, 360", "degree", 0, 360, 360 / 255.)
-CREATE_CLASS_BODY(QKnxPercentU8, "Percentage (0..255%)",
-    "Minimum Value, 0", "Maximum Value, 255", "percent", 0, 255, 1)
-CREATE_CLASS_BODY(QKnxDecimalFactor, "Ratio (0...255)",
-    "Minimum Value, 0", "Maximum Value, 255", "", 0, 255, 1)
-CREATE_CLASS_BODY(QKnxValue1Ucount, "Counter Pulses",
-    "Minimum Value, 0", "Maximum Value, 255", "counter pulses", 0, 255, 1)
-CREATE_CLASS_BODY(QKnxTariff, "Tarif",
-    "Minimum Value, 0", "Maximum Value, 254", "", 0, 254, 1)
+CREATE_CLASS_BODY(QKnxScaling, "Percentage (0..100%)", "Minimum Value, 0", "Maximum Value, 100")
+CREATE_CLASS_BODY(QKnxAngle, "Angle (degrees)", "Minimum Value, 0", "Maximum Value, 360")
+CREATE_CLASS_BODY(QKnxPercentU8, "Percentage (0..255%)", "Minimum Value, 0", "Maximum Value, 255")
+CREATE_CLASS_BODY(QKnxDecimalFactor, "Ratio (0...255)", "Minimum Value, 0", "Maximum Value, 255")
+CREATE_CLASS_BODY(QKnxValue1Ucount, "Counter Pulses", "Minimum Value, 0", "Maximum Value, 255")
+CREATE_CLASS_BODY(QKnxTariff, "Tarif", "Minimum Value, 0", "Maximum Value, 254")
 
 #undef CREATE_CLASS_BODY
 
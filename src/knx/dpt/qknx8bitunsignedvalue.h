@@ -31,6 +31,7 @@
 #define QKNX8BITUNSIGNEDVALUE_H
 
 #include <QtKnx/qknxdatapointtype.h>
+#include <QtKnx/qknxdatapointtypedescriptor.h>
 #include <QtKnx/qtknxglobal.h>
 
 QT_BEGIN_NAMESPACE
@@ -44,6 +45,11 @@ public:
     static const constexpr int TypeSize = 0x01;
     static const constexpr int MainType = 0x05;
 
+    static constexpr QKnxDatapointTypeDescriptor<double> descriptor()
+    {
+        return { MainType, 0, TypeSize, 0, 255, 1., "" };
+    }
+
     double value() const;
     bool setValue(double value);
 
@@ -58,23 +64,38 @@ public:
     explicit QKnxTariff(double value);
     static const constexpr int SubType = 0x06;
 
+    static constexpr QKnxDatapointTypeDescriptor<double> descriptor()
+    {
+        return { MainType, SubType, TypeSize, 0, 254, 1., "" };
+    }
+
     bool isValid() const override;
 };
 
-#define CREATE_CLASS_DECLARATION(CLASS, SUB_TYPE) \
+#define CREATE_CLASS_DECLARATION(CLASS, SUB_TYPE, MINIMUM, MAXIMUM, COEFFICIENT, UNIT) \
 class Q_KNX_EXPORT CLASS : public QKnx8BitUnsignedValue \
 { \
 public: \
     CLASS(); \
     explicit CLASS(double value); \
     static const constexpr int SubType = SUB_TYPE; \
+\
+    static constexpr QKnxDatapointTypeDescriptor<double> descriptor() \
+    { \
+        return { MainType, SubType, TypeSize, MINIMUM, MAXIMUM, COEFFICIENT, UNIT }; \
+    } \
 };
 
-CREATE_CLASS_DECLARATION(QKnxScaling, 0x01)
-CREATE_CLASS_DECLARATION(QKnxAngle, 0x03)
-CREATE_CLASS_DECLARATION(QKnxPercentU8, 0x04)
-CREATE_CLASS_DECLARATION(QKnxDecimalFactor, 0x05)
-CREATE_CLASS_DECLARATION(QKnxValue1Ucount, 0x0a)
+CREATE_CLASS_DECLARATION(QKnxScaling, 0x01, 0, 100, 100 / 255.,
+    QT_TRANSLATE_NOOP("QKnxDatapointType", "percent"))
+CREATE_CLASS_DECLARATION(QKnxAngle, 0x03, 0, 360, 360 / 255.,
+    QT_TRANSLATE_NOOP("QKnxDatapointType", "degree"))
+CREATE_CLASS_DECLARATION(QKnxPercentU8, 0x04, 0, 255, 1,
+    QT_TRANSLATE_NOOP("QKnxDatapointType", "percent"))
+CREATE_CLASS_DECLARATION(QKnxDecimalFactor, 0x05, 0, 255, 1,
+    QT_TRANSLATE_NOOP("QKnxDatapointType", ""))
+CREATE_CLASS_DECLARATION(QKnxValue1Ucount, 0x0a, 0, 255, 1,
+    QT_TRANSLATE_NOOP("QKnxDatapointType", "counter pulses"))
 
 #undef CREATE_CLASS_DECLARATION
 
@@ -74,9 +74,11 @@ QKnxChar::QKnxChar(unsigned char value)
 QKnxChar::QKnxChar(int subType, unsigned char value)
     : QKnxFixedSizeDatapointType(MainType, subType, TypeSize)
 {
-    setDescription(tr("Character"));
-    setRange(QVariant(0x00), QVariant(0xff));
-    setRangeText(tr("0"), tr("255"));
+    QKnxDatapointTypePrivate::setupMetaData(this, [this]() {
+        setDescription(tr("Character"));
+        setRange(QVariant(0x00), QVariant(0xff));
+        setRangeText(tr("0"), tr("255"));
+    });
 
     setValue(value);
 }
@@ -131,8 +133,10 @@ bool QKnxChar::isValid() const
 QKnxCharASCII::QKnxCharASCII()
     : QKnxChar(SubType, 0)
 {
-    setDescription(tr("Character (ASCII)"));
-    setRange(QVariant(0x00), QVariant(0x7f));
+    QKnxDatapointTypePrivate::setupMetaData(this, [this]() {
+        setDescription(tr("Character (ASCII)"));
+        setRange(QVariant(0x00), QVariant(0x7f));
+    });
 }
 
 /*!
@@ -185,8 +189,10 @@ bool QKnxCharASCII::setCharacter(char value)
 QKnxChar88591::QKnxChar88591()
     : QKnxChar(SubType, 0)
 {
-    setDescription(tr("Character (ISO 8859-1)"));
-    setRange(QVariant(0x00), QVariant(0xff));
+    QKnxDatapointTypePrivate::setupMetaData(this, [this]() {
+        setDescription(tr("Character (ISO 8859-1)"));
+        setRange(QVariant(0x00), QVariant(0xff));
+    });
 }
 
 /*!
@@ -94,9 +94,11 @@ QKnxCharString::QKnxCharString(const char *string, int size)
 QKnxCharString::QKnxCharString(int subType, const char* string, int size)
     : QKnxFixedSizeDatapointType(MainType, subType, TypeSize)
 {
-    setDescription(tr("Fixed length character string"));
-    setRange(QVariant(0x00), QVariant(0xff));
-    setRangeText(tr("Minimum number of characters: 0"), tr("Maximum number of characters: 14"));
+    QKnxDatapointTypePrivate::setupMetaData(this, [this]() {
+        setDescription(tr("Fixed length character string"));
+        setRange(QVariant(0x00), QVariant(0xff));
+        setRangeText(tr("Minimum number of characters: 0"), tr("Maximum number of characters: 14"));
+    });
     setString(string, size);
 }
 
@@ -193,8 +195,10 @@ QKnxCharStringASCII::QKnxCharStringASCII(QLatin1String string)
 QKnxCharStringASCII::QKnxCharStringASCII(const char *string, int size)
     : QKnxCharString(SubType, nullptr, 0)
 {
-    setDescription(tr("Fixed length character string (ASCII)"));
-    setRange(QVariant(0x00), QVariant(0x7f));
+    QKnxDatapointTypePrivate::setupMetaData(this, [this]() {
+        setDescription(tr("Fixed length character string (ASCII)"));
+        setRange(QVariant(0x00), QVariant(0x7f));
+    });
     setString(string, size);
 }
 
@@ -240,7 +244,9 @@ QKnxCharString88591::QKnxCharString88591(QLatin1String string)
 QKnxCharString88591::QKnxCharString88591(const char *string, int size)
     : QKnxCharString(SubType, string, size)
 {
-    setDescription(tr("Fixed length character string (ISO 8859-1)"));
+    QKnxDatapointTypePrivate::setupMetaData(this, [this]() {
+        setDescription(tr("Fixed length character string (ISO 8859-1)"));
+    });
 }
 
 QT_END_NAMESPACE
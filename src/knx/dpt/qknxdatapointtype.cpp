@@ -689,20 +689,8 @@ QKnxDatapointType::~QKnxDatapointType()
 QKnxDatapointType::QKnxDatapointType(Type type, int size)
     : d_ptr(new QKnxDatapointTypePrivate)
 {
-    const auto num = QString::number(int(type));
-    if (num.size() < 6)
-        return;
-
-    bool okMain = false, okSub = false;
-    const auto number = QStringView{ num };
-
-    // Datapoint Type shall be identified by a 16 bit main number separated
-    // by a dot from a 16 bit sub number. The assumption being made is that
-    // QKnxDatapointType::Type is encoded in that way while omitting the dot.
-    quint16 mainType = number.left(number.size() - 5).toUShort(&okMain);
-    quint16 subType = number.right(5).toUShort(&okSub);
-
-    if (okMain && okSub)
+    quint16 mainType = 0, subType = 0;
+    if (QKnxDatapointTypePrivate::fromType(quint32(type), &mainType, &subType))
         d_ptr->setup(mainType, subType, quint32(type), size);
 }
 
@@ -712,7 +700,7 @@ QKnxDatapointType::QKnxDatapointType(Type type, int size)
 QKnxDatapointType::QKnxDatapointType(const QString &dptId, int size)
     : d_ptr(new QKnxDatapointTypePrivate)
 {
-    auto match = d_ptr->m_dpt.match(dptId);
+    auto match = QKnxDatapointTypePrivate::dptExpression().match(dptId);
     if (!match.hasMatch())
         return;
 
@@ -769,7 +757,7 @@ int QKnxDatapointType::mainType() const
 */
 QVariant QKnxDatapointType::minimum() const
 {
-    return d_ptr->m_minimum;
+    return d_ptr->m_metaData->m_minimum;
 }
 
 /*!
@@ -777,7 +765,7 @@ QVariant QKnxDatapointType::minimum() const
 */
 void QKnxDatapointType::setMinimum(const QVariant &minimum)
 {
-    d_ptr->m_minimum = minimum;
+    d_ptr->m_metaData->m_minimum = minimum;
 }
 
 /*!
@@ -785,7 +773,7 @@ void QKnxDatapointType::setMinimum(const QVariant &minimum)
 */
 QVariant QKnxDatapointType::maximum() const
 {
-    return d_ptr->m_maximum;
+    return d_ptr->m_metaData->m_maximum;
 }
 
 /*!
@@ -793,7 +781,7 @@ QVariant QKnxDatapointType::maximum() const
 */
 void QKnxDatapointType::setMaximum(const QVariant &maximum)
 {
-    d_ptr->m_maximum = maximum;
+    d_ptr->m_metaData->m_maximum = maximum;
 }
 
 /*!
@@ -801,7 +789,7 @@ void QKnxDatapointType::setMaximum(const QVariant &maximum)
 */
 double QKnxDatapointType::coefficient() const
 {
-    return d_ptr->m_coefficient;
+    return d_ptr->m_metaData->m_coefficient;
 }
 
 /*!
@@ -809,7 +797,7 @@ double QKnxDatapointType::coefficient() const
 */
 void QKnxDatapointType::setCoefficient(double coef)
 {
-    d_ptr->m_coefficient = coef;
+    d_ptr->m_metaData->m_coefficient = coef;
 }
 
 /*!
@@ -817,7 +805,7 @@ void QKnxDatapointType::setCoefficient(double coef)
 */
 QString QKnxDatapointType::minimumText() const
 {
-    return d_ptr->m_minimumText;
+    return d_ptr->m_metaData->m_minimumText;
 }
 
 /*!
@@ -826,7 +814,7 @@ QString QKnxDatapointType::minimumText() const
 */
 void QKnxDatapointType::setMinimumText(const QString &minimumText)
 {
-    d_ptr->m_minimumText = minimumText;
+    d_ptr->m_metaData->m_minimumText = minimumText;
 }
 
 /*!
@@ -834,7 +822,7 @@ void QKnxDatapointType::setMinimumText(const QString &minimumText)
 */
 QString QKnxDatapointType::maximumText() const
 {
-    return d_ptr->m_maximumText;
+    return d_ptr->m_metaData->m_maximumText;
 }
 
 /*!
@@ -843,7 +831,7 @@ QString QKnxDatapointType::maximumText() const
 */
 void QKnxDatapointType::setMaximumText(const QString &maximumText)
 {
-    d_ptr->m_maximumText = maximumText;
+    d_ptr->m_metaData->m_maximumText = maximumText;
 }
 
 /*!
@@ -852,8 +840,8 @@ void QKnxDatapointType::setMaximumText(const QString &maximumText)
 */
 void QKnxDatapointType::setRange(const QVariant &minimum, const QVariant &maximum)
 {
-    d_ptr->m_minimum = minimum;
-    d_ptr->m_maximum = maximum;
+    d_ptr->m_metaData->m_minimum = minimum;
+    d_ptr->m_metaData->m_maximum = maximum;
 }
 
 /*!
@@ -862,8 +850,8 @@ void QKnxDatapointType::setRange(const QVariant &minimum, const QVariant &maximu
 */
 void QKnxDatapointType::setRangeText(const QString &minimumText, const QString &maximumText)
 {
-    d_ptr->m_minimumText = minimumText;
-    d_ptr->m_maximumText = maximumText;
+    d_ptr->m_metaData->m_minimumText = minimumText;
+    d_ptr->m_metaData->m_maximumText = maximumText;
 }
 
 /*!
@@ -871,7 +859,7 @@ void QKnxDatapointType::setRangeText(const QString &minimumText, const QString &
 */
 QString QKnxDatapointType::unit() const
 {
-    return d_ptr->m_unit;
+    return d_ptr->m_metaData->m_unit;
 }
 
 /*!
@@ -879,7 +867,7 @@ QString QKnxDatapointType::unit() const
 */
 void QKnxDatapointType::setUnit(const QString &unit)
 {
-    d_ptr->m_unit = unit;
+    d_ptr->m_metaData->m_unit = unit;
 }
 
 /*!
@@ -887,7 +875,7 @@ void QKnxDatapointType::setUnit(const QString &unit)
 */
 QString QKnxDatapointType::description() const
 {
-    return d_ptr->m_descrition;
+    return d_ptr->m_metaData->m_descrition;
 }
 
 /*!
@@ -895,7 +883,7 @@ QString QKnxDatapointType::description() const
 */
 void QKnxDatapointType::setDescription(const QString &description)
 {
-    d_ptr->m_descrition = description;
+    d_ptr->m_metaData->m_descrition = description;
 }
 
 /*!
@@ -1015,13 +1003,8 @@ bool QKnxDatapointType::operator==(const QKnxDatapointType &other) const
         || (d_ptr->m_subType == other.d_ptr->m_subType
             && d_ptr->m_mainType == other.d_ptr->m_mainType
             && d_ptr->m_bytes == other.d_ptr->m_bytes
-            && d_ptr->m_unit == other.d_ptr->m_unit
-            && d_ptr->m_descrition == other.d_ptr->m_descrition
-            && d_ptr->m_minimum == other.d_ptr->m_minimum
-            && d_ptr->m_maximum == other.d_ptr->m_maximum
-            && d_ptr->m_coefficient == other.d_ptr->m_coefficient
-            && d_ptr->m_minimumText == other.d_ptr->m_minimumText
-            && d_ptr->m_maximumText == other.d_ptr->m_maximumText);
+            && (d_ptr->m_metaData == other.d_ptr->m_metaData
+                || *d_ptr->m_metaData == *other.d_ptr->m_metaData));
 }
 
 /*!
@@ -1040,8 +1023,7 @@ bool QKnxDatapointType::operator!=(const QKnxDatapointType &other) const
 */
 QKnxDatapointType::Type QKnxDatapointType::toType(const QString &dpt)
 {
-    QKnxDatapointTypePrivate dtp;
-    auto match = dtp.m_dpt.match(dpt);
+    auto match = QKnxDatapointTypePrivate::dptExpression().match(dpt);
     if (!match.hasMatch())
         return QKnxDatapointType::Type::Unknown;
 
@@ -1077,6 +1059,34 @@ QKnxDatapointType::QKnxDatapointType(QKnxDatapointTypePrivate &dd)
 {}
 
 
+// -- QKnxDatapointTypePrivate
+
+/*!
+    \internal
+*/
+QKnxDatapointTypePrivate::QKnxDatapointTypePrivate()
+{
+    static const QSharedDataPointer<QKnxDatapointTypeMetaData> defaultMetaData {
+        new QKnxDatapointTypeMetaData
+    };
+    m_metaData = defaultMetaData;
+}
+
+/*!
+    \internal
+
+    Returns the regular expression used to parse datapoint type identifiers of
+    the format \c DPT-* or \c DPST-*-*. The expression is compiled only once.
+*/
+const QRegularExpression &QKnxDatapointTypePrivate::dptExpression()
+{
+    static const QRegularExpression expression { QStringLiteral("^DPT-(?<MainOnly>\\d{1,5})$"
+        "|^(DPST-)?(?<MainType>\\d{1,5})(\\.|-)(?<SubType>\\d{1,5})$"),
+            QRegularExpression::CaseInsensitiveOption };
+    return expression;
+}
+
+
 // -- QKnxVariableSizeDatapointType
 
 /*!
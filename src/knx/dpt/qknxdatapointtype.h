@@ -238,6 +238,7 @@ private:
     explicit QKnxDatapointType(QKnxDatapointTypePrivate &dd);
 
 private:
+    friend struct QKnxDatapointTypePrivate;
     QSharedDataPointer<QKnxDatapointTypePrivate> d_ptr;
 };
 
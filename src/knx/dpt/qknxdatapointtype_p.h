@@ -45,39 +45,116 @@
 #include <QtCore/qshareddata.h>
 #include <QtCore/qvariant.h>
 #include <QtKnx/qknxbytearray.h>
+#include <QtKnx/qknxdatapointtype.h>
+#include <QtKnx/qknxdatapointtypedescriptor.h>
 #include <QtKnx/qtknxglobal.h>
 
+#include <limits>
+#include <type_traits>
+
 QT_BEGIN_NAMESPACE
 
+struct QKnxDatapointTypeMetaData : public QSharedData
+{
+    QString m_unit, m_descrition;
+    QVariant m_minimum, m_maximum;
+    double m_coefficient { 1 };
+    QString m_minimumText, m_maximumText;
+
+    bool operator==(const QKnxDatapointTypeMetaData &other) const
+    {
+        return m_unit == other.m_unit
+            && m_descrition == other.m_descrition
+            && m_minimum == other.m_minimum
+            && m_maximum == other.m_maximum
+            && m_coefficient == other.m_coefficient
+            && m_minimumText == other.m_minimumText
+            && m_maximumText == other.m_maximumText;
+    }
+    bool operator!=(const QKnxDatapointTypeMetaData &other) const
+    {
+        return !operator==(other);
+    }
+};
+
 struct Q_KNX_EXPORT QKnxDatapointTypePrivate : public QSharedData
 {
-    QKnxDatapointTypePrivate() = default;
+    QKnxDatapointTypePrivate();
     ~QKnxDatapointTypePrivate() = default;
 
     int m_subType { 0 };
     int m_mainType { 0 };
     quint32 m_type { 0 };
     QKnxByteArray m_bytes;
-    QString m_unit, m_descrition;
-    QVariant m_minimum, m_maximum;
-    double m_coefficient { 1 };
-    QString m_minimumText, m_maximumText;
-    const QRegularExpression m_dpt { QStringLiteral("^DPT-(?<MainOnly>\\d{1,5})$"
-        "|^(DPST-)?(?<MainType>\\d{1,5})(\\.|-)(?<SubType>\\d{1,5})$"),
-            QRegularExpression::CaseInsensitiveOption };
 
-    static bool toType(quint16 main, quint16 sub, quint32 *type) {
-        return toType(QString::number(main), QString::number(sub), type);
+    // Shared with every instance constructed the same way, the setters detach.
+    QSharedDataPointer<QKnxDatapointTypeMetaData> m_metaData;
+
+    // Datapoint type constructors set up the same metadata on every instance,
+    // so they pass their setter calls as setup. Each setup has its own type
+    // and therefore its own static, it runs once and the metadata it leaves
+    // behind is shared by all later instances. The setup must not depend on
+    // the constructor's arguments.
+    template <typename Setup> static void setupMetaData(QKnxDatapointType *dpt, Setup setup)
+    {
+        static const QSharedDataPointer<QKnxDatapointTypeMetaData> metaData = [&]() {
+            setup();
+            return dpt->d_ptr->m_metaData;
+        }();
+        dpt->d_ptr->m_metaData = metaData;
+    }
+
+    // Sets the range of dpt to the one of its descriptor. Values of integral types are stored as
+    // int, floating point values as int if they are whole numbers and as double otherwise, so the
+    // QVariant types match the ones minimum() and maximum() always returned.
+    template <typename T>
+    static void setRange(QKnxDatapointType *dpt, const QKnxDatapointTypeDescriptor<T> &descriptor)
+    {
+        dpt->setRange(rangeValue(descriptor.minimum), rangeValue(descriptor.maximum));
+    }
+    template <typename T> static QVariant rangeValue(T value)
+    {
+        if (std::is_integral<T>::value)
+            return QVariant(int(value));
+        const double number = double(value);
+        if (number >= std::numeric_limits<int>::min() && number <= std::numeric_limits<int>::max()
+            && number == double(int(number))) {
+            return QVariant(int(number));
+        }
+        return QVariant(number);
+    }
+
+    static const QRegularExpression &dptExpression();
+
+    // Datapoint Type shall be identified by a 16 bit main number separated by a dot from a
+    // 16 bit sub number. QKnxDatapointType::Type is encoded that way while omitting the dot,
+    // the sub number taking the five least significant decimal digits, e.g. 9.001 is 900001.
+    enum : quint32 { SubTypeFactor = 100000 };
+
+    static bool toType(quint32 main, quint32 sub, quint32 *type)
+    {
+        const quint64 value = quint64(main) * SubTypeFactor + sub;
+        if (sub >= SubTypeFactor || value > 0xffffffffull)
+            return false;
+        *type = quint32(value);
+        return true;
     }
     static bool toType(const QString &main, const QString &sub, quint32 *type)
     {
-        if (main.isEmpty() || sub.isEmpty())
+        bool okMain = false, okSub = false;
+        const auto mainType = main.toUInt(&okMain);
+        const auto subType = sub.toUInt(&okSub);
+        return okMain && okSub && toType(mainType, subType, type);
+    }
+    static bool fromType(quint32 type, quint16 *main, quint16 *sub)
+    {
+        const auto mainType = type / SubTypeFactor;
+        const auto subType = type % SubTypeFactor;
+        if (mainType == 0 || mainType > 0xffff || subType > 0xffff)
             return false;
-
-        bool ok = true;
-        *type = QString(main.rightJustified(5, QLatin1Char('0')) + sub
-            .rightJustified(5, QLatin1Char('0'))).toUInt(&ok);
-        return ok;
+        *main = quint16(mainType);
+        *sub = quint16(subType);
+        return true;
     }
     void setup(quint16 mainType, quint16 subType, quint32 type, int size)
     {
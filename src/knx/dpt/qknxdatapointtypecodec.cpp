@@ -0,0 +1,757 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtKnx module.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include "qknxdatapointtypecodec.h"
+#include "qknxdatapointtype_p.h"
+#include "qknxdatapointtypefactory.h"
+
+#include "qknxutils.h"
+
+#include <QtCore/qalgorithms.h>
+#include <QtCore/qhash.h>
+#include <QtCore/qmutex.h>
+#include <QtCore/qscopedpointer.h>
+#include <QtCore/private/qsimd_p.h>
+
+#include <cmath>
+#include <cstring>
+
+#if defined(__SSE2__)
+#  include <emmintrin.h>
+#endif
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QKnxDatapointTypeCodec
+    \inmodule QtKnx
+    \ingroup qtknx-datapoint-types
+    \since 6.2
+
+    \brief The QKnxDatapointTypeCodec class converts datapoint type values
+    from and to their KNX encoding without creating datapoint type objects.
+
+    Decoding a value through a \l QKnxDatapointType subclass requires a heap
+    allocated object per value. This class provides stateless functions that
+    work directly on the encoded bytes and are suitable for converting large
+    amounts of stored values at once.
+
+    The templated functions decode() and encode() are available for the
+    following main datapoint types:
+
+    \list
+        \li \c QKnx1Bit (\c bool)
+        \li \c QKnx8BitUnsignedValue (\c quint8)
+        \li \c QKnx8BitSignedValue (\c qint8)
+        \li \c QKnx2ByteUnsignedValue (\c quint16)
+        \li \c QKnx2ByteSignedValue (\c qint16)
+        \li \c QKnx2ByteFloat (\c float)
+        \li \c QKnx4ByteUnsignedValue (\c quint32)
+        \li \c QKnx4ByteSignedValue (\c qint32)
+        \li \c QKnx4ByteFloat (\c float)
+    \endlist
+
+    They work on the value as it is encoded and do not apply the coefficient
+    or the range of a specific sub type. The following example decodes the
+    temperature received with a group value write:
+
+    \code
+        bool ok = false;
+        float celsius = QKnxDatapointTypeCodec::decode<QKnx2ByteFloat>(tpdu.data(), &ok);
+    \endcode
+
+    The batch form of decode() converts a list of \l {QKnxDatapointTypeCodec::Sample}
+    {samples} of possibly different datapoint types into a column of numbers,
+    applying the coefficient of the sample's datapoint type.
+
+    \sa QKnxDatapointType, QKnxDatapointTypeFactory
+*/
+
+/*!
+    \class QKnxDatapointTypeCodec::Sample
+    \inmodule QtKnx
+    \since 6.2
+
+    \brief The Sample class holds the datapoint type and the encoded bytes of
+    a single value passed to the batch form of QKnxDatapointTypeCodec::decode().
+
+    The bytes are not copied, they need to stay valid until the decode call
+    returns.
+*/
+
+/*!
+    \variable QKnxDatapointTypeCodec::Sample::type
+
+    The datapoint type of the sample.
+*/
+
+/*!
+    \variable QKnxDatapointTypeCodec::Sample::bytes
+
+    The encoded value of the sample.
+*/
+
+/*!
+    \fn template <typename T> typename QKnxDatapointTypeCodec::Traits<T>::ValueType QKnxDatapointTypeCodec::decode(QKnxByteArrayView bytes, bool *ok)
+
+    Decodes the value encoded in \a bytes as the main datapoint type \c T. If
+    \a ok is not \c nullptr, it is set to \c true if \a bytes has the size of
+    the datapoint type and holds a valid encoding; otherwise it is set to
+    \c false.
+*/
+
+/*!
+    \fn template <typename T> bool QKnxDatapointTypeCodec::encode(typename QKnxDatapointTypeCodec::Traits<T>::ValueType value, quint8 *out)
+
+    Encodes \a value as the main datapoint type \c T into \a out, which must
+    provide room for the size of the datapoint type. Returns \c true on
+    success; \c false if the value cannot be represented by the datapoint type.
+*/
+
+namespace QKnxPrivate
+{
+    struct DatapointTypeCoefficients
+    {
+        QMutex mutex;
+        QHash<quint32, double> coefficients;
+    };
+}
+Q_GLOBAL_STATIC(QKnxPrivate::DatapointTypeCoefficients, qt_knxDatapointTypeCoefficients)
+
+namespace QKnxPrivate
+{
+    // Returns the coefficient set up by the datapoint type's constructor. The datapoint type
+    // is instantiated once per type, the result is kept for all subsequent lookups.
+    static double coefficient(QKnxDatapointType::Type type)
+    {
+        auto cache = qt_knxDatapointTypeCoefficients();
+        if (cache) {
+            QMutexLocker locker(&cache->mutex);
+            const auto it = cache->coefficients.constFind(quint32(type));
+            if (it != cache->coefficients.constEnd())
+                return it.value();
+        }
+
+        QScopedPointer<QKnxDatapointType> dpt(QKnxDatapointTypeFactory::instance()
+            .createType(type));
+        const double coefficient = dpt ? dpt->coefficient() : 1.;
+
+        if (cache) {
+            QMutexLocker locker(&cache->mutex);
+            cache->coefficients.insert(quint32(type), coefficient);
+        }
+        return coefficient;
+    }
+
+    struct SampleDecoder
+    {
+        // Decodes the integer or floating point value of a sample without applying the
+        // coefficient, sets isFloat for the floating point datapoint types.
+        bool decode(const QKnxDatapointTypeCodec::Sample &sample, qint64 *integer,
+            double *floating, bool *isFloat)
+        {
+            quint16 mainType = 0, subType = 0;
+            if (!QKnxDatapointTypePrivate::fromType(quint32(sample.type), &mainType, &subType))
+                return false;
+
+            bool ok = false;
+            *isFloat = false;
+            switch (mainType) {
+            case 1:
+                *integer = QKnxDatapointTypeCodec::decode<QKnx1Bit>(sample.bytes, &ok);
+                break;
+            case 5:
+                *integer = QKnxDatapointTypeCodec::decode<QKnx8BitUnsignedValue>(sample.bytes, &ok);
+                break;
+            case 6:
+                *integer = QKnxDatapointTypeCodec::decode<QKnx8BitSignedValue>(sample.bytes, &ok);
+                break;
+            case 7:
+                *integer = QKnxDatapointTypeCodec::decode<QKnx2ByteUnsignedValue>(sample.bytes,
+                    &ok);
+                break;
+            case 8:
+                *integer = QKnxDatapointTypeCodec::decode<QKnx2ByteSignedValue>(sample.bytes,
+                    &ok);
+                break;
+            case 9:
+                *floating = QKnxDatapointTypeCodec::decode<QKnx2ByteFloat>(sample.bytes, &ok);
+                *isFloat = true;
+                break;
+            case 12:
+                *integer = QKnxDatapointTypeCodec::decode<QKnx4ByteUnsignedValue>(sample.bytes,
+                    &ok);
+                break;
+            case 13:
+                *integer = QKnxDatapointTypeCodec::decode<QKnx4ByteSignedValue>(sample.bytes,
+                    &ok);
+                break;
+            case 14:
+                *floating = QKnxDatapointTypeCodec::decode<QKnx4ByteFloat>(sample.bytes, &ok);
+                *isFloat = true;
+                break;
+            default:
+                break;
+            }
+            return ok;
+        }
+
+        double coefficient(QKnxDatapointType::Type type)
+        {
+            // Consecutive samples usually share the type, avoid the shared lookup for those.
+            if (type != m_lastType) {
+                m_lastType = type;
+                m_lastCoefficient = QKnxPrivate::coefficient(type);
+            }
+            return m_lastCoefficient;
+        }
+
+    private:
+        QKnxDatapointType::Type m_lastType { QKnxDatapointType::Type::Unknown };
+        double m_lastCoefficient { 1. };
+    };
+
+    static bool hasCoefficient(QKnxDatapointType::Type type)
+    {
+        quint16 mainType = 0, subType = 0;
+        QKnxDatapointTypePrivate::fromType(quint32(type), &mainType, &subType);
+        return mainType == 5 || mainType == 7 || mainType == 8;
+    }
+}
+
+/*!
+    Decodes \a count \a samples into the column of doubles \a values, which
+    must provide room for \a count values. The coefficient of the sample's
+    datapoint type is applied, for example a \l QKnxScaling sample encoded as
+    \c 255 decodes to \c 100.
+
+    If \a valid is not \c nullptr, it must provide room for \a count values and
+    receives whether the corresponding sample could be decoded. The value of a
+    sample that could not be decoded is set to \c 0.
+
+    Supported are the main datapoint types listed in the class documentation
+    and all their sub types. Returns the number of decoded samples.
+
+    \note No memory is allocated per sample.
+*/
+int QKnxDatapointTypeCodec::decode(const Sample *samples, int count, double *values, bool *valid)
+{
+    int decoded = 0;
+    QKnxPrivate::SampleDecoder decoder;
+    for (int i = 0; i < count; ++i) {
+        qint64 integer = 0;
+        double floating = 0.;
+        bool isFloat = false;
+
+        const auto &sample = samples[i];
+        const bool ok = decoder.decode(sample, &integer, &floating, &isFloat);
+        if (ok && !isFloat) {
+            floating = double(integer);
+            if (QKnxPrivate::hasCoefficient(sample.type))
+                floating *= decoder.coefficient(sample.type);
+        }
+
+        values[i] = ok ? floating : 0.;
+        if (valid)
+            valid[i] = ok;
+        decoded += ok;
+    }
+    return decoded;
+}
+
+/*!
+    \overload
+
+    Decodes \a count \a samples into the column of integers \a values, which
+    must provide room for \a count values. The values are decoded as they are
+    encoded, without applying a coefficient. Samples of the floating point
+    datapoint types \l QKnx2ByteFloat and \l QKnx4ByteFloat cannot be decoded
+    into integers.
+
+    If \a valid is not \c nullptr, it must provide room for \a count values and
+    receives whether the corresponding sample could be decoded. The value of a
+    sample that could not be decoded is set to \c 0.
+
+    Returns the number of decoded samples.
+*/
+int QKnxDatapointTypeCodec::decode(const Sample *samples, int count, qint64 *values, bool *valid)
+{
+    int decoded = 0;
+    QKnxPrivate::SampleDecoder decoder;
+    for (int i = 0; i < count; ++i) {
+        qint64 integer = 0;
+        double floating = 0.;
+        bool isFloat = false;
+
+        const bool ok = decoder.decode(samples[i], &integer, &floating, &isFloat) && !isFloat;
+        values[i] = ok ? integer : 0;
+        if (valid)
+            valid[i] = ok;
+        decoded += ok;
+    }
+    return decoded;
+}
+
+
+// -- Float16
+
+namespace QKnxPrivate
+{
+    // A 2-byte float encodes 0.01 * M * 2^E, with the exponent E in bits 11 to 14 and a 12 bit
+    // two's complement mantissa M whose sign is stored in the most significant bit.
+    static const constexpr quint16 InvalidFloat16 = 0x7fff;
+    static const constexpr float MinimumFloat16 = -671088.64f;
+    static const constexpr float MaximumFloat16 = 670760.96f;
+
+    static inline float decodeFloat16(quint16 raw)
+    {
+        const qint32 M = qint32(raw & 0x07ff) - qint32(raw & 0x8000) / 16;
+        // M * 2^E is exact and scaling by a power of two commutes with the rounding, so this
+        // matches 0.01 * M * 2^E bit by bit.
+        return float(0.01 * double(M * (1 << ((raw >> 11) & 0x0f))));
+    }
+
+    static inline int roundToInt(float d)
+    {
+        return d >= 0.0f ? int(d + 0.5f) : int(d - 0.5f);
+    }
+
+    static inline bool encodeFloat16(float value, quint16 *raw)
+    {
+        if (!(value >= MinimumFloat16 && value <= MaximumFloat16))
+            return false;
+
+        // The exponent is the smallest one that brings value * 100 / 2^E below 2048. For
+        // |value| > 20.48 that is the binary exponent of |value| * 100 / 2048, which is exact
+        // in double precision.
+        int E = 0;
+        const qreal absolute = qAbs(qreal(value));
+        if (absolute > 20.48)
+            std::frexp(absolute * 100 / 2048., &E);
+        if (E > 15)
+            return false;
+
+        const qint32 M = roundToInt(value * std::ldexp(1.f, -E) * 100);
+        if (M > 2047 || M < -2048)
+            return false;
+
+        quint16 encodedM = quint16(M);
+        if (value < 0)
+            encodedM &= 0x87ff;
+        *raw = quint16(encodedM | (E << 11));
+        return true;
+    }
+
+    // Returns the smallest float greater than 20.48 * 2^E. Since no float value times 100 is a
+    // power of two, |value| > 20.48 * 2^E in double precision equals |value| >= threshold(E).
+    static inline float exponentThreshold(int E)
+    {
+        float threshold = float(20.48);
+        if (double(threshold) <= 20.48)
+            threshold = std::nextafter(threshold, MaximumFloat16);
+        return std::ldexp(threshold, E);
+    }
+
+#if defined(__SSE2__)
+    static inline __m128 decodeFloat16x4(__m128i raw)
+    {
+        const __m128i M = _mm_sub_epi32(_mm_and_si128(raw, _mm_set1_epi32(0x07ff)),
+            _mm_slli_epi32(_mm_srli_epi32(raw, 15), 11));
+        const __m128i E = _mm_and_si128(_mm_srli_epi32(raw, 11), _mm_set1_epi32(0x0f));
+        const __m128 scale = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(E,
+            _mm_set1_epi32(127)), 23)); // 2^E
+
+        const __m128d factor = _mm_set1_pd(0.01);
+        const __m128d low = _mm_mul_pd(factor, _mm_mul_pd(_mm_cvtepi32_pd(M),
+            _mm_cvtps_pd(scale)));
+        const __m128d high = _mm_mul_pd(factor, _mm_mul_pd(_mm_cvtepi32_pd(
+            _mm_shuffle_epi32(M, _MM_SHUFFLE(1, 0, 3, 2))), _mm_cvtps_pd(_mm_movehl_ps(scale,
+            scale))));
+        return _mm_movelh_ps(_mm_cvtpd_ps(low), _mm_cvtpd_ps(high));
+    }
+
+    static inline __m128i encodeFloat16x4(__m128 value, const __m128 *thresholds, int *encoded)
+    {
+        const __m128 signMask = _mm_set1_ps(-0.f);
+        const __m128 absolute = _mm_andnot_ps(signMask, value);
+        __m128i valid = _mm_castps_si128(_mm_and_ps(_mm_cmpge_ps(value,
+            _mm_set1_ps(MinimumFloat16)), _mm_cmple_ps(value, _mm_set1_ps(MaximumFloat16))));
+
+        __m128i E = _mm_setzero_si128();
+        for (int i = 0; i < 16; ++i)
+            E = _mm_sub_epi32(E, _mm_castps_si128(_mm_cmpge_ps(absolute, thresholds[i])));
+        valid = _mm_andnot_si128(_mm_cmpgt_epi32(E, _mm_set1_epi32(15)), valid);
+
+        const __m128 scale = _mm_castsi128_ps(_mm_slli_epi32(_mm_sub_epi32(_mm_set1_epi32(127),
+            E), 23)); // 2^-E
+        const __m128 d = _mm_mul_ps(_mm_mul_ps(value, scale), _mm_set1_ps(100.f));
+        const __m128i M = _mm_cvttps_epi32(_mm_add_ps(d, _mm_or_ps(_mm_and_ps(d, signMask),
+            _mm_set1_ps(0.5f))));
+        valid = _mm_and_si128(valid, _mm_and_si128(_mm_cmplt_epi32(M, _mm_set1_epi32(2048)),
+            _mm_cmpgt_epi32(M, _mm_set1_epi32(-2049))));
+
+        const __m128i negative = _mm_castps_si128(_mm_cmplt_ps(value, _mm_setzero_ps()));
+        __m128i raw = _mm_and_si128(M, _mm_or_si128(_mm_and_si128(negative,
+            _mm_set1_epi32(0x87ff)), _mm_andnot_si128(negative, _mm_set1_epi32(0xffff))));
+        raw = _mm_or_si128(raw, _mm_slli_epi32(E, 11));
+        raw = _mm_or_si128(_mm_and_si128(valid, raw), _mm_andnot_si128(valid,
+            _mm_set1_epi32(InvalidFloat16)));
+
+        *encoded += qPopulationCount(uint(_mm_movemask_ps(_mm_castsi128_ps(valid))));
+        return raw;
+    }
+#endif
+
+#if defined(QT_COMPILER_SUPPORTS_AVX2)
+    QT_FUNCTION_TARGET(AVX2)
+    static inline __m256 decodeFloat16x8(__m128i data)
+    {
+        const __m256i raw = _mm256_cvtepu16_epi32(data);
+        const __m256i M = _mm256_sub_epi32(_mm256_and_si256(raw, _mm256_set1_epi32(0x07ff)),
+            _mm256_slli_epi32(_mm256_srli_epi32(raw, 15), 11));
+        const __m256i E = _mm256_and_si256(_mm256_srli_epi32(raw, 11), _mm256_set1_epi32(0x0f));
+        const __m256i scaled = _mm256_sllv_epi32(M, E); // M * 2^E
+
+        const __m256d factor = _mm256_set1_pd(0.01);
+        const __m128 low = _mm256_cvtpd_ps(_mm256_mul_pd(factor,
+            _mm256_cvtepi32_pd(_mm256_castsi256_si128(scaled))));
+        const __m128 high = _mm256_cvtpd_ps(_mm256_mul_pd(factor,
+            _mm256_cvtepi32_pd(_mm256_extracti128_si256(scaled, 1))));
+        return _mm256_insertf128_ps(_mm256_castps128_ps256(low), high, 1);
+    }
+
+    QT_FUNCTION_TARGET(AVX2)
+    static inline __m128i encodeFloat16x8(__m256 value, const __m256 *thresholds, int *encoded)
+    {
+        const __m256 signMask = _mm256_set1_ps(-0.f);
+        const __m256 absolute = _mm256_andnot_ps(signMask, value);
+        __m256i valid = _mm256_castps_si256(_mm256_and_ps(_mm256_cmp_ps(value,
+            _mm256_set1_ps(MinimumFloat16), _CMP_GE_OQ), _mm256_cmp_ps(value,
+            _mm256_set1_ps(MaximumFloat16), _CMP_LE_OQ)));
+
+        __m256i E = _mm256_setzero_si256();
+        for (int i = 0; i < 16; ++i) {
+            E = _mm256_sub_epi32(E, _mm256_castps_si256(_mm256_cmp_ps(absolute, thresholds[i],
+                _CMP_GE_OQ)));
+        }
+        valid = _mm256_andnot_si256(_mm256_cmpgt_epi32(E, _mm256_set1_epi32(15)), valid);
+
+        const __m256 scale = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_sub_epi32(
+            _mm256_set1_epi32(127), E), 23)); // 2^-E
+        const __m256 d = _mm256_mul_ps(_mm256_mul_ps(value, scale), _mm256_set1_ps(100.f));
+        const __m256i M = _mm256_cvttps_epi32(_mm256_add_ps(d, _mm256_or_ps(_mm256_and_ps(d,
+            signMask), _mm256_set1_ps(0.5f))));
+        valid = _mm256_and_si256(valid, _mm256_and_si256(_mm256_cmpgt_epi32(_mm256_set1_epi32(
+            2048), M), _mm256_cmpgt_epi32(M, _mm256_set1_epi32(-2049))));
+
+        const __m256i negative = _mm256_castps_si256(_mm256_cmp_ps(value, _mm256_setzero_ps(),
+            _CMP_LT_OQ));
+        __m256i raw = _mm256_and_si256(M, _mm256_blendv_epi8(_mm256_set1_epi32(0xffff),
+            _mm256_set1_epi32(0x87ff), negative));
+        raw = _mm256_or_si256(raw, _mm256_slli_epi32(E, 11));
+        raw = _mm256_blendv_epi8(_mm256_set1_epi32(InvalidFloat16), raw, valid);
+
+        *encoded += qPopulationCount(uint(_mm256_movemask_ps(_mm256_castsi256_ps(valid))));
+        // sign extend so that the signed saturation of the pack keeps the low 16 bits
+        raw = _mm256_srai_epi32(_mm256_slli_epi32(raw, 16), 16);
+        return _mm_packs_epi32(_mm256_castsi256_si128(raw), _mm256_extracti128_si256(raw, 1));
+    }
+
+    // Converts the leading multiple of eight values and returns their count.
+    QT_FUNCTION_TARGET(AVX2)
+    static int decodeFloat16Avx2(const quint16 *raw, float *values, int count)
+    {
+        int i = 0;
+        for (; i + 8 <= count; i += 8) {
+            _mm256_storeu_ps(values + i, decodeFloat16x8(_mm_loadu_si128(reinterpret_cast<const
+                __m128i *>(raw + i))));
+        }
+        return i;
+    }
+
+    QT_FUNCTION_TARGET(AVX2)
+    static int encodeFloat16Avx2(const float *values, quint16 *raw, int count, int *encoded)
+    {
+        __m256 thresholds[16];
+        for (int e = 0; e < 16; ++e)
+            thresholds[e] = _mm256_set1_ps(exponentThreshold(e));
+
+        int i = 0;
+        for (; i + 8 <= count; i += 8) {
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(raw + i),
+                encodeFloat16x8(_mm256_loadu_ps(values + i), thresholds, encoded));
+        }
+        return i;
+    }
+#endif
+
+    static void decodeFloat16(const quint16 *raw, float *values, int count)
+    {
+        int i = 0;
+#if defined(QT_COMPILER_SUPPORTS_AVX2)
+        if (qCpuHasFeature(AVX2))
+            i = decodeFloat16Avx2(raw, values, count);
+#endif
+#if defined(__SSE2__)
+        for (; i + 8 <= count; i += 8) {
+            const __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i *>(raw + i));
+            _mm_storeu_ps(values + i, decodeFloat16x4(_mm_unpacklo_epi16(data,
+                _mm_setzero_si128())));
+            _mm_storeu_ps(values + i + 4, decodeFloat16x4(_mm_unpackhi_epi16(data,
+                _mm_setzero_si128())));
+        }
+#endif
+        for (; i < count; ++i)
+            values[i] = decodeFloat16(raw[i]);
+    }
+
+    static int encodeFloat16(const float *values, quint16 *raw, int count)
+    {
+        int i = 0, encoded = 0;
+#if defined(QT_COMPILER_SUPPORTS_AVX2)
+        if (qCpuHasFeature(AVX2))
+            i = encodeFloat16Avx2(values, raw, count, &encoded);
+#endif
+#if defined(__SSE2__)
+        if (i + 8 <= count) {
+            __m128 thresholds[16];
+            for (int e = 0; e < 16; ++e)
+                thresholds[e] = _mm_set1_ps(exponentThreshold(e));
+
+            for (; i + 8 <= count; i += 8) {
+                // sign extend so that the signed saturation of the pack keeps the low 16 bits
+                const __m128i low = _mm_srai_epi32(_mm_slli_epi32(encodeFloat16x4(
+                    _mm_loadu_ps(values + i), thresholds, &encoded), 16), 16);
+                const __m128i high = _mm_srai_epi32(_mm_slli_epi32(encodeFloat16x4(
+                    _mm_loadu_ps(values + i + 4), thresholds, &encoded), 16), 16);
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(raw + i),
+                    _mm_packs_epi32(low, high));
+            }
+        }
+#endif
+        for (; i < count; ++i) {
+            if (encodeFloat16(values[i], raw + i))
+                ++encoded;
+            else
+                raw[i] = InvalidFloat16;
+        }
+        return encoded;
+    }
+}
+
+// -- Traits
+
+namespace QKnxPrivate
+{
+    template <typename T>
+    static bool checkSize(QKnxByteArrayView bytes, bool *ok)
+    {
+        const bool sizeOk = bytes.size() == QKnxDatapointTypeCodec::Traits<T>::Size;
+        if (ok)
+            *ok = sizeOk;
+        return sizeOk;
+    }
+}
+
+bool QKnxDatapointTypeCodec::Traits<QKnx1Bit>::decode(QKnxByteArrayView bytes, bool *ok)
+{
+    if (!QKnxPrivate::checkSize<QKnx1Bit>(bytes, ok))
+        return false;
+    if (ok)
+        *ok = bytes.at(0) <= 0x01;
+    return QKnxDatapointType::testBit(bytes.at(0), 0);
+}
+
+bool QKnxDatapointTypeCodec::Traits<QKnx1Bit>::encode(bool value, quint8 *out)
+{
+    out[0] = value ? 0x01 : 0x00;
+    return true;
+}
+
+quint8 QKnxDatapointTypeCodec::Traits<QKnx8BitUnsignedValue>::decode(QKnxByteArrayView bytes,
+    bool *ok)
+{
+    if (!QKnxPrivate::checkSize<QKnx8BitUnsignedValue>(bytes, ok))
+        return 0;
+    return bytes.at(0);
+}
+
+bool QKnxDatapointTypeCodec::Traits<QKnx8BitUnsignedValue>::encode(quint8 value, quint8 *out)
+{
+    out[0] = value;
+    return true;
+}
+
+qint8 QKnxDatapointTypeCodec::Traits<QKnx8BitSignedValue>::decode(QKnxByteArrayView bytes,
+    bool *ok)
+{
+    if (!QKnxPrivate::checkSize<QKnx8BitSignedValue>(bytes, ok))
+        return 0;
+    return qint8(bytes.at(0));
+}
+
+bool QKnxDatapointTypeCodec::Traits<QKnx8BitSignedValue>::encode(qint8 value, quint8 *out)
+{
+    out[0] = quint8(value);
+    return true;
+}
+
+quint16 QKnxDatapointTypeCodec::Traits<QKnx2ByteUnsignedValue>::decode(QKnxByteArrayView bytes,
+    bool *ok)
+{
+    if (!QKnxPrivate::checkSize<QKnx2ByteUnsignedValue>(bytes, ok))
+        return 0;
+    return QKnxUtils::QUint16::fromBytes(bytes);
+}
+
+bool QKnxDatapointTypeCodec::Traits<QKnx2ByteUnsignedValue>::encode(quint16 value, quint8 *out)
+{
+    out[0] = quint8(value >> 8);
+    out[1] = quint8(value);
+    return true;
+}
+
+qint16 QKnxDatapointTypeCodec::Traits<QKnx2ByteSignedValue>::decode(QKnxByteArrayView bytes,
+    bool *ok)
+{
+    if (!QKnxPrivate::checkSize<QKnx2ByteSignedValue>(bytes, ok))
+        return 0;
+    return qint16(QKnxUtils::QUint16::fromBytes(bytes));
+}
+
+bool QKnxDatapointTypeCodec::Traits<QKnx2ByteSignedValue>::encode(qint16 value, quint8 *out)
+{
+    return Traits<QKnx2ByteUnsignedValue>::encode(quint16(value), out);
+}
+
+float QKnxDatapointTypeCodec::Traits<QKnx2ByteFloat>::decode(QKnxByteArrayView bytes, bool *ok)
+{
+    if (!QKnxPrivate::checkSize<QKnx2ByteFloat>(bytes, ok))
+        return 0.f;
+    return QKnxPrivate::decodeFloat16(QKnxUtils::QUint16::fromBytes(bytes));
+}
+
+bool QKnxDatapointTypeCodec::Traits<QKnx2ByteFloat>::encode(float value, quint8 *out)
+{
+    quint16 raw = 0;
+    if (!QKnxPrivate::encodeFloat16(value, &raw))
+        return false;
+    return Traits<QKnx2ByteUnsignedValue>::encode(raw, out);
+}
+
+/*!
+    Decodes \a count 2-byte floats from \a raw into \a values. The raw values
+    are expected in host byte order, as returned by
+    \c {QKnxUtils::QUint16::fromBytes()}.
+
+    The conversion uses AVX2 instructions if the CPU supports them at runtime,
+    otherwise SSE2 instructions if the module is built for them. It gives
+    exactly the results of decoding each value on its own.
+*/
+void QKnxDatapointTypeCodec::Traits<QKnx2ByteFloat>::decode(const quint16 *raw, float *values,
+    int count)
+{
+    QKnxPrivate::decodeFloat16(raw, values, count);
+}
+
+/*!
+    Encodes \a count \a values as 2-byte floats into \a raw, in host byte
+    order. A value that cannot be represented is encoded as \c 0x7fff, the KNX
+    encoding of invalid data. Returns the number of successfully encoded values.
+
+    The conversion uses AVX2 instructions if the CPU supports them at runtime,
+    otherwise SSE2 instructions if the module is built for them. It gives
+    exactly the results of encoding each value on its own.
+*/
+int QKnxDatapointTypeCodec::Traits<QKnx2ByteFloat>::encode(const float *values, quint16 *raw,
+    int count)
+{
+    return QKnxPrivate::encodeFloat16(values, raw, count);
+}
+
+quint32 QKnxDatapointTypeCodec::Traits<QKnx4ByteUnsignedValue>::decode(QKnxByteArrayView bytes,
+    bool *ok)
+{
+    if (!QKnxPrivate::checkSize<QKnx4ByteUnsignedValue>(bytes, ok))
+        return 0;
+    return QKnxUtils::QUint32::fromBytes(bytes);
+}
+
+bool QKnxDatapointTypeCodec::Traits<QKnx4ByteUnsignedValue>::encode(quint32 value, quint8 *out)
+{
+    out[0] = quint8(value >> 24);
+    out[1] = quint8(value >> 16);
+    out[2] = quint8(value >> 8);
+    out[3] = quint8(value);
+    return true;
+}
+
+qint32 QKnxDatapointTypeCodec::Traits<QKnx4ByteSignedValue>::decode(QKnxByteArrayView bytes,
+    bool *ok)
+{
+    if (!QKnxPrivate::checkSize<QKnx4ByteSignedValue>(bytes, ok))
+        return 0;
+    return qint32(QKnxUtils::QUint32::fromBytes(bytes));
+}
+
+bool QKnxDatapointTypeCodec::Traits<QKnx4ByteSignedValue>::encode(qint32 value, quint8 *out)
+{
+    return Traits<QKnx4ByteUnsignedValue>::encode(quint32(value), out);
+}
+
+float QKnxDatapointTypeCodec::Traits<QKnx4ByteFloat>::decode(QKnxByteArrayView bytes, bool *ok)
+{
+    if (!QKnxPrivate::checkSize<QKnx4ByteFloat>(bytes, ok))
+        return 0.f;
+
+    quint32 temp = QKnxUtils::QUint32::fromBytes(bytes);
+    float value = 0;
+    memcpy(&value, &temp, sizeof(value));
+    return value;
+}
+
+bool QKnxDatapointTypeCodec::Traits<QKnx4ByteFloat>::encode(float value, quint8 *out)
+{
+    quint32 tmp;
+    memcpy(&tmp, &value, sizeof(value));
+    return Traits<QKnx4ByteUnsignedValue>::encode(tmp, out);
+}
+
+QT_END_NAMESPACE
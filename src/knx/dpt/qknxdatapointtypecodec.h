@@ -0,0 +1,119 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtKnx module.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#ifndef QKNXDATAPOINTTYPECODEC_H
+#define QKNXDATAPOINTTYPECODEC_H
+
+#include <QtKnx/qknxbytearrayview.h>
+#include <QtKnx/qknxdatapointtype.h>
+#include <QtKnx/qtknxglobal.h>
+
+QT_BEGIN_NAMESPACE
+
+class QKnx1Bit;
+class QKnx8BitUnsignedValue;
+class QKnx8BitSignedValue;
+class QKnx2ByteUnsignedValue;
+class QKnx2ByteSignedValue;
+class QKnx2ByteFloat;
+class QKnx4ByteUnsignedValue;
+class QKnx4ByteSignedValue;
+class QKnx4ByteFloat;
+
+struct Q_KNX_EXPORT QKnxDatapointTypeCodec final
+{
+    struct Sample final
+    {
+        QKnxDatapointType::Type type { QKnxDatapointType::Type::Unknown };
+        QKnxByteArrayView bytes;
+    };
+
+    template <typename T> struct Traits;
+
+    template <typename T>
+    static typename Traits<T>::ValueType decode(QKnxByteArrayView bytes, bool *ok = nullptr)
+    {
+        return Traits<T>::decode(bytes, ok);
+    }
+
+    template <typename T>
+    static bool encode(typename Traits<T>::ValueType value, quint8 *out)
+    {
+        return Traits<T>::encode(value, out);
+    }
+
+    static int decode(const Sample *samples, int count, double *values, bool *valid = nullptr);
+    static int decode(const Sample *samples, int count, qint64 *values, bool *valid = nullptr);
+};
+
+#define DECLARE_CODEC_TRAITS(CLASS, VALUE_TYPE, SIZE) \
+template <> struct Q_KNX_EXPORT QKnxDatapointTypeCodec::Traits<CLASS> final \
+{ \
+    using ValueType = VALUE_TYPE; \
+    static const constexpr int Size = SIZE; \
+    static ValueType decode(QKnxByteArrayView bytes, bool *ok); \
+    static bool encode(ValueType value, quint8 *out); \
+};
+
+DECLARE_CODEC_TRAITS(QKnx1Bit, bool, 1)
+DECLARE_CODEC_TRAITS(QKnx8BitUnsignedValue, quint8, 1)
+DECLARE_CODEC_TRAITS(QKnx8BitSignedValue, qint8, 1)
+DECLARE_CODEC_TRAITS(QKnx2ByteUnsignedValue, quint16, 2)
+DECLARE_CODEC_TRAITS(QKnx2ByteSignedValue, qint16, 2)
+DECLARE_CODEC_TRAITS(QKnx4ByteUnsignedValue, quint32, 4)
+DECLARE_CODEC_TRAITS(QKnx4ByteSignedValue, qint32, 4)
+DECLARE_CODEC_TRAITS(QKnx4ByteFloat, float, 4)
+
+#undef DECLARE_CODEC_TRAITS
+
+template <> struct Q_KNX_EXPORT QKnxDatapointTypeCodec::Traits<QKnx2ByteFloat> final
+{
+    using ValueType = float;
+    static const constexpr int Size = 2;
+    static ValueType decode(QKnxByteArrayView bytes, bool *ok);
+    static bool encode(ValueType value, quint8 *out);
+
+    static void decode(const quint16 *raw, float *values, int count);
+    static int encode(const float *values, quint16 *raw, int count);
+};
+
+QT_END_NAMESPACE
+
+#endif
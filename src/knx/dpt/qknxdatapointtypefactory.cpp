@@ -55,6 +55,8 @@
 #include "qknxutf8string.h"
 #include "qknxvarstring.h"
 
+#include <algorithm>
+
 QT_BEGIN_NAMESPACE
 
 /*!
@@ -106,18 +108,10 @@ QT_BEGIN_NAMESPACE
 */
 QKnxDatapointType *QKnxDatapointTypeFactory::createType(int mainType, int subType) const
 {
-    const auto main = factoryTable().constFind(mainType);
-    if (main == factoryTable().constEnd())
-        return nullptr;
-
-    auto sub = (*main).constFind(subType);
-    if (sub == (*main).constEnd())
-        sub = (*main).constFind(0); // try base, e.g. 1.00[0]
-
-    if (sub == (*main).constEnd())
-        return nullptr;
-
-    return (*sub)();
+    auto function = factoryFunction(mainType, subType);
+    if (!function)
+        function = factoryFunction(mainType, 0); // try base, e.g. 1.00[0]
+    return function ? function() : nullptr;
 }
 
 /*!
@@ -129,20 +123,8 @@ QKnxDatapointType *QKnxDatapointTypeFactory::createType(int mainType, int subTyp
 */
 QKnxDatapointType *QKnxDatapointTypeFactory::createType(QKnxDatapointType::Type type) const
 {
-    const auto num = QString::number(int(type));
-    if (num.size() < 6)
-        return nullptr;
-
-    bool okMain = false, okSub = false;
-    const auto number = QStringView{ num };
-
-    // Datapoint Type shall be identified by a 16 bit main number separated by a dot from a 16 bit
-    // sub number. The assumption being made is that QKnxDatapointType::Type is encoded in that way
-    // while omitting the dot.
-    int mainType = number.left(number.size() - 5).toInt(&okMain);
-    int subType = number.right(5).toInt(&okSub);
-
-    if (okMain && okSub)
+    quint16 mainType = 0, subType = 0;
+    if (QKnxDatapointTypePrivate::fromType(quint32(type), &mainType, &subType))
         return createType(mainType, subType);
     return nullptr;
 }
@@ -152,7 +134,8 @@ QKnxDatapointType *QKnxDatapointTypeFactory::createType(QKnxDatapointType::Type
 */
 int QKnxDatapointTypeFactory::typeSize(int mainType)
 {
-    return sizeTable().value(mainType);
+    const auto &sizes = sizeTable();
+    return (mainType >= 0 && mainType < sizes.size()) ? sizes.at(mainType) : 0;
 }
 
 /*!
@@ -160,7 +143,13 @@ int QKnxDatapointTypeFactory::typeSize(int mainType)
 */
 QList<int> QKnxDatapointTypeFactory::mainTypes() const
 {
-    return factoryTable().keys();
+    QList<int> types;
+    for (const auto &entry : qAsConst(factoryTable())) {
+        const int mainType = int(entry.key >> 16);
+        if (types.isEmpty() || types.constLast() != mainType)
+            types.append(mainType);
+    }
+    return types;
 }
 
 /*!
@@ -169,7 +158,13 @@ QList<int> QKnxDatapointTypeFactory::mainTypes() const
 */
 bool QKnxDatapointTypeFactory::containsMainType(int mainType) const
 {
-    return factoryTable().contains(mainType);
+    if (!isValidKey(mainType, 0))
+        return false;
+
+    const auto &table = factoryTable();
+    const auto it = std::lower_bound(table.cbegin(), table.cend(), toKey(mainType, 0),
+        [](const Entry &entry, quint32 key) { return entry.key < key; });
+    return it != table.cend() && (it->key >> 16) == quint32(mainType);
 }
 
 /*!
@@ -177,10 +172,16 @@ bool QKnxDatapointTypeFactory::containsMainType(int mainType) const
 */
 QList<int> QKnxDatapointTypeFactory::subTypes(int mainType) const
 {
-    const auto main = factoryTable().constFind(mainType);
-    if (main != factoryTable().constEnd())
-        return (*main).keys();
-    return {};
+    if (!isValidKey(mainType, 0))
+        return {};
+
+    QList<int> types;
+    const auto &table = factoryTable();
+    auto it = std::lower_bound(table.cbegin(), table.cend(), toKey(mainType, 0),
+        [](const Entry &entry, quint32 key) { return entry.key < key; });
+    for (; it != table.cend() && (it->key >> 16) == quint32(mainType); ++it)
+        types.append(int(it->key & 0xffff));
+    return types;
 }
 
 /*!
@@ -189,10 +190,7 @@ QList<int> QKnxDatapointTypeFactory::subTypes(int mainType) const
 */
 bool QKnxDatapointTypeFactory::containsSubType(int mainType, int subType) const
 {
-    const auto main = factoryTable().constFind(mainType);
-    if (main != factoryTable().constEnd())
-        return (*main).constFind(subType) != (*main).constEnd();
-    return false;
+    return factoryFunction(mainType, subType) != nullptr;
 }
 
 /*!
@@ -490,10 +488,58 @@ QKnxDatapointTypeFactory::QKnxDatapointTypeFactory()
 
 /*!
     \internal
+
+    Returns the registered factory functions, sorted by their packed main and
+    sub type key.
 */
-QHash<int, int> &QKnxDatapointTypeFactory::sizeTable()
+QVector<QKnxDatapointTypeFactory::Entry> &QKnxDatapointTypeFactory::factoryTable()
 {
-    static QHash<int, int> _instance;
+    static QVector<Entry> _instance;
+    return _instance;
+}
+
+/*!
+    \internal
+*/
+QKnxDatapointTypeFactory::FactoryFunction QKnxDatapointTypeFactory::factoryFunction(int mainType,
+    int subType)
+{
+    if (!isValidKey(mainType, subType))
+        return nullptr;
+
+    const auto key = toKey(mainType, subType);
+    const auto &table = factoryTable();
+    const auto it = std::lower_bound(table.cbegin(), table.cend(), key,
+        [](const Entry &entry, quint32 k) { return entry.key < k; });
+    return (it != table.cend() && it->key == key) ? it->function : nullptr;
+}
+
+/*!
+    \internal
+*/
+void QKnxDatapointTypeFactory::insertType(int mainType, int subType, FactoryFunction function)
+{
+    if (!isValidKey(mainType, subType))
+        return;
+
+    const auto key = toKey(mainType, subType);
+    auto &table = factoryTable();
+    auto it = std::lower_bound(table.begin(), table.end(), key,
+        [](const Entry &entry, quint32 k) { return entry.key < k; });
+    if (it != table.end() && it->key == key)
+        it->function = function;
+    else
+        table.insert(it, { key, function });
+}
+
+/*!
+    \internal
+
+    Returns the type sizes, indexed by main type.
+*/
+QVector<int> &QKnxDatapointTypeFactory::sizeTable()
+{
+    static QVector<int> _instance;
     return _instance;
 }
 
@@ -502,7 +548,13 @@ QHash<int, int> &QKnxDatapointTypeFactory::sizeTable()
 */
 void QKnxDatapointTypeFactory::setTypeSize(int mainType, int size)
 {
-    sizeTable().insert(mainType, size);
+    if (!isValidKey(mainType, 0))
+        return;
+
+    auto &sizes = sizeTable();
+    if (mainType >= sizes.size())
+        sizes.resize(mainType + 1);
+    sizes[mainType] = size;
 }
 
 QT_END_NAMESPACE
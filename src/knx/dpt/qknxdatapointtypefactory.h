@@ -30,6 +30,7 @@
 #ifndef QKNXDATAPOINTTYPEFACTORY_H
 #define QKNXDATAPOINTTYPEFACTORY_H
 
+#include <QtCore/qvector.h>
 #include <QtKnx/qknxdatapointtype.h>
 #include <QtKnx/qtknxglobal.h>
 
@@ -53,7 +54,8 @@ public:
             "class because it is not derived from QKnxDatapointType.");
 
         QKnxDatapointTypeFactory::setTypeSize(mainType, size);
-        factoryTable()[mainType].insert(subType, &QKnxDatapointTypeFactory::create<Class>);
+        QKnxDatapointTypeFactory::insertType(mainType, subType,
+            &QKnxDatapointTypeFactory::create<Class>);
     }
 
     QKnxDatapointType *createType(int mainType, int subType) const;
@@ -75,18 +77,32 @@ private:
         return new Class();
     }
 
-    static QHash<int, QHash<int, FactoryFunction>> &factoryTable()
+    struct Entry
     {
-        static QHash<int, QHash<int, FactoryFunction>> _instance;
-        return _instance;
+        quint32 key;
+        FactoryFunction function;
+    };
+
+    static constexpr bool isValidKey(int mainType, int subType)
+    {
+        return mainType >= 0 && mainType <= 0xffff && subType >= 0 && subType <= 0xffff;
     }
 
+    static constexpr quint32 toKey(int mainType, int subType)
+    {
+        return (quint32(mainType) << 16) | quint32(subType);
+    }
+
+    static QVector<Entry> &factoryTable();
+    static FactoryFunction factoryFunction(int mainType, int subType);
+    static void insertType(int mainType, int subType, FactoryFunction function);
+
     template <typename Class> void registerType()
     {
         registerType<Class>(Class::MainType, Class::SubType, Class::TypeSize);
     }
 
-    static QHash<int, int> &sizeTable();
+    static QVector<int> &sizeTable();
     static void setTypeSize(int mainType, int size);
 
     QKnxDatapointTypeFactory(const QKnxDatapointTypeFactory &) = delete;
@@ -66,9 +66,12 @@ QKnxTimeOfDay::QKnxTimeOfDay()
 QKnxTimeOfDay::QKnxTimeOfDay(const QKnxTime &time)
     : QKnxFixedSizeDatapointType(MainType, SubType, TypeSize)
 {
-    setDescription(tr("Time of day"));
-    setRangeText(tr("No day, 00:00:00"), tr("Sunday, 23:59:59"));
-    setRange(QVariant::fromValue(QKnxTime(00, 00, 00)), QVariant::fromValue(QKnxTime(23, 59, 59)));
+    QKnxDatapointTypePrivate::setupMetaData(this, [this]() {
+        setDescription(tr("Time of day"));
+        setRangeText(tr("No day, 00:00:00"), tr("Sunday, 23:59:59"));
+        setRange(QVariant::fromValue(QKnxTime(00, 00, 00)),
+            QVariant::fromValue(QKnxTime(23, 59, 59)));
+    });
     setValue(time);
 }
 
@@ -225,9 +228,11 @@ bool QKnxTimeOfDay::isValid() const
 QKnxDate::QKnxDate()
     : QKnxDate(QDate(2000, 0, 0))
 {
-    setDescription(tr("Date"));
-    setRange(QDate(1990, 1, 1), QDate(2089, 12, 31));
-    setRangeText(tr("Monday, 1990-01-01"), tr("Saturday, 2089-12-31"));
+    QKnxDatapointTypePrivate::setupMetaData(this, [this]() {
+        setDescription(tr("Date"));
+        setRange(QDate(1990, 1, 1), QDate(2089, 12, 31));
+        setRangeText(tr("Monday, 1990-01-01"), tr("Saturday, 2089-12-31"));
+    });
 }
 
 /*!
@@ -420,11 +425,13 @@ QKnxDateTime::QKnxDateTime(const QDate &date, const QKnxTime24 &time, Attributes
         ClockQuality quality)
     : QKnxFixedSizeDatapointType(MainType, SubType, TypeSize)
 {
-    setDescription(tr("Date Time"));
-    setMinimumText(tr("Monday, 1900-01-01; Any day, 00:00:00"));
-    setMaximumText(tr("Wednesday, 2155-12-31; Sunday, 24:00:00"));
-    setMinimum(QVariant({ QDate(1900, 01, 01), QVariant::fromValue(QKnxTime24(00, 00, 00)) }));
-    setMaximum(QVariant({ QDate(2155, 12, 31), QVariant::fromValue(QKnxTime24(24, 00, 00)) }));
+    QKnxDatapointTypePrivate::setupMetaData(this, [this]() {
+        setDescription(tr("Date Time"));
+        setMinimumText(tr("Monday, 1900-01-01; Any day, 00:00:00"));
+        setMaximumText(tr("Wednesday, 2155-12-31; Sunday, 24:00:00"));
+        setMinimum(QVariant({ QDate(1900, 01, 01), QVariant::fromValue(QKnxTime24(00, 00, 00)) }));
+        setMaximum(QVariant({ QDate(2155, 12, 31), QVariant::fromValue(QKnxTime24(24, 00, 00)) }));
+    });
 
     setValue(date, time, attributes, quality);
 }
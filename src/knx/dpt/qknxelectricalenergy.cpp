@@ -81,10 +81,12 @@ QKnxElectricalEnergy::QKnxElectricalEnergy(qint64 value)
 QKnxElectricalEnergy::QKnxElectricalEnergy(int subType, qint64 value)
     : QKnxFixedSizeDatapointType(MainType, subType, TypeSize)
 {
-    setDescription(tr("8-byte signed value"));
-    setRange(QVariant::fromValue(LONG_MIN), QVariant::fromValue(LONG_MAX));
-    setRangeText(tr("Minimum Value, -9 223 372 036 854 775 808"),
-        tr("Maximum Value, 9 223 372 036 854 775 807"));
+    QKnxDatapointTypePrivate::setupMetaData(this, [this]() {
+        setDescription(tr("8-byte signed value"));
+        setRange(QVariant::fromValue(LONG_MIN), QVariant::fromValue(LONG_MAX));
+        setRangeText(tr("Minimum Value, -9 223 372 036 854 775 808"),
+            tr("Maximum Value, 9 223 372 036 854 775 807"));
+    });
 
     setValue(value);
 }
@@ -123,8 +125,10 @@ bool QKnxElectricalEnergy::isValid() const
 CLASS::CLASS() \
     : QKnxElectricalEnergy(SubType, 0) \
 { \
-    setUnit(tr(UNIT)); \
-    setDescription(tr(DESCRIPTION)); \
+    QKnxDatapointTypePrivate::setupMetaData(this, [this]() { \
+        setUnit(tr(UNIT)); \
+        setDescription(tr(DESCRIPTION)); \
+    }); \
 } \
 CLASS::CLASS(qint64 value) \
     : CLASS() \
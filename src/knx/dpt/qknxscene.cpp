@@ -118,9 +118,11 @@ QKnxSceneNumber::QKnxSceneNumber()
 QKnxSceneNumber::QKnxSceneNumber(quint8 number)
     : QKnxFixedSizeDatapointType(MainType, SubType, TypeSize)
 {
-    setDescription(tr("Scene Number"));
-    setRange(QVariant(0x00), QVariant(0x3f));
-    setRangeText(tr("Minimum, 0"), tr("Maximum, 63"));
+    QKnxDatapointTypePrivate::setupMetaData(this, [this]() {
+        setDescription(tr("Scene Number"));
+        setRange(QVariant(0x00), QVariant(0x3f));
+        setRangeText(tr("Minimum, 0"), tr("Maximum, 63"));
+    });
 
     setSceneNumber(number);
 }
@@ -176,9 +178,11 @@ QKnxSceneControl::QKnxSceneControl()
 QKnxSceneControl::QKnxSceneControl(quint8 sceneNumber, QKnxSceneControl::Control control)
     : QKnxFixedSizeDatapointType(MainType, SubType, TypeSize)
 {
-    setDescription(tr("Scene Control"));
-    setRange(QVariant(0x00), QVariant(0xbf));
-    setRangeText(tr("Minimum scene number, 0"), tr("Maximum scene number, 63"));
+    QKnxDatapointTypePrivate::setupMetaData(this, [this]() {
+        setDescription(tr("Scene Control"));
+        setRange(QVariant(0x00), QVariant(0xbf));
+        setRangeText(tr("Minimum scene number, 0"), tr("Maximum scene number, 63"));
+    });
 
     setSceneNumber(sceneNumber);
     setControl(control);
@@ -268,9 +272,11 @@ QKnxSceneInfo::QKnxSceneInfo()
 QKnxSceneInfo::QKnxSceneInfo(quint8 sceneNumber, QKnxSceneInfo::Info info)
     : QKnxFixedSizeDatapointType(MainType, SubType, TypeSize)
 {
-    setDescription(tr("Scene Information"));
-    setRange(QVariant(0x00), QVariant(0x7f));
-    setRangeText(tr("Minimum scene number, 0"), tr("Maximum scene number, 63"));
+    QKnxDatapointTypePrivate::setupMetaData(this, [this]() {
+        setDescription(tr("Scene Information"));
+        setRange(QVariant(0x00), QVariant(0x7f));
+        setRangeText(tr("Minimum scene number, 0"), tr("Maximum scene number, 63"));
+    });
 
     setSceneNumber(sceneNumber);
     setInfo(info);
@@ -99,9 +99,11 @@ QKnxStatusMode3::QKnxStatusMode3()
 QKnxStatusMode3::QKnxStatusMode3(Mode mode, StatusFlags statusFlags)
     : QKnxFixedSizeDatapointType(MainType, SubType, TypeSize)
 {
-    setDescription(tr("Status with Mode"));
-    setRange(QVariant(0x01), QVariant(0xfc));
-    setRangeText(tr("All set and Mode 0"), tr("All cleared and Mode 2"));
+    QKnxDatapointTypePrivate::setupMetaData(this, [this]() {
+        setDescription(tr("Status with Mode"));
+        setRange(QVariant(0x01), QVariant(0xfc));
+        setRangeText(tr("All set and Mode 0"), tr("All cleared and Mode 2"));
+    });
 
     setMode(mode);
     setStatusFlags(statusFlags);
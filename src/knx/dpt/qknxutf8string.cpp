@@ -83,8 +83,10 @@ QKnxUtf8String::QKnxUtf8String(const char *string, int size)
 QKnxUtf8String::QKnxUtf8String(int subType, const char *string, int size)
     : QKnxVariableSizeDatapointType(MainType, subType, TypeSize)
 {
-    setDescription(tr("Variable length character string (UTF-8)"));
-    setRange(QVariant(0x00), QVariant(0xff));
+    QKnxDatapointTypePrivate::setupMetaData(this, [this]() {
+        setDescription(tr("Variable length character string (UTF-8)"));
+        setRange(QVariant(0x00), QVariant(0xff));
+    });
     setString(string, size);
 }
 
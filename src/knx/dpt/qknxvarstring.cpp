@@ -83,8 +83,10 @@ QKnxVarString::QKnxVarString(const char *string, int size)
 QKnxVarString::QKnxVarString(int subType, const char *string, int size)
     : QKnxVariableSizeDatapointType(MainType, subType, TypeSize)
 {
-    setDescription(tr("Variable length character string (ISO 8859-1)"));
-    setRange(QVariant(0x00), QVariant(0xff));
+    QKnxDatapointTypePrivate::setupMetaData(this, [this]() {
+        setDescription(tr("Variable length character string (ISO 8859-1)"));
+        setRange(QVariant(0x00), QVariant(0xff));
+    });
     setString(string, size);
 }
 
@@ -20,6 +20,7 @@ PUBLIC_HEADERS += \
     qknxaddress.h \
     qknxcontrolfield.h \
     qknxextendedcontrolfield.h \
+    qknxgroupaddressfiltertable.h \
     qtknxglobal.h \
     qknxinterfaceobjectproperty.h \
     qknxinterfaceobjectpropertydatatype.h \
@@ -42,6 +43,7 @@ SOURCES += \
     qknxaddress.cpp \
     qknxcontrolfield.cpp \
     qknxextendedcontrolfield.cpp \
+    qknxgroupaddressfiltertable.cpp \
     qknxinterfaceobjectproperty.cpp \
     qknxinterfaceobjectpropertydatatype.cpp \
     qknxinterfaceobjecttype.cpp \
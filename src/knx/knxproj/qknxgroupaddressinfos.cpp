@@ -33,14 +33,91 @@
 
 #include "qzipreader_p.h"
 
+#include <QtCore/qcryptographichash.h>
+#include <QtCore/qdatetime.h>
+#include <QtCore/qendian.h>
+#include <QtCore/qfileinfo.h>
+#include <QtCore/qsavefile.h>
+#include <QtCore/qthreadpool.h>
+#include <QtCore/qvector.h>
+
+#include <algorithm>
+
 QT_BEGIN_NAMESPACE
 
+// -- KnxInstallationInfo
+
+struct KnxInstallationInfo final
+{
+    KnxInstallationInfo() = default;
+    explicit KnxInstallationInfo(const QList<QKnxGroupAddressInfo> &addressInfos)
+    {
+        infos.reserve(addressInfos.size());
+        for (const auto &info : addressInfos)
+            append(info);
+    }
+
+    void append(const QKnxGroupAddressInfo &info)
+    {
+        infos.append(info);
+        byAddress[info.address()].append(info);
+        byType[quint32(info.datapointType())].append(info);
+    }
+
+    void remove(const QKnxAddress &address)
+    {
+        const auto removed = byAddress.take(address);
+        if (removed.isEmpty())
+            return;
+
+        const auto hasAddress = [&address](const QKnxGroupAddressInfo &info) {
+            return info.address() == address;
+        };
+        for (const auto &info : removed)
+            removeIf(&byType, quint32(info.datapointType()), hasAddress);
+        infos.erase(std::remove_if(infos.begin(), infos.end(), hasAddress), infos.end());
+    }
+
+    void remove(const QKnxGroupAddressInfo &info)
+    {
+        const auto isEqual = [&info](const QKnxGroupAddressInfo &other) {
+            return other == info;
+        };
+        removeIf(&byAddress, info.address(), isEqual);
+        removeIf(&byType, quint32(info.datapointType()), isEqual);
+        infos.erase(std::remove_if(infos.begin(), infos.end(), isEqual), infos.end());
+    }
+
+    template <typename Key, typename Predicate>
+    static void removeIf(QHash<Key, QList<QKnxGroupAddressInfo>> *index, const Key &key,
+        Predicate predicate)
+    {
+        auto it = index->find(key);
+        if (it == index->end())
+            return;
+        it->erase(std::remove_if(it->begin(), it->end(), predicate), it->end());
+        if (it->isEmpty())
+            index->erase(it);
+    }
+
+    bool operator==(const KnxInstallationInfo &other) const
+    {
+        return infos == other.infos; // the indexes are derived from infos
+    }
+    inline bool operator!=(const KnxInstallationInfo &other) const { return !operator==(other); }
+
+    QList<QKnxGroupAddressInfo> infos;
+    QHash<QKnxAddress, QList<QKnxGroupAddressInfo>> byAddress;
+    QHash<quint32, QList<QKnxGroupAddressInfo>> byType;
+};
+
+
 // -- KnxProjectInfo
 
 struct KnxProjectInfo final
 {
     QString name;
-    QHash<QString, QList<QKnxGroupAddressInfo>> installations;
+    QHash<QString, KnxInstallationInfo> installations;
 
     bool operator==(const KnxProjectInfo &other) const
     {
@@ -50,18 +127,68 @@ struct KnxProjectInfo final
 };
 
 
+// -- KnxSnapshotKey
+
+struct KnxSnapshotKey final
+{
+    bool read(const QString &projectFile)
+    {
+        QFile file(projectFile);
+        if (!file.open(QIODevice::ReadOnly))
+            return false;
+        return read(&file);
+    }
+
+    bool read(QFile *file)
+    {
+        QCryptographicHash hash(QCryptographicHash::Sha1);
+        if (!hash.addData(file) || !file->seek(0))
+            return false;
+
+        size = quint64(file->size());
+        lastModified = QFileInfo(*file).lastModified().toMSecsSinceEpoch();
+        sha1 = hash.result();
+        return isValid();
+    }
+
+    bool isValid() const { return sha1.size() == 20; }
+
+    quint64 size = 0;
+    qint64 lastModified = 0;
+    QByteArray sha1;
+};
+
+
 // -- QKnxGroupAddressInfosPrivate
 
 class QKnxGroupAddressInfosPrivate final : public QSharedData
 {
 public:
     bool parseData(const QByteArray &data);
+    bool streamData(QIODevice *device);
+    void streamProjectNames(QIODevice *device);
+    bool readArchiveProject(QZipReader *reader, QString fileName, bool streaming);
+    bool merge(const QKnxGroupAddressInfosPrivate &other);
+    bool selectProject(const QString &projectId);
     bool readProject(const QKnxProject &project);
     QList<QKnxGroupAddressInfo> readRange(const QKnxGroupRange &range, const QString &install);
+    QByteArray toSnapshot(const KnxSnapshotKey &key) const;
+    bool fromSnapshot(const uchar *data, qint64 size, const KnxSnapshotKey &key);
+
+    const KnxInstallationInfo *installation(const QString &projectId,
+        const QString &installation) const
+    {
+        const auto project = projects.constFind(projectId);
+        if (project == projects.constEnd())
+            return nullptr;
+        const auto info = project->installations.constFind(installation);
+        return info == project->installations.constEnd() ? nullptr : &info.value();
+    }
 
     QString projectFile;
     QString errorString;
     QHash<QString, KnxProjectInfo> projects;
+    KnxSnapshotKey snapshotKey;
 
     QKnxGroupAddressInfos::Status status = QKnxGroupAddressInfos::Status::NoError;
 };
@@ -112,6 +239,272 @@ bool QKnxGroupAddressInfosPrivate::parseData(const QByteArray &data)
     return true;
 }
 
+/*!
+    \internal
+
+    Extracts the group addresses from the project file read from \a device
+    without building the project tree. Elements that cannot contain group
+    addresses are skipped, so the memory used does not depend on the size of
+    the topology or the building structure.
+*/
+bool QKnxGroupAddressInfosPrivate::streamData(QIODevice *device)
+{
+    if (!device || device->atEnd()) {
+        status = QKnxGroupAddressInfos::Status::FileError;
+        errorString = QKnxGroupAddressInfos::tr("Could not read project file.");
+        return false;
+    }
+
+    QXmlStreamReader reader(device);
+    if (!reader.readNextStartElement()) {
+        errorString = reader.errorString();
+        status = QKnxGroupAddressInfos::Status::ParseError;
+        return false;
+    }
+
+    if (reader.name() != QLatin1String("KNX")) {
+        status = QKnxGroupAddressInfos::Status::ParseError;
+        errorString = QKnxGroupAddressInfos::tr("Not a valid KNX project file.");
+        return false;
+    }
+
+    enum class Level { Root, Project, Installations, Installation, GroupAddresses };
+
+    auto level = Level::Root;
+    QString projectId, installation;
+    QList<QKnxGroupAddressInfo> addressInfos;
+    KnxProjectInfo projectInfo;
+    bool foundProject = false;
+
+    while (!reader.atEnd() && !reader.hasError()) {
+        const auto tokenType = reader.readNext();
+        if (tokenType == QXmlStreamReader::TokenType::StartElement) {
+            const auto name = reader.name();
+            const auto attrs = reader.attributes();
+            switch (level) {
+            case Level::Root:
+                if (name != QLatin1String("Project")) {
+                    reader.skipCurrentElement();
+                    break;
+                }
+                projectId = attrs.value(QLatin1String("Id")).toString();
+                if (projectId.isEmpty()) {
+                    reader.raiseError(QKnxGroupAddressInfos::tr("Missing required attribute "
+                        "'Id' in element <Project>."));
+                    break;
+                }
+                if (projects.contains(projectId)) {
+                    status = QKnxGroupAddressInfos::Status::ProjectError;
+                    errorString = QKnxGroupAddressInfos::tr("Project '%1' exists more than "
+                        "once.").arg(projectId);
+                    projects.clear();
+                    return false;
+                }
+                projectInfo = {};
+                foundProject = true;
+                level = Level::Project;
+                break;
+            case Level::Project:
+                if (name == QLatin1String("Installations"))
+                    level = Level::Installations;
+                else
+                    reader.skipCurrentElement();
+                break;
+            case Level::Installations:
+                if (name != QLatin1String("Installation")) {
+                    reader.skipCurrentElement();
+                    break;
+                }
+                installation = attrs.value(QLatin1String("Name")).toString();
+                if (projectInfo.installations.contains(installation)) {
+                    status = QKnxGroupAddressInfos::Status::ProjectError;
+                    errorString = QKnxGroupAddressInfos::tr("Installation '%1' exists more than "
+                        "once.").arg(installation.isEmpty() ? QStringLiteral("<empty>")
+                            : installation);
+                    projects.clear();
+                    return false;
+                }
+                addressInfos.clear();
+                level = Level::Installation;
+                break;
+            case Level::Installation:
+                if (name == QLatin1String("GroupAddresses"))
+                    level = Level::GroupAddresses;
+                else
+                    reader.skipCurrentElement();
+                break;
+            case Level::GroupAddresses:
+                if (name == QLatin1String("GroupAddress")) {
+                    bool ok = false;
+                    const auto address = attrs.value(QLatin1String("Address")).toUInt(&ok);
+                    if (!ok || address > 65535) {
+                        reader.raiseError(QKnxGroupAddressInfos::tr("Invalid value for "
+                            "attribute 'Address' in element <GroupAddress>."));
+                        break;
+                    }
+                    addressInfos.append({ installation,
+                        attrs.value(QLatin1String("Name")).toString(), quint16(address),
+                        attrs.value(QLatin1String("DatapointType")).toString(),
+                        attrs.value(QLatin1String("Description")).toString() });
+                    reader.skipCurrentElement(); // attribute element only
+                } else if (name != QLatin1String("GroupRanges")
+                    && name != QLatin1String("GroupRange")) {
+                    reader.skipCurrentElement();
+                }
+                break;
+            }
+        } else if (tokenType == QXmlStreamReader::TokenType::EndElement) {
+            const auto name = reader.name();
+            if (level == Level::GroupAddresses && name == QLatin1String("GroupAddresses")) {
+                level = Level::Installation;
+            } else if (level == Level::Installation && name == QLatin1String("Installation")) {
+                projectInfo.installations.insert(installation, KnxInstallationInfo(addressInfos));
+                level = Level::Installations;
+            } else if (level == Level::Installations && name == QLatin1String("Installations")) {
+                level = Level::Project;
+            } else if (level == Level::Project && name == QLatin1String("Project")) {
+                projects.insert(projectId, projectInfo);
+                level = Level::Root;
+            }
+        }
+    }
+
+    if (reader.hasError()) {
+        errorString = reader.errorString();
+        status = QKnxGroupAddressInfos::Status::ParseError;
+        projects.clear();
+        return false;
+    }
+
+    if (!foundProject) {
+        status = QKnxGroupAddressInfos::Status::ProjectError;
+        errorString = QKnxGroupAddressInfos::tr("The project file did not contain a KNX project.");
+        return false;
+    }
+    return true;
+}
+
+/*!
+    \internal
+
+    Reads the project names from the \c project.xml file provided by
+    \a device and assigns them to the already extracted projects.
+*/
+void QKnxGroupAddressInfosPrivate::streamProjectNames(QIODevice *device)
+{
+    if (!device)
+        return;
+
+    QXmlStreamReader reader(device);
+    if (!reader.readNextStartElement() || reader.name() != QLatin1String("KNX"))
+        return;
+
+    QString projectId;
+    while (!reader.atEnd() && !reader.hasError()) {
+        if (reader.readNext() != QXmlStreamReader::TokenType::StartElement)
+            continue;
+        if (reader.name() == QLatin1String("Project")) {
+            projectId = reader.attributes().value(QLatin1String("Id")).toString();
+        } else if (reader.name() == QLatin1String("ProjectInformation")) {
+            auto project = projects.find(projectId);
+            if (project != projects.end())
+                project->name = reader.attributes().value(QLatin1String("Name")).toString();
+            reader.skipCurrentElement();
+        }
+    }
+}
+
+/*!
+    \internal
+
+    Reads the project stored as \a fileName (a \c 0.xml file) inside the
+    archive \a reader and the project name from the accompanying
+    \c project.xml file.
+*/
+bool QKnxGroupAddressInfosPrivate::readArchiveProject(QZipReader *reader, QString fileName,
+    bool streaming)
+{
+    if (streaming) {
+        QScopedPointer<QIODevice> device(reader->fileDevice(fileName));
+        if (!streamData(device.data()))
+            return false;
+        device.reset(reader->fileDevice(fileName.replace(QStringLiteral("0.xml"),
+            QStringLiteral("project.xml"))));
+        streamProjectNames(device.data());
+        return true;
+    }
+
+    if (!parseData(reader->fileData(fileName)))
+        return false;
+
+    const auto data = reader->fileData(fileName.replace(QStringLiteral("0.xml"),
+        QStringLiteral("project.xml")));
+
+    QXmlStreamReader r(data);
+    if (r.hasError() || !r.readNextStartElement() || r.name() != QStringLiteral("KNX"))
+        return true;
+
+    QKnxProjectRoot root;
+    if (!root.parseElement(&r, true))
+        return true;
+    for (const auto &project : qAsConst(root.Project)) {
+        if (projects.contains(project.Id))
+            projects[project.Id].name = project.ProjectInformation.value(0).Name;
+    }
+    return true;
+}
+
+/*!
+    \internal
+
+    Adds the projects read by \a other. Returns \c false and takes over the
+    error if \a other failed or contains a project that was already added.
+*/
+bool QKnxGroupAddressInfosPrivate::merge(const QKnxGroupAddressInfosPrivate &other)
+{
+    if (other.status != QKnxGroupAddressInfos::Status::NoError) {
+        status = other.status;
+        errorString = other.errorString;
+        return false;
+    }
+
+    for (auto it = other.projects.cbegin(); it != other.projects.cend(); ++it) {
+        if (projects.contains(it.key())) {
+            status = QKnxGroupAddressInfos::Status::ProjectError;
+            errorString = QKnxGroupAddressInfos::tr("Project '%1' exists more than once.")
+                .arg(it.key());
+            return false;
+        }
+        projects.insert(it.key(), it.value());
+    }
+    return true;
+}
+
+/*!
+    \internal
+
+    Removes all projects except the one identified by \a projectId. Does
+    nothing if \a projectId is empty.
+*/
+bool QKnxGroupAddressInfosPrivate::selectProject(const QString &projectId)
+{
+    if (projectId.isEmpty())
+        return true;
+
+    const auto project = projects.value(projectId);
+    if (!projects.contains(projectId)) {
+        projects.clear();
+        status = QKnxGroupAddressInfos::Status::ProjectError;
+        errorString = QKnxGroupAddressInfos::tr("The project file did not contain the KNX "
+            "project '%1'.").arg(projectId);
+        return false;
+    }
+
+    projects.clear();
+    projects.insert(projectId, project);
+    return true;
+}
+
 /*!
     \internal
 */
@@ -138,7 +531,7 @@ bool QKnxGroupAddressInfosPrivate::readProject(const QKnxProject &project)
                 for (const auto &range : qAsConst(addresses.GroupRanges))
                     addressInfos.append(readRange(range, install.Name));
             }
-            info.installations.insert(install.Name, addressInfos);
+            info.installations.insert(install.Name, KnxInstallationInfo(addressInfos));
         }
         projects.insert(project.Id, info);
     } else {
@@ -165,6 +558,213 @@ QList<QKnxGroupAddressInfo>
     return addressInfos;
 }
 
+// The snapshot file stores all values little-endian and aligns every record to
+// four bytes, so that it can be read in place from a memory mapping:
+//
+//   header         72 bytes: magic, version, record counts, string table size,
+//                  source file size, last modification time and SHA-1 hash
+//   projects       16 bytes each: id, name, first installation, installation count
+//   installations  12 bytes each: name, first info, info count
+//   infos          16 bytes each: name, description, datapoint type, address,
+//                  address kind (address type plus one, zero if invalid), reserved
+//   strings        length prefixed UTF-16 strings padded to four bytes, records
+//                  refer to them by their offset into the string table
+
+static const char SnapshotMagic[8] = { 'Q', 'K', 'N', 'X', 'S', 'N', 'A', 'P' };
+static const quint32 SnapshotVersion = 1;
+static const quint64 SnapshotHeaderSize = 72;
+static const quint64 SnapshotProjectSize = 16;
+static const quint64 SnapshotInstallationSize = 12;
+static const quint64 SnapshotInfoSize = 16;
+
+template <typename T> static void appendValue(QByteArray *out, T value)
+{
+    char buffer[sizeof(T)];
+    qToLittleEndian<T>(value, buffer);
+    out->append(buffer, int(sizeof(T)));
+}
+
+template <typename T> static T readValue(const uchar *data, quint64 offset)
+{
+    return qFromLittleEndian<T>(data + offset);
+}
+
+/*!
+    \internal
+
+    Returns the snapshot of the group address information, keyed by \a key.
+*/
+QByteArray QKnxGroupAddressInfosPrivate::toSnapshot(const KnxSnapshotKey &key) const
+{
+    QByteArray projectTable, installationTable, infoTable, stringTable;
+
+    QHash<QString, quint32> stringOffsets;
+    const auto intern = [&stringOffsets, &stringTable](const QString &string) -> quint32 {
+        const auto it = stringOffsets.constFind(string);
+        if (it != stringOffsets.constEnd())
+            return it.value();
+
+        const auto offset = quint32(stringTable.size());
+        appendValue<quint32>(&stringTable, quint32(string.size()));
+        const auto begin = stringTable.size();
+        stringTable.resize(begin + string.size() * 2);
+        qToLittleEndian<quint16>(string.utf16(), string.size(), stringTable.data() + begin);
+        stringTable.append((4 - stringTable.size() % 4) % 4, '\0');
+        stringOffsets.insert(string, offset);
+        return offset;
+    };
+
+    quint32 installationCount = 0, infoCount = 0;
+
+    auto projectIds = projects.keys();
+    std::sort(projectIds.begin(), projectIds.end());
+    for (const auto &projectId : qAsConst(projectIds)) {
+        const auto project = projects.value(projectId);
+        appendValue<quint32>(&projectTable, intern(projectId));
+        appendValue<quint32>(&projectTable, intern(project.name));
+        appendValue<quint32>(&projectTable, installationCount);
+        appendValue<quint32>(&projectTable, quint32(project.installations.size()));
+
+        auto names = project.installations.keys();
+        std::sort(names.begin(), names.end());
+        for (const auto &name : qAsConst(names)) {
+            const auto infos = project.installations.value(name).infos;
+            appendValue<quint32>(&installationTable, intern(name));
+            appendValue<quint32>(&installationTable, infoCount);
+            appendValue<quint32>(&installationTable, quint32(infos.size()));
+
+            for (const auto &info : infos) {
+                const auto address = info.address();
+                appendValue<quint32>(&infoTable, intern(info.name()));
+                appendValue<quint32>(&infoTable, intern(info.description()));
+                appendValue<quint32>(&infoTable, quint32(info.datapointType()));
+                appendValue<quint16>(&infoTable, address.toUInt16());
+                appendValue<quint8>(&infoTable, address.isValid() ? quint8(address.type()) + 1 : 0);
+                appendValue<quint8>(&infoTable, 0);
+            }
+            infoCount += quint32(infos.size());
+        }
+        installationCount += quint32(names.size());
+    }
+
+    QByteArray snapshot(SnapshotMagic, int(sizeof(SnapshotMagic)));
+    appendValue<quint32>(&snapshot, SnapshotVersion);
+    appendValue<quint32>(&snapshot, quint32(projectIds.size()));
+    appendValue<quint32>(&snapshot, installationCount);
+    appendValue<quint32>(&snapshot, infoCount);
+    appendValue<quint32>(&snapshot, quint32(stringTable.size()));
+    appendValue<quint32>(&snapshot, 0);
+    appendValue<quint64>(&snapshot, key.size);
+    appendValue<qint64>(&snapshot, key.lastModified);
+    snapshot.append(key.sha1);
+    appendValue<quint32>(&snapshot, 0);
+
+    return snapshot + projectTable + installationTable + infoTable + stringTable;
+}
+
+/*!
+    \internal
+
+    Reads the group address information from the snapshot of \a size bytes
+    pointed to by \a data. Returns \c false and leaves the current information
+    untouched if the snapshot is malformed, was written by an incompatible
+    version, or was not created from the project file identified by \a key.
+*/
+bool QKnxGroupAddressInfosPrivate::fromSnapshot(const uchar *data, qint64 size,
+    const KnxSnapshotKey &key)
+{
+    if (!data || size < qint64(SnapshotHeaderSize)
+        || memcmp(data, SnapshotMagic, sizeof(SnapshotMagic)) != 0
+        || readValue<quint32>(data, 8) != SnapshotVersion) {
+        return false;
+    }
+
+    if (readValue<quint64>(data, 32) != key.size
+        || readValue<qint64>(data, 40) != key.lastModified
+        || key.sha1.size() != 20 || memcmp(data + 48, key.sha1.constData(), 20) != 0) {
+        return false; // the project file changed since the snapshot was written
+    }
+
+    const quint64 projectCount = readValue<quint32>(data, 12);
+    const quint64 installationCount = readValue<quint32>(data, 16);
+    const quint64 infoCount = readValue<quint32>(data, 20);
+    const quint64 stringTableSize = readValue<quint32>(data, 24);
+
+    const auto installationsBegin = SnapshotHeaderSize + projectCount * SnapshotProjectSize;
+    const auto infosBegin = installationsBegin + installationCount * SnapshotInstallationSize;
+    const auto stringsBegin = infosBegin + infoCount * SnapshotInfoSize;
+    if (stringsBegin + stringTableSize != quint64(size))
+        return false;
+
+    // Every string is copied once, records sharing a string share its data.
+    QHash<quint32, QString> strings;
+    for (quint64 offset = 0; offset < stringTableSize;) {
+        if (stringTableSize - offset < 4)
+            return false;
+        const quint64 length = readValue<quint32>(data, stringsBegin + offset);
+        if (length * 2 > stringTableSize - offset - 4)
+            return false;
+        QString string(int(length), Qt::Uninitialized);
+        qFromLittleEndian<quint16>(data + stringsBegin + offset + 4, qsizetype(length),
+            string.data());
+        strings.insert(quint32(offset), string);
+        offset += (4 + length * 2 + 3) & ~quint64(3);
+    }
+
+    bool ok = true;
+    const auto string = [&ok, &strings, data](quint64 offset) -> QString {
+        const auto it = strings.constFind(readValue<quint32>(data, offset));
+        if (it != strings.constEnd())
+            return it.value();
+        ok = false;
+        return {};
+    };
+
+    QHash<QString, KnxProjectInfo> snapshot;
+    for (quint64 i = 0; i < projectCount; ++i) {
+        const auto project = SnapshotHeaderSize + i * SnapshotProjectSize;
+        const auto projectId = string(project);
+        KnxProjectInfo projectInfo { string(project + 4), {} };
+
+        const quint64 firstInstallation = readValue<quint32>(data, project + 8);
+        const quint64 installations = readValue<quint32>(data, project + 12);
+        if (firstInstallation + installations > installationCount)
+            return false;
+
+        for (auto j = firstInstallation; j < firstInstallation + installations; ++j) {
+            const auto installation = installationsBegin + j * SnapshotInstallationSize;
+            const auto name = string(installation);
+
+            const quint64 firstInfo = readValue<quint32>(data, installation + 4);
+            const quint64 infos = readValue<quint32>(data, installation + 8);
+            if (firstInfo + infos > infoCount)
+                return false;
+
+            // The indexes are derived from the infos and rebuilt while appending.
+            KnxInstallationInfo installationInfo;
+            installationInfo.infos.reserve(int(infos));
+            for (auto k = firstInfo; k < firstInfo + infos; ++k) {
+                const auto info = infosBegin + k * SnapshotInfoSize;
+                const quint8 kind = data[info + 14];
+                if (kind > quint8(QKnxAddress::Type::Group) + 1)
+                    return false;
+                const auto address = (kind == 0) ? QKnxAddress()
+                    : QKnxAddress(QKnxAddress::Type(kind - 1), readValue<quint16>(data, info + 12));
+                installationInfo.append({ name, string(info), address,
+                    QKnxDatapointType::Type(readValue<quint32>(data, info + 8)),
+                    string(info + 4) });
+            }
+            projectInfo.installations.insert(name, installationInfo);
+        }
+        snapshot.insert(projectId, projectInfo);
+    }
+
+    if (!ok)
+        return false;
+    projects = snapshot;
+    return true;
+}
+
 
 /*!
     \class QKnxGroupAddressInfos
@@ -187,6 +787,8 @@ QList<QKnxGroupAddressInfo>
             an installation inside a given KNX project.
         \li Fetch and set group address information for an installation
             associated with a KNX project.
+        \li Save the information to a snapshot file that is read considerably
+            faster than the project file on the next start.
     \endlist
 */
 
@@ -203,6 +805,24 @@ QList<QKnxGroupAddressInfo>
     \sa parse()
 */
 
+/*!
+    \enum QKnxGroupAddressInfos::ParseMode
+    \since 6.2
+
+    This enum describes how the KNX project file is parsed.
+
+    \value Validating
+        The complete project tree is built and validated before the group
+        address information is extracted. This is the default.
+    \value Streaming
+        The group address information is extracted while reading the project
+        file, without building the project tree. Compressed project files are
+        inflated on demand using a fixed size buffer. Only the elements that
+        are needed to extract the group address information are validated.
+
+    \sa parse()
+*/
+
 /*!
     Creates a new empty group address infos object.
 */
@@ -273,8 +893,55 @@ static bool isZipFile(QFile *file)
 
     Returns \c true if parsing was successful; otherwise returns \c false. If
     an error occurs, sets the \l Status, and fills the errorString().
+
+    This is the same as calling parse() with \l ParseMode::Validating.
 */
 bool QKnxGroupAddressInfos::parse()
+{
+    return parse(ParseMode::Validating);
+}
+
+/*!
+    \internal
+
+    Returns the sorted paths of the \c 0.xml project files listed in
+    \a fileInfos. If \a projectId is not empty and a project file is stored
+    in a folder of that name, only this file is returned.
+*/
+static QStringList projectFiles(const QList<QZipReader::FileInfo> &fileInfos,
+    const QString &projectId)
+{
+    QStringList files, matching;
+    for (const auto &fileInfo : fileInfos) {
+        const auto &path = fileInfo.filePath;
+        if (path.mid(path.lastIndexOf(QLatin1Char('/'), -5) + 1) != QLatin1String("0.xml"))
+            continue;
+        files.append(path);
+        if (!projectId.isEmpty() && path.section(QLatin1Char('/'), -2, -2) == projectId)
+            matching.append(path);
+    }
+    files = matching.isEmpty() ? files : matching;
+    files.removeDuplicates();
+    files.sort();
+    return files;
+}
+
+/*!
+    \since 6.2
+
+    Clears all existing information and parses the KNX project file using the
+    given parse \a mode. If \a projectId is not empty, only the project with
+    this ID is read, and parsing fails with \l Status::ProjectError if the
+    project file does not contain it.
+
+    If the project file is an archive that contains more than one project,
+    the projects are read in parallel. The result does not depend on the order
+    in which the projects finish reading.
+
+    Returns \c true if parsing was successful; otherwise returns \c false. If
+    an error occurs, sets the \l Status, and fills the errorString().
+*/
+bool QKnxGroupAddressInfos::parse(ParseMode mode, const QString &projectId)
 {
     auto tmp = d_ptr->projectFile;
     clear();
@@ -287,44 +954,65 @@ bool QKnxGroupAddressInfos::parse()
         return false;
     }
 
-    if (!isZipFile(&file))
-        return d_ptr->parseData(file.readAll());
+    // Key a later snapshot to the content that is actually going to be parsed.
+    if (!d_ptr->snapshotKey.read(&file)) {
+        d_ptr->snapshotKey = {};
+        d_ptr->status = Status::FileError;
+        d_ptr->errorString = file.errorString();
+        return false;
+    }
 
-    QSet<QString> files;
-    QZipReader zipReader(&file);
-    const auto fileInfos = zipReader.fileInfoList();
-    for (const auto &fileInfo : qAsConst(fileInfos)) {
-        auto file = fileInfo.filePath;
-        file = file.mid(file.lastIndexOf(QLatin1Char('/'), -5) + 1);
-        if (file == QStringLiteral("0.xml"))
-            files.insert(fileInfo.filePath);
+    const bool streaming = (mode == ParseMode::Streaming);
+    if (!isZipFile(&file)) {
+        if (!(streaming ? d_ptr->streamData(&file) : d_ptr->parseData(file.readAll())))
+            return false;
+        return d_ptr->selectProject(projectId);
     }
 
+    // Listing the archive only reads its central directory, so the archive is
+    // mapped only once it is known which reader is going to read the projects.
+    QZipReader zipReader(&file);
+    const auto files = projectFiles(zipReader.fileInfoList(), projectId);
     if (files.isEmpty())
         return d_ptr->parseData({});
 
-    for (auto file : qAsConst(files)) {
-        if (d_ptr->parseData(zipReader.fileData(file))) {
-            const auto data = zipReader.fileData(file.replace(QStringLiteral("0.xml"),
-                QStringLiteral("project.xml")));
-
-            QXmlStreamReader r(data);
-            if (r.hasError() || !r.readNextStartElement() || r.name() != QStringLiteral("KNX"))
-                continue;
-
-            QKnxProjectRoot root;
-            if (!root.parseElement(&r, true))
-                continue;
-            for (const auto &project : qAsConst(root.Project)) {
-                if (d_ptr->projects.contains(project.Id))
-                    d_ptr->projects[project.Id].name = project.ProjectInformation.value(0).Name;
-            }
-        } else {
-            d_ptr->projects.clear();
-            return false;
+    // Every project is read into its own private object, with more than one
+    // project on a thread pool, each with its own handle to the archive. The
+    // results are merged in the order of the sorted file names afterwards.
+    QVector<QKnxGroupAddressInfosPrivate> results(files.size());
+    if (files.size() < 2) {
+        zipReader.setReadMode(QZipReader::MemoryMapped); // stays buffered if mapping fails
+        results[0].readArchiveProject(&zipReader, files.at(0), streaming);
+    } else {
+        zipReader.close(); // releases the file, the workers open and map their own
+
+        auto data = results.data();
+        const auto projectFile = d_ptr->projectFile;
+
+        QThreadPool pool;
+        for (int i = 0; i < files.size(); ++i) {
+            pool.start([data, i, &files, &projectFile, streaming]() {
+                QFile archive(projectFile);
+                if (!archive.open(QIODevice::ReadOnly)) {
+                    data[i].status = Status::FileError;
+                    data[i].errorString = archive.errorString();
+                    return;
+                }
+                QZipReader reader(&archive);
+                reader.setReadMode(QZipReader::MemoryMapped);
+                data[i].readArchiveProject(&reader, files.at(i), streaming);
+            });
         }
+        pool.waitForDone();
     }
-    return true;
+
+    for (const auto &result : qAsConst(results)) {
+        if (d_ptr->merge(result))
+            continue;
+        d_ptr->projects.clear();
+        return false;
+    }
+    return d_ptr->selectProject(projectId);
 }
 
 /*!
@@ -335,9 +1023,83 @@ void QKnxGroupAddressInfos::clear()
     d_ptr->projects.clear();
     d_ptr->projectFile.clear();
     d_ptr->errorString.clear();
+    d_ptr->snapshotKey = {};
     d_ptr->status = QKnxGroupAddressInfos::Status::NoError;
 }
 
+/*!
+    \since 6.2
+
+    Writes the group address information to the snapshot file \a fileName.
+    The snapshot is keyed by the size, the last modification time, and the
+    SHA-1 hash the project file had when it was parsed, so that loadSnapshot()
+    can detect an outdated snapshot.
+
+    Returns \c true if the snapshot was written; otherwise returns \c false.
+    Nothing is written unless the information was read by a successful call
+    to parse() or loadSnapshot().
+
+    \sa loadSnapshot()
+*/
+bool QKnxGroupAddressInfos::saveSnapshot(const QString &fileName) const
+{
+    if (d_ptr->status != Status::NoError || !d_ptr->snapshotKey.isValid())
+        return false;
+
+    QSaveFile file(fileName);
+    if (!file.open(QIODevice::WriteOnly))
+        return false;
+
+    const auto snapshot = d_ptr->toSnapshot(d_ptr->snapshotKey);
+    if (file.write(snapshot) != snapshot.size())
+        return false;
+    return file.commit();
+}
+
+/*!
+    \since 6.2
+
+    Replaces the group address information with the content of the snapshot
+    file \a fileName previously written by saveSnapshot(). The snapshot file
+    is memory mapped if possible, so that neither the project file needs to
+    be inflated nor its XML content parsed.
+
+    Returns \c true if the snapshot was read; otherwise returns \c false and
+    leaves the current information untouched. This happens if the snapshot
+    file cannot be read, is malformed, was written by an incompatible version,
+    or was not created from the current project file in its current state. In
+    that case, call parse() and saveSnapshot() to renew the snapshot.
+
+    \sa saveSnapshot(), parse()
+*/
+bool QKnxGroupAddressInfos::loadSnapshot(const QString &fileName)
+{
+    KnxSnapshotKey key;
+    if (!key.read(d_ptr->projectFile))
+        return false;
+
+    QFile file(fileName);
+    if (!file.open(QIODevice::ReadOnly))
+        return false;
+
+    QByteArray buffer;
+    auto size = file.size();
+    const uchar *data = file.map(0, size);
+    if (!data) {
+        buffer = file.readAll(); // the file system does not support mapping
+        data = reinterpret_cast<const uchar *>(buffer.constData());
+        size = buffer.size();
+    }
+
+    if (!d_ptr->fromSnapshot(data, size, key))
+        return false;
+
+    d_ptr->snapshotKey = key;
+    d_ptr->errorString.clear();
+    d_ptr->status = Status::NoError;
+    return true;
+}
+
 /*!
     Returns the read status of the current KNX project file.
 */
@@ -386,13 +1148,8 @@ QList<QString> QKnxGroupAddressInfos::installations(const QString &projectId) co
 */
 qint32 QKnxGroupAddressInfos::infoCount(const QString &projectId, const QString &installation) const
 {
-    const auto installations = d_ptr->projects.value(projectId, { QString(), {} }).installations;
-    if (installations.isEmpty())
-        return -1;
-
-    if (!installations.contains(installation))
-        return -1;
-    return installations.value(installation).count();
+    const auto installationInfo = d_ptr->installation(projectId, installation);
+    return installationInfo ? installationInfo->infos.count() : -1;
 }
 
 /*!
@@ -404,45 +1161,42 @@ QList<QKnxGroupAddressInfo> QKnxGroupAddressInfos::addressInfos(const QString &p
 {
     if (projectId.isEmpty())
         return {};
-    return d_ptr->projects.value(projectId, { QString(), {} }).installations.value(installation);
+    const auto installationInfo = d_ptr->installation(projectId, installation);
+    return installationInfo ? installationInfo->infos : QList<QKnxGroupAddressInfo>();
 }
 
 /*!
     Returns a list of all available group address infos from a KNX project
     identified by \a address, \a projectId, and \a installation.
+
+    The group address infos are indexed when they are added, so the lookup does
+    not depend on the number of group address infos inside the installation.
 */
 QList<QKnxGroupAddressInfo> QKnxGroupAddressInfos::addressInfos(const QKnxAddress &address,
     const QString &projectId, const QString &installation) const
 {
-    const auto infos = addressInfos(projectId, installation);
-    if (infos.isEmpty())
+    if (projectId.isEmpty())
         return {};
-
-    QList<QKnxGroupAddressInfo> results;
-    for (const auto &info : qAsConst(infos)) {
-        if (info.address() == address)
-            results.append(info);
-    }
-    return results;
+    const auto installationInfo = d_ptr->installation(projectId, installation);
+    return installationInfo ? installationInfo->byAddress.value(address)
+        : QList<QKnxGroupAddressInfo>();
 }
 
 /*!
     Returns a list of all available group address infos from a KNX project
     identified by datapoint \a type, \a projectId and \a installation.
+
+    The group address infos are indexed when they are added, so the lookup does
+    not depend on the number of group address infos inside the installation.
 */
 QList<QKnxGroupAddressInfo> QKnxGroupAddressInfos::addressInfos(QKnxDatapointType::Type type,
          const QString &projectId, const QString &installation) const
 {
-    const auto infos = addressInfos(projectId, installation);
-    if (infos.isEmpty())
+    if (projectId.isEmpty())
         return {};
-
-    QList<QKnxGroupAddressInfo> results;
-    for (const auto &info : qAsConst(infos)) {
-        if (info.datapointType() == type)
-            results.append(info);
-    }
-    return results;
+    const auto installationInfo = d_ptr->installation(projectId, installation);
+    return installationInfo ? installationInfo->byType.value(quint32(type))
+        : QList<QKnxGroupAddressInfo>();
 }
 
 /*!
@@ -508,12 +1262,7 @@ void QKnxGroupAddressInfos::remove(const QKnxAddress &address, const QString &pr
     if (!address.isValid() || projectId.isEmpty() || !d_ptr->projects.contains(projectId))
         return;
 
-    auto &installations = d_ptr->projects[projectId].installations;
-    auto &value = installations[installation];
-    for (qint32 count = value.count(); count --> 0;) {
-        if (value[count].address() == address)
-            value.remove(count);
-    }
+    d_ptr->projects[projectId].installations[installation].remove(address);
 }
 
 /*!
@@ -529,12 +1278,7 @@ void QKnxGroupAddressInfos::remove(const QKnxGroupAddressInfo &info, const QStri
     if (projectId.isEmpty() || !d_ptr->projects.contains(projectId))
         return;
 
-    auto &installations = d_ptr->projects[projectId].installations;
-    auto &value = installations[info.installation()];
-    for (qint32 count = value.count(); count-- > 0;) {
-        if (value[count] == info)
-            value.remove(count);
-    }
+    d_ptr->projects[projectId].installations[info.installation()].remove(info);
 }
 
 /*!
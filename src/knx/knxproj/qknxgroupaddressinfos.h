@@ -50,6 +50,12 @@ public:
         ParseError
     };
 
+    enum class ParseMode : quint8
+    {
+        Validating,
+        Streaming
+    };
+
     QKnxGroupAddressInfos();
     ~QKnxGroupAddressInfos();
 
@@ -59,8 +65,12 @@ public:
     void setProjectFile(const QString &projectFile);
 
     bool parse();
+    bool parse(ParseMode mode, const QString &projectId = {});
     void clear();
 
+    bool saveSnapshot(const QString &fileName) const;
+    bool loadSnapshot(const QString &fileName);
+
     Status status() const;
     QString errorString() const;
 
@@ -46,9 +46,12 @@
 #include <qendian.h>
 #include <qdebug.h>
 #include <qdir.h>
+#include <qhash.h>
 
 #include <zlib.h>
 
+#include <limits>
+
 // Zip standard version for archives handled by this API
 // (actually, the only basic support of this version is implemented but it is enough for now)
 #define ZIP_VERSION 20
@@ -516,9 +519,31 @@ public:
     {
     }
 
+    ~QZipReaderPrivate()
+    {
+        unmap();
+    }
+
+    struct Entry
+    {
+        qint64 offset = 0;
+        qint64 compressedSize = 0;
+        qint64 uncompressedSize = 0;
+        bool deflated = false;
+    };
+
     void scanFiles();
+    int indexOf(const QString &fileName);
+    bool locate(int index, Entry *entry);
+    QByteArray read(qint64 offset, qint64 size);
+
+    bool map();
+    void unmap();
 
     QZipReader::Status status;
+    QHash<QString, int> fileIndex;
+    const uchar *mapped = nullptr;
+    qint64 mappedSize = 0;
 };
 
 class QZipWriterPrivate : public QZipPrivate
@@ -573,78 +598,343 @@ void QZipReaderPrivate::scanFiles()
     }
 
     dirtyFileTree = false;
-    uchar tmp[4];
-    device->read((char *)tmp, 4);
-    if (readUInt(tmp) != 0x04034b50) {
+    const QByteArray signature = read(0, 4);
+    if (signature.size() != 4 || readUInt((const uchar *)signature.constData()) != 0x04034b50) {
         qWarning("QZip: not a zip file!");
         return;
     }
 
-    // find EndOfDirectory header
+    // find EndOfDirectory header, it can be followed by a comment of up to 65535 bytes
+    const qint64 size = mapped ? mappedSize : device->size();
+    const QByteArray tail = read(size - qMin<qint64>(size, sizeof(EndOfDirectory) + 65535),
+        sizeof(EndOfDirectory) + 65535);
     int i = 0;
-    int start_of_directory = -1;
-    int num_dir_entries = 0;
     EndOfDirectory eod;
-    while (start_of_directory == -1) {
-        const int pos = device->size() - int(sizeof(EndOfDirectory)) - i;
+    while (true) {
+        const int pos = tail.size() - int(sizeof(EndOfDirectory)) - i;
         if (pos < 0 || i > 65535) {
             qWarning("QZip: EndOfDirectory not found");
             return;
         }
 
-        device->seek(pos);
-        device->read((char *)&eod, sizeof(EndOfDirectory));
-        if (readUInt(eod.signature) == 0x06054b50)
+        if (readUInt((const uchar *)tail.constData() + pos) == 0x06054b50) {
+            memcpy(&eod, tail.constData() + pos, sizeof(EndOfDirectory));
             break;
+        }
         ++i;
     }
 
     // have the eod
     start_of_directory = readUInt(eod.dir_start_offset);
-    num_dir_entries = readUShort(eod.num_dir_entries);
+    const int num_dir_entries = readUShort(eod.num_dir_entries);
     ZDEBUG("start_of_directory at %d, num_dir_entries=%d", start_of_directory, num_dir_entries);
     int comment_length = readUShort(eod.comment_length);
     if (comment_length != i)
         qWarning("QZip: failed to parse zip file.");
-    comment = device->read(qMin(comment_length, i));
+    comment = tail.mid(tail.size() - i, qMin(comment_length, i));
+
+    // read the central directory at once and index the entries by name
+    const QByteArray directory = read(start_of_directory, qMax<qint64>(0, size - start_of_directory));
+    int offset = 0;
+    const auto readField = [&directory, &offset](const uchar *length, QByteArray *field) {
+        const int l = readUShort(length);
+        if (directory.size() - offset < l)
+            return false;
+        *field = directory.mid(offset, l);
+        offset += l;
+        return true;
+    };
 
-    device->seek(start_of_directory);
+    fileHeaders.reserve(num_dir_entries);
+    fileIndex.reserve(num_dir_entries);
     for (i = 0; i < num_dir_entries; ++i) {
         FileHeader header;
-        int read = device->read((char *) &header.h, sizeof(CentralFileHeader));
-        if (read < (int)sizeof(CentralFileHeader)) {
+        if (directory.size() - offset < int(sizeof(CentralFileHeader))) {
             qWarning("QZip: Failed to read complete header, index may be incomplete");
             break;
         }
+        memcpy(&header.h, directory.constData() + offset, sizeof(CentralFileHeader));
+        offset += int(sizeof(CentralFileHeader));
         if (readUInt(header.h.signature) != 0x02014b50) {
             qWarning("QZip: invalid header signature, index may be incomplete");
             break;
         }
 
-        int l = readUShort(header.h.file_name_length);
-        header.file_name = device->read(l);
-        if (header.file_name.length() != l) {
+        if (!readField(header.h.file_name_length, &header.file_name)) {
             qWarning("QZip: Failed to read filename from zip index, index may be incomplete");
             break;
         }
-        l = readUShort(header.h.extra_field_length);
-        header.extra_field = device->read(l);
-        if (header.extra_field.length() != l) {
+        if (!readField(header.h.extra_field_length, &header.extra_field)) {
             qWarning("QZip: Failed to read extra field in zip file, skipping file, index may be incomplete");
             break;
         }
-        l = readUShort(header.h.file_comment_length);
-        header.file_comment = device->read(l);
-        if (header.file_comment.length() != l) {
+        if (!readField(header.h.file_comment_length, &header.file_comment)) {
             qWarning("QZip: Failed to read read file comment, index may be incomplete");
             break;
         }
 
         ZDEBUG("found file '%s'", header.file_name.data());
+        const bool inUtf8 = (readUShort(header.h.general_purpose_bits) & Utf8Names) != 0;
+        const QString fileName = inUtf8 ? QString::fromUtf8(header.file_name)
+                                        : QString::fromLocal8Bit(header.file_name);
+        if (!fileIndex.contains(fileName)) // the first entry wins, as with a linear search
+            fileIndex.insert(fileName, fileHeaders.size());
         fileHeaders.append(header);
     }
 }
 
+int QZipReaderPrivate::indexOf(const QString &fileName)
+{
+    scanFiles();
+    return fileIndex.value(fileName, -1);
+}
+
+/*
+    Fills \a entry with the position and sizes of the data of the file at
+    \a index. Returns \c false if the file cannot be extracted.
+*/
+bool QZipReaderPrivate::locate(int index, Entry *entry)
+{
+    if (index < 0 || index >= fileHeaders.size())
+        return false;
+
+    const FileHeader &header = fileHeaders.at(index);
+    const ushort version_needed = readUShort(header.h.version_needed);
+    if (version_needed > ZIP_VERSION) {
+        qWarning("QZip: .ZIP specification version %d implementationis needed to extract the data.", version_needed);
+        return false;
+    }
+
+    if ((readUShort(header.h.general_purpose_bits) & Encrypted) != 0) {
+        qWarning("QZip: Unsupported encryption method is needed to extract the data.");
+        return false;
+    }
+
+    const qint64 start = readUInt(header.h.offset_local_header);
+    const QByteArray localHeader = read(start, sizeof(LocalFileHeader));
+    if (localHeader.size() != int(sizeof(LocalFileHeader)))
+        return false;
+
+    LocalFileHeader lh;
+    memcpy(&lh, localHeader.constData(), sizeof(LocalFileHeader));
+    const int compression_method = readUShort(lh.compression_method);
+    if (compression_method != CompressionMethodStored
+        && compression_method != CompressionMethodDeflated) {
+        qWarning("QZip: Unsupported compression method %d is needed to extract the data.", compression_method);
+        return false;
+    }
+
+    entry->offset = start + qint64(sizeof(LocalFileHeader)) + readUShort(lh.file_name_length)
+        + readUShort(lh.extra_field_length);
+    entry->compressedSize = readUInt(header.h.compressed_size);
+    entry->uncompressedSize = readUInt(header.h.uncompressed_size);
+    entry->deflated = (compression_method == CompressionMethodDeflated);
+
+    if (mapped && entry->offset + entry->compressedSize > mappedSize) {
+        qWarning("QZip: Compressed data exceeds the size of the zip file.");
+        return false;
+    }
+    return true;
+}
+
+/*
+    Returns up to \a size bytes starting at \a offset, from the memory mapped
+    file if available, otherwise from the device.
+*/
+QByteArray QZipReaderPrivate::read(qint64 offset, qint64 size)
+{
+    if (mapped) {
+        if (offset < 0 || offset >= mappedSize)
+            return QByteArray();
+        return QByteArray((const char *)mapped + offset, int(qMin(size, mappedSize - offset)));
+    }
+
+    if (!device->seek(offset))
+        return QByteArray();
+    return device->read(size);
+}
+
+/*
+    Maps the whole zip file into memory if the device is a file. Returns
+    \c true on success; otherwise returns \c false.
+*/
+bool QZipReaderPrivate::map()
+{
+    if (mapped)
+        return true;
+
+    QFile *file = qobject_cast<QFile *>(device);
+    if (!file || !(file->isOpen() || file->open(QIODevice::ReadOnly)))
+        return false;
+
+    mappedSize = file->size();
+    mapped = file->map(0, mappedSize);
+    if (!mapped)
+        mappedSize = 0;
+    return mapped != nullptr;
+}
+
+void QZipReaderPrivate::unmap()
+{
+    if (QFile *file = qobject_cast<QFile *>(device)) {
+        if (mapped)
+            file->unmap(const_cast<uchar *>(mapped));
+    }
+    mapped = nullptr;
+    mappedSize = 0;
+}
+
+/*
+    Sequential device returning the uncompressed content of a single zip
+    entry. The compressed data is read from the archive device and inflated
+    in chunks of ChunkSize bytes, so only a bounded amount of memory is used
+    independent of the entry size. If the archive is memory mapped, the data
+    is read from the mapping instead and the archive device is not touched.
+*/
+class QZipEntryDevice final : public QIODevice
+{
+public:
+    enum { ChunkSize = 16 * 1024 };
+
+    QZipEntryDevice(QIODevice *archive, const uchar *mapped, qint64 offset,
+            qint64 compressedSize, qint64 uncompressedSize, bool deflated)
+        : m_archive(archive)
+        , m_mapped(mapped)
+        , m_offset(offset)
+        , m_compressedSize(compressedSize)
+        , m_uncompressedSize(uncompressedSize)
+        , m_deflated(deflated)
+    {
+        memset(&m_stream, 0, sizeof(z_stream));
+    }
+
+    ~QZipEntryDevice() override
+    {
+        close();
+    }
+
+    bool open(OpenMode mode) override
+    {
+        if ((mode & ~QIODevice::Text) != QIODevice::ReadOnly)
+            return false;
+
+        m_read = 0;
+        m_written = 0;
+        m_finished = false;
+        if (m_deflated) {
+            if (!m_mapped)
+                m_input.resize(ChunkSize);
+            memset(&m_stream, 0, sizeof(z_stream));
+            if (inflateInit2(&m_stream, -MAX_WBITS) != Z_OK)
+                return false;
+            m_initialized = true;
+        }
+        return QIODevice::open(mode);
+    }
+
+    void close() override
+    {
+        if (m_initialized)
+            inflateEnd(&m_stream);
+        m_initialized = false;
+        m_input.clear();
+        QIODevice::close();
+    }
+
+    bool isSequential() const override { return true; }
+    qint64 size() const override { return m_uncompressedSize; }
+
+    qint64 bytesAvailable() const override
+    {
+        return m_uncompressedSize - m_written + QIODevice::bytesAvailable();
+    }
+
+protected:
+    qint64 readData(char *data, qint64 maxSize) override
+    {
+        if (!m_deflated) {
+            const qint64 size = qMin(maxSize, m_compressedSize - m_read);
+            if (size <= 0)
+                return 0;
+            if (m_mapped) {
+                memcpy(data, m_mapped + m_offset + m_read, size);
+                m_read += size;
+                m_written += size;
+                return size;
+            }
+            if (!m_archive->seek(m_offset + m_read))
+                return -1;
+            const qint64 read = m_archive->read(data, size);
+            if (read > 0) {
+                m_read += read;
+                m_written += read;
+            }
+            return read;
+        }
+
+        if (m_finished || maxSize <= 0)
+            return 0;
+
+        m_stream.next_out = reinterpret_cast<Bytef *>(data);
+        m_stream.avail_out = uInt(qMin<qint64>(maxSize, std::numeric_limits<uInt>::max()));
+        while (m_stream.avail_out > 0) {
+            if (m_stream.avail_in == 0 && m_mapped) {
+                const qint64 size = qMin<qint64>(std::numeric_limits<uInt>::max(),
+                    m_compressedSize - m_read);
+                if (size <= 0)
+                    break;
+                m_stream.next_in = const_cast<Bytef *>(m_mapped + m_offset + m_read);
+                m_stream.avail_in = uInt(size);
+                m_read += size;
+            } else if (m_stream.avail_in == 0) {
+                const qint64 size = qMin<qint64>(ChunkSize, m_compressedSize - m_read);
+                if (size <= 0 || !m_archive->seek(m_offset + m_read))
+                    break;
+                const qint64 read = m_archive->read(m_input.data(), size);
+                if (read <= 0)
+                    break;
+                m_read += read;
+                m_stream.next_in = reinterpret_cast<Bytef *>(m_input.data());
+                m_stream.avail_in = uInt(read);
+            }
+
+            const int result = inflate(&m_stream, Z_NO_FLUSH);
+            if (result == Z_STREAM_END) {
+                m_finished = true;
+                break;
+            }
+            if (result != Z_OK && result != Z_BUF_ERROR) {
+                qWarning("QZip: Failed to inflate, input data is corrupted");
+                setErrorString(QStringLiteral("Input data is corrupted"));
+                return -1;
+            }
+        }
+
+        const qint64 produced = qint64(reinterpret_cast<char *>(m_stream.next_out) - data);
+        m_written += produced;
+        return produced;
+    }
+
+    qint64 writeData(const char *, qint64) override
+    {
+        return -1;
+    }
+
+private:
+    QIODevice *m_archive { nullptr };
+    const uchar *m_mapped { nullptr };
+    qint64 m_offset { 0 };
+    qint64 m_compressedSize { 0 };
+    qint64 m_uncompressedSize { 0 };
+    qint64 m_read { 0 };
+    qint64 m_written { 0 };
+    bool m_deflated { false };
+    bool m_finished { false };
+    bool m_initialized { false };
+    QByteArray m_input;
+    z_stream m_stream;
+};
+
 void QZipWriterPrivate::addEntry(EntryType type, const QString &fileName, const QByteArray &contents/*, QFile::Permissions permissions, QZip::Method m*/)
 {
 #ifndef NDEBUG
@@ -931,85 +1221,122 @@ QZipReader::FileInfo QZipReader::entryInfoAt(int index) const
 
 /*!
     Fetch the file contents from the zip archive and return the uncompressed bytes.
+
+    The file is looked up in an index built once from the central directory
+    and inflated in one pass into a buffer of the uncompressed size recorded
+    in the archive.
 */
 QByteArray QZipReader::fileData(const QString &fileName) const
 {
-    d->scanFiles();
-    int i;
-    for (i = 0; i < d->fileHeaders.size(); ++i) {
-        if (QString::fromLocal8Bit(d->fileHeaders.at(i).file_name) == fileName)
-            break;
-    }
-    if (i == d->fileHeaders.size())
+    QZipReaderPrivate::Entry entry;
+    if (!d->locate(d->indexOf(fileName), &entry))
         return QByteArray();
 
-    FileHeader header = d->fileHeaders.at(i);
+    //qDebug("file=%s: compressed_size=%lld, uncompressed_size=%lld", fileName.toLocal8Bit().data(), entry.compressedSize, entry.uncompressedSize);
+    if (!entry.deflated) {
+        // no compression
+        return d->read(entry.offset, qMin(entry.compressedSize, entry.uncompressedSize));
+    }
 
-    ushort version_needed = readUShort(header.h.version_needed);
-    if (version_needed > ZIP_VERSION) {
-        qWarning("QZip: .ZIP specification version %d implementationis needed to extract the data.", version_needed);
-        return QByteArray();
+    QByteArray compressed;
+    const uchar *source = d->mapped ? d->mapped + entry.offset : nullptr;
+    qint64 source_size = entry.compressedSize;
+    if (!source) {
+        compressed = d->read(entry.offset, entry.compressedSize);
+        source = (const uchar *)compressed.constData();
+        source_size = compressed.size();
     }
 
-    ushort general_purpose_bits = readUShort(header.h.general_purpose_bits);
-    int compressed_size = readUInt(header.h.compressed_size);
-    int uncompressed_size = readUInt(header.h.uncompressed_size);
-    int start = readUInt(header.h.offset_local_header);
-    //qDebug("uncompressing file %d: local header at %d", i, start);
+    QByteArray baunzip(int(qMax<qint64>(entry.uncompressedSize, 1)), Qt::Uninitialized);
+    ulong len = ulong(baunzip.size());
+    const int res = inflate((uchar *)baunzip.data(), &len, source, ulong(source_size));
+    if (res == Z_BUF_ERROR) {
+        // the recorded uncompressed size is too small, inflate on demand instead
+        QZipEntryDevice device(d->device, d->mapped, entry.offset, entry.compressedSize,
+            entry.uncompressedSize, true);
+        return device.open(QIODevice::ReadOnly) ? device.readAll() : QByteArray();
+    }
 
-    d->device->seek(start);
-    LocalFileHeader lh;
-    d->device->read((char *)&lh, sizeof(LocalFileHeader));
-    uint skip = readUShort(lh.file_name_length) + readUShort(lh.extra_field_length);
-    d->device->seek(d->device->pos() + skip);
+    switch (res) {
+    case Z_OK:
+        baunzip.resize(int(len));
+        return baunzip;
+    case Z_MEM_ERROR:
+        qWarning("QZip: Z_MEM_ERROR: Not enough memory");
+        break;
+    case Z_DATA_ERROR:
+        qWarning("QZip: Z_DATA_ERROR: Input data is corrupted");
+        break;
+    }
+    return QByteArray();
+}
+
+/*!
+    Returns a sequential, read-only device that provides the uncompressed
+    contents of \a fileName, or \c nullptr if the file does not exist in the
+    archive or cannot be extracted. The caller takes ownership of the
+    returned device.
+
+    In contrast to fileData(), the contents are inflated on demand while
+    reading from the device, using a fixed size buffer. Unless the reader is
+    in MemoryMapped mode, the device reads from the archive device(), so it
+    must not be used concurrently with other functions of this reader. In
+    MemoryMapped mode, the returned device must not outlive the mapping.
+
+    \sa setReadMode()
+*/
+QIODevice *QZipReader::fileDevice(const QString &fileName) const
+{
+    QZipReaderPrivate::Entry entry;
+    if (!d->locate(d->indexOf(fileName), &entry))
+        return nullptr;
+
+    QScopedPointer<QZipEntryDevice> device(new QZipEntryDevice(d->device, d->mapped,
+        entry.offset, entry.compressedSize, entry.uncompressedSize, entry.deflated));
+    if (!device->open(QIODevice::ReadOnly))
+        return nullptr;
+    return device.take();
+}
 
-    int compression_method = readUShort(lh.compression_method);
-    //qDebug("file=%s: compressed_size=%d, uncompressed_size=%d", fileName.toLocal8Bit().data(), compressed_size, uncompressed_size);
+/*!
+    \enum QZipReader::ReadMode
 
-    if ((general_purpose_bits & Encrypted) != 0) {
-        qWarning("QZip: Unsupported encryption method is needed to extract the data.");
-        return QByteArray();
-    }
+    The following read modes are possible:
 
-    //qDebug("file at %lld", d->device->pos());
-    QByteArray compressed = d->device->read(compressed_size);
-    if (compression_method == CompressionMethodStored) {
-        // no compression
-        compressed.truncate(uncompressed_size);
-        return compressed;
-    } else if (compression_method == CompressionMethodDeflated) {
-        // Deflate
-        //qDebug("compressed=%d", compressed.size());
-        compressed.truncate(compressed_size);
-        QByteArray baunzip;
-        ulong len = qMax(uncompressed_size,  1);
-        int res;
-        do {
-            baunzip.resize(len);
-            res = inflate((uchar*)baunzip.data(), &len,
-                          (const uchar*)compressed.constData(), compressed_size);
+    \value Buffered     The archive is read through its device.
+    \value MemoryMapped The archive file is mapped into memory and read from
+                        the mapping, without copying the compressed data.
+*/
 
-            switch (res) {
-            case Z_OK:
-                if ((int)len != baunzip.size())
-                    baunzip.resize(len);
-                break;
-            case Z_MEM_ERROR:
-                qWarning("QZip: Z_MEM_ERROR: Not enough memory");
-                break;
-            case Z_BUF_ERROR:
-                len *= 2;
-                break;
-            case Z_DATA_ERROR:
-                qWarning("QZip: Z_DATA_ERROR: Input data is corrupted");
-                break;
-            }
-        } while (res == Z_BUF_ERROR);
-        return baunzip;
+/*!
+    Sets the read \a mode of the reader. Returns \c true if the mode is in
+    effect; otherwise returns \c false. The MemoryMapped mode is only
+    available if the archive is read from a file that can be mapped, the
+    reader keeps the Buffered mode otherwise.
+
+    Devices returned by fileDevice() in MemoryMapped mode read from the
+    mapping and must be destroyed before switching back to Buffered mode or
+    closing the reader.
+
+    \sa readMode()
+*/
+bool QZipReader::setReadMode(ReadMode mode)
+{
+    if (mode == Buffered) {
+        d->unmap();
+        return true;
     }
+    return d->map();
+}
 
-    qWarning("QZip: Unsupported compression method %d is needed to extract the data.", compression_method);
-    return QByteArray();
+/*!
+    Returns the read mode in effect.
+
+    \sa setReadMode()
+*/
+QZipReader::ReadMode QZipReader::readMode() const
+{
+    return d->mapped ? MemoryMapped : Buffered;
 }
 
 /*!
@@ -1093,6 +1420,7 @@ QZipReader::Status QZipReader::status() const
 */
 void QZipReader::close()
 {
+    d->unmap();
     d->device->close();
 }
 
@@ -98,6 +98,7 @@ public:
 
     FileInfo entryInfoAt(int index) const;
     QByteArray fileData(const QString &fileName) const;
+    QIODevice *fileDevice(const QString &fileName) const;
     bool extractAll(const QString &destinationDir) const;
 
     enum Status {
@@ -110,6 +111,14 @@ public:
 
     Status status() const;
 
+    enum ReadMode {
+        Buffered,
+        MemoryMapped
+    };
+
+    bool setReadMode(ReadMode mode);
+    ReadMode readMode() const;
+
     void close();
 
 private:
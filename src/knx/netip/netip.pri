@@ -1,5 +1,8 @@
 INCLUDEPATH += $$PWD
 
+# Reading several datagrams with a single recvmmsg() call is opt-in.
+knx_batched_receive: DEFINES += QT_KNX_BATCHED_RECEIVE
+
 PUBLIC_HEADERS += $$PWD/qknxnetip.h \
     $$PWD/qknxnetipconfigdib.h \
     $$PWD/qknxnetipconnectionheader.h \
@@ -58,6 +61,9 @@ PUBLIC_HEADERS += $$PWD/qknxnetip.h \
 
 PRIVATE_HEADERS += \
     $$PWD/qknxbuilderdata_p.h \
+    $$PWD/qknxnetipdatagramreader_p.h \
+    $$PWD/qknxnetipframereassembler_p.h \
+    $$PWD/qknxnetipsecurewrappercodec_p.h \
     $$PWD/qknxnetipendpointconnection_p.h \
     $$PWD/qknxnetipserverdescriptionagent_p.h \
     $$PWD/qknxnetipserverdiscoveryagent_p.h \
@@ -68,6 +74,9 @@ PRIVATE_HEADERS += \
 SOURCES += $$PWD/qknxnetip.cpp \
     $$PWD/qknxnetipconfigdib.cpp \
     $$PWD/qknxnetipconnectionheader.cpp \
+    $$PWD/qknxnetipdatagramreader.cpp \
+    $$PWD/qknxnetipframereassembler.cpp \
+    $$PWD/qknxnetipsecurewrappercodec.cpp \
     $$PWD/qknxnetipconnectionstaterequest.cpp \
     $$PWD/qknxnetipconnectionstateresponse.cpp \
     $$PWD/qknxnetipconnectrequest.cpp \
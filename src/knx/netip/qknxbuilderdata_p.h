@@ -159,6 +159,7 @@ public:
 
     QKnxNetIp::SecureUserId m_id { QKnxNetIp::SecureUserId::Invalid };
     QKnxByteArray m_authCode;
+    QKnxByteArray m_userPasswordHash;
 };
 
 QT_END_NAMESPACE
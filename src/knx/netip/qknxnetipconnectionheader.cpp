@@ -220,6 +220,34 @@ QKnxByteArray QKnxNetIpConnectionHeader::bytes() const
     return m_bytes;
 }
 
+/*!
+    Writes the bytes that represent the KNXnet/IP frame connection header to the
+    memory pointed to by \a out, which can hold up to \a capacity bytes. Returns
+    the number of bytes written. If the header is not valid or \a capacity is
+    too small, nothing is written and \c 0 is returned.
+
+    \sa bytes(), writeTo()
+*/
+int QKnxNetIpConnectionHeader::serialize(quint8 *out, int capacity) const
+{
+    if (!isValid() || capacity < m_bytes.size())
+        return 0;
+    memcpy(out, m_bytes.constData(), m_bytes.size());
+    return m_bytes.size();
+}
+
+/*!
+    Appends the bytes that represent the KNXnet/IP frame connection header to
+    \a out.
+
+    \sa bytes(), serialize()
+*/
+void QKnxNetIpConnectionHeader::writeTo(QKnxByteArray &out) const
+{
+    if (isValid())
+        out.append(m_bytes);
+}
+
 /*!
     Constructs the KNXnet/IP frame connection header from the byte array \a bytes
     starting at the position \a index inside the array.
@@ -227,6 +255,17 @@ QKnxByteArray QKnxNetIpConnectionHeader::bytes() const
     \sa isNull(), isValid()
 */
 QKnxNetIpConnectionHeader QKnxNetIpConnectionHeader::fromBytes(const QKnxByteArray &bytes, quint16 index)
+{
+    return fromBytes(QKnxByteArrayView(bytes), index);
+}
+
+/*!
+    \overload
+
+    The bytes are read directly from the memory referenced by the view, without
+    creating intermediate copies.
+*/
+QKnxNetIpConnectionHeader QKnxNetIpConnectionHeader::fromBytes(QKnxByteArrayView bytes, quint16 index)
 {
     const qint32 availableSize = bytes.size() - index;
     if (availableSize < 1)
@@ -239,7 +278,8 @@ QKnxNetIpConnectionHeader QKnxNetIpConnectionHeader::fromBytes(const QKnxByteArr
 
     QKnxNetIpConnectionHeader hdr { bytes.at(index + 1), bytes.at(index + 2), bytes.at(index + 3) };
     if (totalSize > 4)
-        hdr.setConnectionTypeSpecificHeaderItems(bytes.mid(index + 4, totalSize - 4));
+        hdr.setConnectionTypeSpecificHeaderItems(bytes.mid(index + 4, totalSize - 4)
+            .toByteArray());
     return hdr;
 }
 
@@ -31,6 +31,7 @@
 #define QKNXNETIPCONNECTIONHEADER_H
 
 #include <QtKnx/qknxbytearray.h>
+#include <QtKnx/qknxbytearrayview.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -62,8 +63,11 @@ public:
 
     quint8 byte(quint8 index) const;
     QKnxByteArray bytes() const;
+    int serialize(quint8 *out, int capacity) const;
+    void writeTo(QKnxByteArray &out) const;
 
     static QKnxNetIpConnectionHeader fromBytes(const QKnxByteArray &bytes, quint16 index = 0);
+    static QKnxNetIpConnectionHeader fromBytes(QKnxByteArrayView bytes, quint16 index = 0);
 
     bool operator==(const QKnxNetIpConnectionHeader &other) const;
     bool operator!=(const QKnxNetIpConnectionHeader &other) const;
@@ -212,7 +212,7 @@ QKnxNetIpFrame QKnxNetIpConnectionStateResponseProxy::Builder::create() const
     default:
         break;
     };
-    return { QKnxNetIp::ServiceType::ConnectionStateResponse, data };
+    return { QKnxNetIp::ServiceType::ConnectionStateResponse, std::move(data) };
 }
 
 QT_END_NAMESPACE
@@ -250,7 +250,7 @@ QKnxNetIpFrame QKnxNetIpConnectResponseProxy::Builder::create() const
     QKnxByteArray data { m_channelId, quint8(m_status) };
     if (m_status == QKnxNetIp::Error::None)
         data += m_hpai.bytes() + m_crd.bytes();
-    return { QKnxNetIp::ServiceType::ConnectResponse, data };
+    return { QKnxNetIp::ServiceType::ConnectResponse, std::move(data) };
 }
 
 QT_END_NAMESPACE
@@ -0,0 +1,332 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtKnx module.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include "qknxnetipdatagramreader_p.h"
+
+#include <QtCore/qendian.h>
+#include <QtNetwork/qnetworkdatagram.h>
+#include <QtNetwork/qudpsocket.h>
+
+#if defined(QT_KNX_BATCHED_RECEIVE) && defined(Q_OS_LINUX) && !defined(Q_OS_ANDROID)
+# define QKNX_HAVE_RECVMMSG
+# include <errno.h>
+# include <netinet/in.h>
+# include <sys/socket.h>
+#endif
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \internal
+    \class QKnxNetIpDatagramReader
+
+    \brief The QKnxNetIpDatagramReader class drains pending datagrams from a
+    UDP socket into a set of preallocated buffers.
+
+    Reading a datagram through QUdpSocket::receiveDatagram() allocates a
+    QNetworkDatagram and a QByteArray for every single datagram. This class
+    instead reads up to batch size datagrams at once into a flat buffer that
+    is allocated once and reused, and hands the datagrams out as views.
+
+    If the module is configured with \c {CONFIG+=knx_batched_receive}, all
+    but the first datagram of a batch are fetched with a single \c recvmmsg()
+    call on the socket descriptor on Linux. The first datagram is always read
+    through QUdpSocket, so the socket's read notifier gets re-enabled and
+    readyRead() keeps being emitted. Everywhere else, or if batched receive is
+    disabled, the datagrams are read one by one through QUdpSocket.
+
+    Each slot of the buffer holds up to SlotSize bytes, which is more than any
+    regular KNXnet/IP frame needs. The buffer is only allocated with batch
+    size slots while batched receive is active, otherwise a single slot is
+    used. Larger datagrams are not truncated: on the QUdpSocket path they are
+    detected up front and read through QUdpSocket::receiveDatagram(). In a
+    \c recvmmsg() batch, the part that does not fit into the slot goes to a
+    shared spill buffer, so only the last oversized datagram of a batch can be
+    kept; any earlier one is reported with an empty data() view.
+
+    \note The views returned by data() are only valid until the next call to
+    readDatagrams().
+*/
+
+struct QKnxNetIpDatagramReaderBatch
+{
+#ifdef QKNX_HAVE_RECVMMSG
+    QVector<mmsghdr> headers;
+    QVector<iovec> iovecs; // two per datagram, the slot and the shared spill buffer
+    QVector<sockaddr_storage> addresses;
+    QVector<bool> batched;
+    QScopedArrayPointer<quint8> spill;
+#endif
+};
+
+QKnxNetIpDatagramReader::QKnxNetIpDatagramReader(int batchSize)
+    : m_batchSize(qMax(1, batchSize))
+    , m_batchedReceive(isBatchedReceiveSupported())
+{}
+
+QKnxNetIpDatagramReader::~QKnxNetIpDatagramReader()
+{
+    delete m_batch;
+}
+
+/*!
+    Reads up to batch size pending datagrams from \a socket and returns the
+    number of datagrams read. Returns \c 0 if there are no more pending
+    datagrams.
+*/
+int QKnxNetIpDatagramReader::readDatagrams(QUdpSocket *socket)
+{
+    m_count = 0;
+    if (!socket)
+        return 0;
+
+    allocate();
+    while (m_count < m_slotCount && socket->hasPendingDatagrams()) {
+        if (!readDatagram(socket, m_count))
+            continue;
+        ++m_count;
+        if (m_batchedReceive)
+            m_count += readBatch(socket, m_count);
+    }
+    return m_count;
+}
+
+/*!
+    Returns the data of the datagram at position \a index.
+*/
+QKnxByteArrayView QKnxNetIpDatagramReader::data(int index) const
+{
+    if (index < 0 || index >= m_count)
+        return {};
+    if (m_sizes.at(index) > SlotSize)
+        return m_oversized.at(index);
+    return { m_buffer.data() + index * SlotSize, m_sizes.at(index) };
+}
+
+/*!
+    Returns the sender address of the datagram at position \a index.
+*/
+QHostAddress QKnxNetIpDatagramReader::senderAddress(int index) const
+{
+    if (index < 0 || index >= m_count)
+        return {};
+#ifdef QKNX_HAVE_RECVMMSG
+    if (m_batch && m_batch->batched.at(index))
+        return QHostAddress(reinterpret_cast<const sockaddr *> (&m_batch->addresses.at(index)));
+#endif
+    return m_senderAddresses.at(index);
+}
+
+/*!
+    Returns the sender port of the datagram at position \a index.
+*/
+quint16 QKnxNetIpDatagramReader::senderPort(int index) const
+{
+    if (index < 0 || index >= m_count)
+        return 0;
+#ifdef QKNX_HAVE_RECVMMSG
+    if (m_batch && m_batch->batched.at(index)) {
+        const auto &address = m_batch->addresses.at(index);
+        if (address.ss_family == AF_INET)
+            return qFromBigEndian(reinterpret_cast<const sockaddr_in *> (&address)->sin_port);
+        if (address.ss_family == AF_INET6)
+            return qFromBigEndian(reinterpret_cast<const sockaddr_in6 *> (&address)->sin6_port);
+        return 0;
+    }
+#endif
+    return m_senderPorts.at(index);
+}
+
+/*!
+    Returns \c true if datagrams are read in batches, otherwise returns
+    \c false.
+*/
+bool QKnxNetIpDatagramReader::isBatchedReceiveEnabled() const
+{
+    return m_batchedReceive;
+}
+
+/*!
+    Enables batched receive if \a enabled is \c true and the platform supports
+    it, otherwise all datagrams are read through QUdpSocket.
+*/
+void QKnxNetIpDatagramReader::setBatchedReceiveEnabled(bool enabled)
+{
+    m_batchedReceive = enabled && isBatchedReceiveSupported();
+}
+
+/*!
+    Returns \c true if the module was configured with batched receive and the
+    platform supports reading several datagrams with a single system call,
+    otherwise returns \c false.
+*/
+bool QKnxNetIpDatagramReader::isBatchedReceiveSupported()
+{
+#ifdef QKNX_HAVE_RECVMMSG
+    return true;
+#else
+    return false;
+#endif
+}
+
+int QKnxNetIpDatagramReader::slotCount() const
+{
+    return m_batchedReceive ? m_batchSize : 1;
+}
+
+void QKnxNetIpDatagramReader::allocate()
+{
+    const int slots = slotCount();
+    if (m_slotCount == slots)
+        return;
+
+    m_slotCount = slots;
+    m_buffer.reset(new quint8[size_t(slots) * SlotSize]);
+    m_oversized.resize(slots);
+    m_sizes.resize(slots);
+    m_senderAddresses.resize(slots);
+    m_senderPorts.resize(slots);
+
+    delete m_batch;
+    m_batch = nullptr;
+#ifdef QKNX_HAVE_RECVMMSG
+    if (m_batchedReceive) {
+        m_batch = new QKnxNetIpDatagramReaderBatch;
+        m_batch->headers.resize(slots);
+        m_batch->iovecs.resize(2 * slots);
+        m_batch->addresses.resize(slots);
+        m_batch->batched.resize(slots);
+        m_batch->spill.reset(new quint8[MaxDatagramSize - SlotSize]);
+    }
+#endif
+}
+
+bool QKnxNetIpDatagramReader::readDatagram(QUdpSocket *socket, int index)
+{
+    if (socket->pendingDatagramSize() > SlotSize) {
+        const auto datagram = socket->receiveDatagram();
+        if (datagram.data().size() <= SlotSize) // failed to read
+            return false;
+        m_oversized[index] = datagram.data();
+        m_sizes[index] = m_oversized.at(index).size();
+        m_senderAddresses[index] = datagram.senderAddress();
+        m_senderPorts[index] = quint16(qMax(datagram.senderPort(), 0));
+    } else {
+        auto data = reinterpret_cast<char *> (m_buffer.data() + index * SlotSize);
+        const auto read = socket->readDatagram(data, SlotSize, &m_senderAddresses[index],
+            &m_senderPorts[index]);
+        if (read < 0)
+            return false;
+        m_sizes[index] = int(read);
+    }
+
+#ifdef QKNX_HAVE_RECVMMSG
+    if (m_batch)
+        m_batch->batched[index] = false;
+#endif
+    return true;
+}
+
+int QKnxNetIpDatagramReader::readBatch(QUdpSocket *socket, int index)
+{
+#ifdef QKNX_HAVE_RECVMMSG
+    const int count = m_slotCount - index;
+    if (!m_batch || count <= 0)
+        return 0;
+
+    for (int i = 0; i < count; ++i) {
+        auto iov = &m_batch->iovecs[2 * i];
+        iov[0].iov_base = m_buffer.data() + (index + i) * SlotSize;
+        iov[0].iov_len = SlotSize;
+        iov[1].iov_base = m_batch->spill.data();
+        iov[1].iov_len = MaxDatagramSize - SlotSize;
+
+        auto &header = m_batch->headers[i];
+        header = {};
+        header.msg_hdr.msg_name = &m_batch->addresses[index + i];
+        header.msg_hdr.msg_namelen = sizeof(sockaddr_storage);
+        header.msg_hdr.msg_iov = iov;
+        header.msg_hdr.msg_iovlen = 2;
+    }
+
+    int received = -1;
+    do {
+        received = ::recvmmsg(int(socket->socketDescriptor()), m_batch->headers.data(),
+            unsigned(count), MSG_DONTWAIT, nullptr);
+    } while (received < 0 && errno == EINTR);
+
+    // On any error, including EAGAIN, fall back to reading through QUdpSocket,
+    // which will also report real socket errors the usual way.
+    if (received <= 0)
+        return 0;
+
+    // Every datagram spills into the same buffer, so it only holds the tail of
+    // the last oversized one.
+    int lastOversized = -1;
+    for (int i = 0; i < received; ++i) {
+        if (int(m_batch->headers.at(i).msg_len) > SlotSize)
+            lastOversized = i;
+    }
+
+    for (int i = 0; i < received; ++i) {
+        const int size = int(m_batch->headers.at(i).msg_len);
+        m_batch->batched[index + i] = true;
+        m_sizes[index + i] = size;
+        if (size <= SlotSize)
+            continue;
+
+        if (i != lastOversized) {
+            m_sizes[index + i] = 0; // tail overwritten, drop the datagram
+            continue;
+        }
+        auto &oversized = m_oversized[index + i];
+        oversized.resize(size);
+        memcpy(oversized.data(), m_buffer.data() + (index + i) * SlotSize, SlotSize);
+        memcpy(oversized.data() + SlotSize, m_batch->spill.data(), size - SlotSize);
+    }
+    return received;
+#else
+    Q_UNUSED(socket);
+    Q_UNUSED(index);
+    return 0;
+#endif
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,118 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtKnx module.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#ifndef QKNXNETIPDATAGRAMREADER_P_H
+#define QKNXNETIPDATAGRAMREADER_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt KNX API.  It exists for the convenience
+// of the Qt KNX implementation.  This header file may change from version
+// to version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/qbytearray.h>
+#include <QtCore/qscopedpointer.h>
+#include <QtCore/qvector.h>
+
+#include <QtKnx/qtknxglobal.h>
+#include <QtKnx/qknxbytearrayview.h>
+
+#include <QtNetwork/qhostaddress.h>
+
+QT_BEGIN_NAMESPACE
+
+class QUdpSocket;
+struct QKnxNetIpDatagramReaderBatch;
+
+class Q_AUTOTEST_EXPORT QKnxNetIpDatagramReader final
+{
+public:
+    enum : int
+    {
+        DefaultBatchSize = 32,
+        SlotSize = 1024, // holds any regular KNXnet/IP frame, larger ones are read separately
+        MaxDatagramSize = 65527 // maximum UDP payload, IPv4 payloads are even smaller
+    };
+
+    explicit QKnxNetIpDatagramReader(int batchSize = DefaultBatchSize);
+    ~QKnxNetIpDatagramReader();
+
+    int readDatagrams(QUdpSocket *socket);
+
+    int count() const { return m_count; }
+    QKnxByteArrayView data(int index) const;
+    QHostAddress senderAddress(int index) const;
+    quint16 senderPort(int index) const;
+
+    bool isBatchedReceiveEnabled() const;
+    void setBatchedReceiveEnabled(bool enabled);
+    static bool isBatchedReceiveSupported();
+
+private:
+    Q_DISABLE_COPY(QKnxNetIpDatagramReader)
+
+    void allocate();
+    int slotCount() const;
+    bool readDatagram(QUdpSocket *socket, int index);
+    int readBatch(QUdpSocket *socket, int index);
+
+private:
+    int m_batchSize { DefaultBatchSize };
+    int m_count { 0 };
+    bool m_batchedReceive { false };
+
+    int m_slotCount { 0 };
+    QScopedArrayPointer<quint8> m_buffer;
+    QVector<QByteArray> m_oversized;
+    QVector<int> m_sizes;
+    QVector<QHostAddress> m_senderAddresses;
+    QVector<quint16> m_senderPorts;
+
+    QKnxNetIpDatagramReaderBatch *m_batch { nullptr };
+};
+
+QT_END_NAMESPACE
+
+#endif
@@ -398,7 +398,7 @@ QKnxNetIpDib QKnxNetIpDeviceDibProxy::Builder::create() const
         data.append(QKnxByteArray(52 - data.size(), 0));
     data.resize(52); // size enforced by 7.5.4.2 Device information DIB
 
-    return { QKnxNetIp::DescriptionType::DeviceInfo, data };
+    return { QKnxNetIp::DescriptionType::DeviceInfo, std::move(data) };
 }
 
 QT_END_NAMESPACE
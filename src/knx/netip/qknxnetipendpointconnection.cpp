@@ -50,10 +50,12 @@
 #include "qknxnetiptunnelingfeatureresponse.h"
 #include "qknxnetiptunnelingrequest.h"
 #include "qnetworkdatagram.h"
+#include "qvarlengtharray.h"
 #include "qtcpsocket.h"
 #include "qudpsocket.h"
 
 #include "private/qknxnetipsecureconfiguration_p.h"
+#include "private/qknxnetipsecurewrappercodec_p.h"
 
 QT_BEGIN_NAMESPACE
 /*!
@@ -187,6 +189,16 @@ namespace QKnxPrivate
             (*socket) = nullptr;
         }
     }
+
+    // Most KNXnet/IP frames fit into the preallocated part of the buffer, so
+    // encoding a frame for sending does not need to allocate.
+    using FrameBuffer = QVarLengthArray<quint8, 256>;
+
+    static bool serialize(const QKnxNetIpFrame &frame, FrameBuffer *buffer)
+    {
+        buffer->resize(frame.size());
+        return frame.serialize(buffer->data(), buffer->size()) > 0;
+    }
 }
 
 void QKnxNetIpEndpointConnectionPrivate::setupTimer()
@@ -309,26 +321,11 @@ QKnxNetIp::ServiceType
     case QKnxNetIp::ServiceType::SecureWrapper: {
         qDebug() << "Received secure wrapper frame:" << frame;
 
-        const QKnxNetIpSecureWrapperProxy proxy(frame);
-        if (!proxy.isValid())
+        // frames received over TCP come out of the reassembler already parsed
+        QKnxPrivate::FrameBuffer buffer;
+        if (!QKnxPrivate::serialize(frame, &buffer))
             break;
-
-        const auto seqNumber = proxy.sequenceNumber();
-        const auto serialNumber = proxy.serialNumber();
-        const auto messageTag = proxy.messageTag();
-
-        const auto decData = QKnxCryptographicEngine::decryptSecureWrapperPayload(m_sessionKey,
-            proxy.encapsulatedFrame(), seqNumber, serialNumber, messageTag);
-
-        const auto mac = QKnxCryptographicEngine::computeMessageAuthenticationCode(m_sessionKey,
-            frame.header(), proxy.secureSessionId(), decData, seqNumber, serialNumber, messageTag);
-        const auto decMac = QKnxCryptographicEngine::decryptMessageAuthenticationCode(m_sessionKey,
-            proxy.messageAuthenticationCode(), seqNumber, serialNumber, messageTag);
-
-        if (decMac != mac)
-            break; // MAC could not be verified, bail out
-
-        return processReceivedFrame(QKnxNetIpFrame::fromBytes(decData));
+        return processSecureWrapper({ buffer.constData(), buffer.size() });
     }   break;
 
     case QKnxNetIp::ServiceType::SessionRequest:
@@ -342,8 +339,7 @@ QKnxNetIp::ServiceType
         if (!proxy.isValid())
             break;
 
-        const auto authHash = QKnxCryptographicEngine::deviceAuthenticationCodeHash(m_secureConfig.
-            d->deviceAuthenticationCode);
+        const auto authHash = m_secureConfig.d->deviceAuthenticationCodeHash();
         const auto xorX_Y = QKnxCryptographicEngine::XOR(m_secureConfig.d->publicKey.bytes(), proxy
             .publicKey());
 
@@ -360,22 +356,13 @@ QKnxNetIp::ServiceType
         m_sessionId = proxy.secureSessionId();
         m_sessionKey = QKnxCryptographicEngine::sessionKey(m_secureConfig.d->privateKey,
             QKnxSecureKey::fromBytes(QKnxSecureKey::Type::Public, proxy.publicKey()));
+        m_sessionCipher.setKey(m_sessionKey);
 
-        auto secureWrapper = QKnxNetIpSecureWrapperProxy::secureBuilder()
-            .setSecureSessionId(m_sessionId)
-            .setSequenceNumber(m_sequenceNumber)
-            .setSerialNumber(m_serialNumber)
-            // .setMessageTag(0x0000) TODO: Do we need an API for this?
-            .setEncapsulatedFrame(QKnxNetIpSessionAuthenticateProxy::secureBuilder()
-                .setUserId(m_secureConfig.d->userId)
-                .create(m_secureConfig.d->userPassword, m_secureConfig.d->publicKey.bytes(), proxy
-                    .publicKey()))
-            .create(m_sessionKey);
-
-        ++m_sequenceNumber;
         m_waitForAuthentication = true;
-        if (m_tcpSocket)
-            m_tcpSocket->write(secureWrapper.bytes().toByteArray());
+        writeSecureFrame(QKnxNetIpSessionAuthenticateProxy::secureBuilder()
+            .setUserId(m_secureConfig.d->userId)
+            .setUserPasswordHash(m_secureConfig.d->userPasswordHash())
+            .create(m_secureConfig.d->publicKey.bytes(), proxy.publicKey()));
 
         Q_Q(QKnxNetIpEndpointConnection);
         QObject::connect(m_secureTimer, &QTimer::timeout, q, [&]() {
@@ -383,17 +370,9 @@ QKnxNetIp::ServiceType
             setAndEmitErrorOccurred(QKnxNetIpEndpointConnection::Error::AuthFailed,
                 QKnxNetIpEndpointConnection::tr("Did not receive session status frame."));
 
-            auto secureStatusWrapper = QKnxNetIpSecureWrapperProxy::secureBuilder()
-                .setSecureSessionId(m_sessionId)
-                .setSequenceNumber(m_sequenceNumber)
-                .setSerialNumber(m_serialNumber)
-                // .setMessageTag(0x0000) TODO: Do we need an API for this?
-                .setEncapsulatedFrame(QKnxNetIpSessionStatusProxy::builder()
-                    .setStatus(QKnxNetIp::SecureSessionStatus::Close)
-                    .create())
-                .create(m_sessionKey);
-            if (m_tcpSocket)
-                m_tcpSocket->write(secureStatusWrapper.bytes().toByteArray());
+            writeSecureFrame(QKnxNetIpSessionStatusProxy::builder()
+                .setStatus(QKnxNetIp::SecureSessionStatus::Close)
+                .create());
 
             Q_Q(QKnxNetIpEndpointConnection);
             q->disconnectFromHost();
@@ -420,41 +399,22 @@ QKnxNetIp::ServiceType
                 m_secureTimer->disconnect();
                 m_waitForAuthentication = false;
                 auto ep = (m_tcpSocket ? m_routeBack : (m_nat ? m_routeBack : m_localEndpoint));
-                auto secureWrapper = QKnxNetIpSecureWrapperProxy::secureBuilder()
-                    .setSecureSessionId(m_sessionId)
-                    .setSequenceNumber(m_sequenceNumber)
-                    .setSerialNumber(m_serialNumber)
-                    // .setMessageTag(0x0000) TODO: Do we need an API for this?
-                    .setEncapsulatedFrame(QKnxNetIpConnectRequestProxy::builder()
-                        .setControlEndpoint(ep)
-                        .setDataEndpoint(ep)
-                        .setRequestInformation(m_cri)
-                        .create())
-                    .create(m_sessionKey);
-
-                ++m_sequenceNumber;
-                if (m_tcpSocket)
-                    m_tcpSocket->write(secureWrapper.bytes().toByteArray());
+                writeSecureFrame(QKnxNetIpConnectRequestProxy::builder()
+                    .setControlEndpoint(ep)
+                    .setDataEndpoint(ep)
+                    .setRequestInformation(m_cri)
+                    .create());
 
                 if (!m_secureConfig.d->keepAlive)
                     break;
 
                 Q_Q(QKnxNetIpEndpointConnection);
                 QObject::connect(m_secureTimer, &QTimer::timeout, q, [&]() {
-                    auto secureStatusWrapper = QKnxNetIpSecureWrapperProxy::secureBuilder()
-                        .setSecureSessionId(m_sessionId)
-                        .setSequenceNumber(m_sequenceNumber)
-                        .setSerialNumber(m_serialNumber)
-                        // .setMessageTag(0x0000) TODO: Do we need an API for this?
-                        .setEncapsulatedFrame(QKnxNetIpSessionStatusProxy::builder()
-                            .setStatus(QKnxNetIp::SecureSessionStatus::KeepAlive)
-                            .create())
-                        .create(m_sessionKey);
-                    qDebug() << "Sending keep alive status frame:" << secureStatusWrapper;
-
-                    ++m_sequenceNumber;
-                    if (m_tcpSocket)
-                        m_tcpSocket->write(secureStatusWrapper.bytes().toByteArray());
+                    const auto keepAlive = QKnxNetIpSessionStatusProxy::builder()
+                        .setStatus(QKnxNetIp::SecureSessionStatus::KeepAlive)
+                        .create();
+                    qDebug() << "Sending keep alive status frame:" << keepAlive;
+                    writeSecureFrame(keepAlive);
                 });
                 m_secureTimer->setSingleShot(false);
                 m_secureTimer->start(QKnxNetIp::Timeout::SecureSessionTimeout - 5000);
@@ -511,6 +471,32 @@ QKnxNetIp::ServiceType
     return serviceType;
 }
 
+// A secure wrapper datagram is decrypted straight from the reader's buffer,
+// so only the encapsulated frame gets parsed.
+QKnxNetIp::ServiceType
+    QKnxNetIpEndpointConnectionPrivate::processReceivedDatagram(QKnxByteArrayView datagram)
+{
+    const auto header = QKnxNetIpFrameHeader::fromBytes(datagram);
+    if (header.isValid() && header.serviceType() == QKnxNetIp::ServiceType::SecureWrapper) {
+        qDebug() << "Received secure wrapper frame:" << header;
+        return processSecureWrapper(datagram);
+    }
+    return processReceivedFrame(QKnxNetIpFrame::fromBytes(datagram));
+}
+
+QKnxNetIp::ServiceType
+    QKnxNetIpEndpointConnectionPrivate::processSecureWrapper(QKnxByteArrayView bytes)
+{
+    QKnxPrivate::FrameBuffer buffer(qMax(0, bytes.size()
+        - QKnxNetIpSecureWrapperCodec::Overhead));
+    const auto decData = QKnxNetIpSecureWrapperCodec::decode(m_sessionCipher, bytes,
+        buffer.data(), buffer.size());
+    if (decData.isEmpty())
+        return QKnxNetIp::ServiceType::SecureWrapper; // MAC could not be verified, bail out
+
+    return processReceivedFrame(QKnxNetIpFrame::fromBytes(decData));
+}
+
 bool QKnxNetIpEndpointConnectionPrivate::initConnection(const QHostAddress &a, quint16 p,
     QKnxNetIp::HostProtocol hp)
 {
@@ -548,6 +534,14 @@ bool QKnxNetIpEndpointConnectionPrivate::initConnection(const QHostAddress &a, q
     m_cemiRequests = 0;
     m_lastSendCemiRequest = {};
 
+    m_rxReassembler.clear();
+
+    clearTunnelingRequests(false);
+    m_sendRateTimer.invalidate();
+    m_acknowledgeTimeTotal = 0;
+    m_lastAcknowledgeAt = 0;
+    m_acknowledgedRequests = 0;
+
     m_stateRequests = 0;
     m_lastStateRequest = {};
 
@@ -573,31 +567,45 @@ bool QKnxNetIpEndpointConnectionPrivate::initConnection(const QHostAddress &a, q
     if (hp == QKnxNetIp::HostProtocol::TCP_IPv4) {
         socket = m_tcpSocket = new QTcpSocket(q_func());
         QObject::connect(m_tcpSocket, &QTcpSocket::readyRead, q, [&]() {
-            if (m_tcpSocket->bytesAvailable() < QKnxNetIpFrameHeader::HeaderSize10)
-                return;
-            m_rxBuffer += QKnxByteArray::fromByteArray(m_tcpSocket->readAll());
-
-            // TODO: AN184 v03 KNXnet-IP Core v2 AS, 2.2.3.2.3.2
-            auto header = QKnxNetIpFrameHeader::fromBytes(m_rxBuffer);
-            if (header.isValid() && m_rxBuffer.size() < header.totalSize())
-                return;
-
-            auto frame = QKnxNetIpFrame::fromBytes(m_rxBuffer);
-            m_rxBuffer.remove(0, header.totalSize());
-            processReceivedFrame(frame);
+            // AN184 v03 KNXnet-IP Core v2 AS, 2.2.3.2.3.2: a segment can carry
+            // several frames or only parts of one, process every complete frame.
+            char chunk[QKnxNetIpFrameReassembler::DefaultCapacity];
+            while (m_tcpSocket) {
+                const auto read = m_tcpSocket->read(chunk, qMin<qint64>(sizeof(chunk),
+                    m_rxReassembler.freeSpace()));
+                if (read <= 0)
+                    break;
+                m_rxReassembler.append({ reinterpret_cast<const quint8 *> (chunk), int(read) });
+
+                QKnxNetIpFrame frame;
+                while (m_tcpSocket && m_rxReassembler.takeFrame(&frame))
+                    processReceivedFrame(frame);
+
+                if (m_tcpSocket && m_rxReassembler.hasError()) {
+                    setAndEmitErrorOccurred(QKnxNetIpEndpointConnection::Error::Network,
+                        QKnxNetIpEndpointConnection::tr("Received an invalid or too large "
+                            "KNXnet/IP frame header."));
+                    Q_Q(QKnxNetIpEndpointConnection);
+                    q->disconnectFromHost();
+                    return;
+                }
+            }
         });
     } else if (hp == QKnxNetIp::HostProtocol::UDP_IPv4) {
         socket = m_udpSocket = new QUdpSocket(q_func());
         QObject::connect(m_udpSocket, &QUdpSocket::readyRead, q, [&]() {
             while (m_udpSocket && m_udpSocket->state() == QUdpSocket::BoundState
-                && m_udpSocket->hasPendingDatagrams()) {
-                    auto tmp = m_udpSocket->receiveDatagram();
-                    auto frame = QKnxNetIpFrame::fromBytes(QKnxByteArray::fromByteArray(tmp.data()));
-                    if (processReceivedFrame(frame) != QKnxNetIp::ServiceType::ConnectResponse)
+                && m_datagramReader.readDatagrams(m_udpSocket) > 0) {
+                for (int i = 0; m_udpSocket && i < m_datagramReader.count(); ++i) {
+                    const auto type = processReceivedDatagram(m_datagramReader.data(i));
+                    if (type != QKnxNetIp::ServiceType::ConnectResponse)
                         continue;
 
-                    if (m_nat && m_remoteDataEndpoint.isNullOrLocal())
-                        m_remoteDataEndpoint = { tmp.senderAddress(), quint16(tmp.senderPort())};
+                    if (m_nat && m_remoteDataEndpoint.isNullOrLocal()) {
+                        m_remoteDataEndpoint = { m_datagramReader.senderAddress(i),
+                            m_datagramReader.senderPort(i) };
+                    }
+                }
             }
         });
     } else {
@@ -634,26 +642,60 @@ void QKnxNetIpEndpointConnectionPrivate::cleanup()
         QKnxPrivate::clearSocket(&m_udpSocket);
     } else if (m_tcpSocket) {
         if (m_secureConfig.isValid()) {
-            auto secureStatusWrapper = QKnxNetIpSecureWrapperProxy::secureBuilder()
-                .setSecureSessionId(m_sessionId)
-                .setSequenceNumber(m_sequenceNumber)
-                .setSerialNumber(m_serialNumber)
-                // .setMessageTag(0x0000) TODO: Do we need an API for this?
-                .setEncapsulatedFrame(QKnxNetIpSessionStatusProxy::builder()
-                    .setStatus(QKnxNetIp::SecureSessionStatus::Close)
-                    .create())
-                .create(m_sessionKey);
-            ++m_sequenceNumber;
-            m_tcpSocket->write(secureStatusWrapper.bytes().toByteArray());
+            writeSecureFrame(QKnxNetIpSessionStatusProxy::builder()
+                .setStatus(QKnxNetIp::SecureSessionStatus::Close)
+                .create());
             m_tcpSocket->waitForBytesWritten();
         }
         m_tcpSocket->close();
         QKnxPrivate::clearSocket(&m_tcpSocket);
     }
 
+    clearTunnelingRequests(true);
     setAndEmitStateChanged(QKnxNetIpEndpointConnection::State::Disconnected);
 }
 
+qint64 QKnxNetIpEndpointConnectionPrivate::writeFrame(const QKnxNetIpFrame &frame)
+{
+    QKnxPrivate::FrameBuffer buffer;
+    if (!QKnxPrivate::serialize(frame, &buffer))
+        return m_tcpSocket->write(frame.bytes().toByteArray());
+    return m_tcpSocket->write(reinterpret_cast<const char *> (buffer.constData()), buffer.size());
+}
+
+qint64 QKnxNetIpEndpointConnectionPrivate::writeFrame(const QKnxNetIpFrame &frame,
+    const QHostAddress &address, quint16 port)
+{
+    QKnxPrivate::FrameBuffer buffer;
+    if (!QKnxPrivate::serialize(frame, &buffer))
+        return m_udpSocket->writeDatagram(frame.bytes().toByteArray(), address, port);
+    return m_udpSocket->writeDatagram(reinterpret_cast<const char *> (buffer.constData()),
+        buffer.size(), address, port);
+}
+
+qint64 QKnxNetIpEndpointConnectionPrivate::writeSecureFrame(const QKnxNetIpFrame &frame)
+{
+    if (!m_tcpSocket)
+        return -1;
+
+    QKnxNetIpSecureWrapperCodec::SecurityInfo info;
+    info.sessionId = m_sessionId;
+    info.sequenceNumber = m_sequenceNumber;
+    info.serialNumber = m_serialNumber;
+    // info.messageTag = 0x0000; TODO: Do we need an API for this?
+
+    // encrypt and authenticate straight into the buffer that gets written
+    QKnxPrivate::FrameBuffer buffer;
+    buffer.resize(QKnxNetIpSecureWrapperCodec::encodedSize(frame));
+    const int size = QKnxNetIpSecureWrapperCodec::encode(m_sessionCipher, frame, info,
+        buffer.data(), buffer.size());
+    if (size <= 0)
+        return -1;
+
+    ++m_sequenceNumber;
+    return m_tcpSocket->write(reinterpret_cast<const char *> (buffer.constData()), size);
+}
+
 bool QKnxNetIpEndpointConnectionPrivate::sendCemiRequest()
 {
     if (m_udpSocket) {
@@ -661,7 +703,7 @@ bool QKnxNetIpEndpointConnectionPrivate::sendCemiRequest()
             return false; // still waiting for an ACK from an previous request
 
         m_waitForAcknowledgement = true;
-        m_udpSocket->writeDatagram(m_lastSendCemiRequest.bytes().toByteArray(),
+        writeFrame(m_lastSendCemiRequest,
             m_remoteDataEndpoint.address,
             m_remoteDataEndpoint.port);
 
@@ -671,19 +713,10 @@ bool QKnxNetIpEndpointConnectionPrivate::sendCemiRequest()
     }
 
     if (m_tcpSocket) {
-        if (m_secureConfig.isValid()) {
-            auto secureFrame = QKnxNetIpSecureWrapperProxy::secureBuilder()
-                .setSecureSessionId(m_sessionId)
-                .setSequenceNumber(m_sequenceNumber)
-                .setSerialNumber(m_serialNumber)
-                // .setMessageTag(0x0000) TODO: Do we need an API for this?
-                .setEncapsulatedFrame(m_lastSendCemiRequest)
-                .create(m_sessionKey);
-            ++m_sequenceNumber;
-            m_tcpSocket->write(secureFrame.bytes().toByteArray());
-        } else {
-            m_tcpSocket->write(m_lastSendCemiRequest.bytes().toByteArray());
-        }
+        if (m_secureConfig.isValid())
+            writeSecureFrame(m_lastSendCemiRequest);
+        else
+            writeFrame(m_lastSendCemiRequest);
         return true; // TCP connections do not send an ACK
     }
     return false;
@@ -695,21 +728,12 @@ void QKnxNetIpEndpointConnectionPrivate::sendStateRequest()
         .bytes().toHex();
 
     if (m_tcpSocket) {
-        if (m_secureConfig.isValid()) {
-            auto secureFrame = QKnxNetIpSecureWrapperProxy::secureBuilder()
-                .setSecureSessionId(m_sessionId)
-                .setSequenceNumber(m_sequenceNumber)
-                .setSerialNumber(m_serialNumber)
-                // .setMessageTag(0x0000) TODO: Do we need an API for this?
-                .setEncapsulatedFrame(m_lastStateRequest)
-                .create(m_sessionKey);
-            ++m_sequenceNumber;
-            m_tcpSocket->write(secureFrame.bytes().toByteArray());
-        } else {
-            m_tcpSocket->write(m_lastStateRequest.bytes().toByteArray());
-        }
+        if (m_secureConfig.isValid())
+            writeSecureFrame(m_lastStateRequest);
+        else
+            writeFrame(m_lastStateRequest);
     } else {
-        m_udpSocket->writeDatagram(m_lastStateRequest.bytes().toByteArray(),
+        writeFrame(m_lastStateRequest,
             m_remoteControlEndpoint.address, m_remoteControlEndpoint.port);
     }
 
@@ -745,7 +769,7 @@ void QKnxNetIpEndpointConnectionPrivate::processTunnelingRequest(const QKnxNetIp
                     .create();
 
                 qDebug() << "Sending tunneling acknowledge:" << ack;
-                m_udpSocket->writeDatagram(ack.bytes().toByteArray(),
+                writeFrame(ack,
                     m_remoteDataEndpoint.address, m_remoteDataEndpoint.port);
 
                 if (!counterEquals)
@@ -772,6 +796,15 @@ void QKnxNetIpEndpointConnectionPrivate::processTunnelingAcknowledge(const QKnxN
             && acknowledge.sequenceNumber() == m_sendCount) {
                 m_sendCount++;
                 m_cemiRequests = 0;
+
+                if (m_waitForTunnelingAcknowledge) {
+                    m_waitForTunnelingAcknowledge = false;
+                    m_lastAcknowledgeAt = m_sendRateTimer.nsecsElapsed();
+                    m_acknowledgeTimeTotal += m_acknowledgeTime.nsecsElapsed();
+                    m_acknowledgedRequests++;
+                    tunnelingRequestAcknowledged(m_pendingTunnelingRequest);
+                }
+                sendQueuedTunnelingRequests();
         } else {
             sendCemiRequest();
         }
@@ -782,6 +815,15 @@ void QKnxNetIpEndpointConnectionPrivate::processTunnelingAcknowledge(const QKnxN
 }
 
 bool QKnxNetIpEndpointConnectionPrivate::sendTunnelingRequest(const QKnxLinkLayerFrame &frame)
+{
+    // Only one request can be outstanding at a time, 03_08_04 Tunneling
+    // v01.05.03, paragraph 2.6. Anything sent meanwhile is queued.
+    if (m_waitForAcknowledgement || !m_sendQueue.isEmpty())
+        return enqueueTunnelingRequest(frame);
+    return transmitTunnelingRequest(frame);
+}
+
+bool QKnxNetIpEndpointConnectionPrivate::transmitTunnelingRequest(const QKnxLinkLayerFrame &frame)
 {
     m_lastSendCemiRequest = QKnxNetIpTunnelingRequestProxy::builder()
         .setChannelId(m_channelId)
@@ -790,9 +832,75 @@ bool QKnxNetIpEndpointConnectionPrivate::sendTunnelingRequest(const QKnxLinkLaye
         .create();
     qDebug().noquote().nospace() << "Sending tunneling request:" << m_lastSendCemiRequest;
 
-    return sendCemiRequest();
+    if (!sendCemiRequest())
+        return false;
+
+    if (!m_sendRateTimer.isValid())
+        m_sendRateTimer.start();
+
+    if (m_udpSocket) {
+        m_waitForTunnelingAcknowledge = true;
+        m_pendingTunnelingRequest = frame;
+        m_acknowledgeTime.start();
+    }
+    tunnelingRequestSent(frame);
+    return true;
+}
+
+bool QKnxNetIpEndpointConnectionPrivate::enqueueTunnelingRequest(const QKnxLinkLayerFrame &frame)
+{
+    if (m_sendQueueDepth <= 0)
+        return false; // still waiting for an ACK from an previous request
+
+    if (m_sendQueue.size() >= m_sendQueueDepth) {
+        if (!m_sendQueueDropOldest)
+            return false;
+        tunnelingRequestFailed(m_sendQueue.dequeue());
+    }
+
+    m_sendQueue.enqueue(frame);
+    tunnelingRequestQueued(frame);
+    return true;
 }
 
+void QKnxNetIpEndpointConnectionPrivate::sendQueuedTunnelingRequests()
+{
+    while (!m_waitForAcknowledgement && !m_sendQueue.isEmpty()
+        && m_state == QKnxNetIpEndpointConnection::State::Connected) {
+        const auto frame = m_sendQueue.dequeue();
+        if (!transmitTunnelingRequest(frame))
+            tunnelingRequestFailed(frame);
+    }
+}
+
+void QKnxNetIpEndpointConnectionPrivate::clearTunnelingRequests(bool notify)
+{
+    auto queue = std::move(m_sendQueue);
+    m_sendQueue.clear();
+
+    const bool pending = m_waitForTunnelingAcknowledge;
+    m_waitForTunnelingAcknowledge = false;
+    if (!notify)
+        return;
+
+    if (pending)
+        tunnelingRequestFailed(m_pendingTunnelingRequest);
+    for (const auto &frame : qAsConst(queue))
+        tunnelingRequestFailed(frame);
+}
+
+void QKnxNetIpEndpointConnectionPrivate::tunnelingRequestQueued(const QKnxLinkLayerFrame &)
+{}
+
+void QKnxNetIpEndpointConnectionPrivate::tunnelingRequestSent(const QKnxLinkLayerFrame &)
+{}
+
+void QKnxNetIpEndpointConnectionPrivate::tunnelingRequestAcknowledged(const QKnxLinkLayerFrame &)
+{}
+
+void QKnxNetIpEndpointConnectionPrivate::tunnelingRequestFailed(const QKnxLinkLayerFrame &)
+{}
+
 void QKnxNetIpEndpointConnectionPrivate::processDeviceConfigurationRequest(const QKnxNetIpFrame &frame)
 {
     qDebug() << "Received device configuration request:" << frame;
@@ -822,7 +930,7 @@ void QKnxNetIpEndpointConnectionPrivate::processDeviceConfigurationRequest(const
         .create();
 
     qDebug() << "Sending device configuration acknowledge:" << ack;
-    m_udpSocket->writeDatagram(ack.bytes().toByteArray(),
+    writeFrame(ack,
         m_remoteDataEndpoint.address, m_remoteDataEndpoint.port);
 
     m_receiveCount++;
@@ -916,7 +1024,7 @@ void QKnxNetIpEndpointConnectionPrivate::processFeatureFrame(const QKnxNetIpFram
                     .create();
 
                 qDebug() << "Sending tunneling acknowledge:" << ack;
-                m_udpSocket->writeDatagram(ack.bytes().toByteArray(),
+                writeFrame(ack,
                     m_remoteDataEndpoint.address, m_remoteDataEndpoint.port);
 
                 if (!counterEquals)
@@ -1001,19 +1109,12 @@ void QKnxNetIpEndpointConnectionPrivate::processDisconnectRequest(const QKnxNetI
             .create();
         qDebug() << "Sending disconnect response:" << responseFrame;
         if (m_tcpSocket) {
-            if (m_secureConfig.isValid()) {
-                responseFrame = QKnxNetIpSecureWrapperProxy::secureBuilder()
-                    .setSecureSessionId(m_sessionId)
-                    .setSequenceNumber(m_sequenceNumber)
-                    .setSerialNumber(m_serialNumber)
-                    // .setMessageTag(0x0000) TODO: Do we need an API for this?
-                    .setEncapsulatedFrame(responseFrame)
-                    .create(m_sessionKey);
-                ++m_sequenceNumber;
-            }
-            m_tcpSocket->write(responseFrame.bytes().toByteArray());
+            if (m_secureConfig.isValid())
+                writeSecureFrame(responseFrame);
+            else
+                writeFrame(responseFrame);
         } else {
-            m_udpSocket->writeDatagram(responseFrame.bytes().toByteArray(),
+            writeFrame(responseFrame,
                 m_remoteControlEndpoint.address, m_remoteControlEndpoint.port);
         }
 
@@ -1255,7 +1356,7 @@ void QKnxNetIpEndpointConnection::connectToHost(const QHostAddress &address, qui
     d->setAndEmitStateChanged(QKnxNetIpEndpointConnection::State::Connecting);
 
     qDebug() << "Sending connect request:" << request;
-    d->m_udpSocket->writeDatagram(request.bytes().toByteArray(),
+    d->writeFrame(request,
         d->m_remoteControlEndpoint.address, d->m_remoteControlEndpoint.port);
 
     if (d->m_connectRequestTimer)
@@ -1290,7 +1391,7 @@ void QKnxNetIpEndpointConnection::connectToHost(const QHostAddress &address, qui
         d->m_controlEndpointVersion = request.header().protocolVersion();
 
         qDebug() << "Sending connect request:" << request;
-        d->m_tcpSocket->write(request.bytes().toByteArray());
+        d->writeFrame(request);
         d->m_connectRequestTimer->start(QKnxNetIp::ConnectRequestTimeout);
     });
     d->m_tcpSocket->connectToHost(address, port);
@@ -1396,7 +1497,7 @@ void QKnxNetIpEndpointConnection::connectToHostEncrypted(const QHostAddress &add
         d->m_controlEndpointVersion = request.header().protocolVersion();
 
         qDebug() << "Sending secure session request:" << request;
-        d->m_tcpSocket->write(request.bytes().toByteArray());
+        d->writeFrame(request);
 
         QObject::connect(d->m_secureTimer, &QTimer::timeout, this, [&]() {
             Q_D(QKnxNetIpEndpointConnection);
@@ -1433,21 +1534,12 @@ void QKnxNetIpEndpointConnection::disconnectFromHost()
 
         qDebug() << "Sending disconnect request:" << frame;
         if (d->m_tcpSocket) {
-            if (d->m_secureConfig.isValid()) {
-                auto secureFrame = QKnxNetIpSecureWrapperProxy::secureBuilder()
-                    .setSecureSessionId(d->m_sessionId)
-                    .setSequenceNumber(d->m_sequenceNumber)
-                    .setSerialNumber(d->m_serialNumber)
-                    // .setMessageTag(0x0000) TODO: Do we need an API for this?
-                    .setEncapsulatedFrame(frame)
-                    .create(d->m_sessionKey);
-                ++(d->m_sequenceNumber);
-                d->m_tcpSocket->write(secureFrame.bytes().toByteArray());
-            } else {
-                d->m_tcpSocket->write(frame.bytes().toByteArray());
-            }
+            if (d->m_secureConfig.isValid())
+                d->writeSecureFrame(frame);
+            else
+                d->writeFrame(frame);
         } else {
-            d->m_udpSocket->writeDatagram(frame.bytes().toByteArray(),
+            d->writeFrame(frame,
                 d->m_remoteControlEndpoint.address, d->m_remoteControlEndpoint.port);
         }
 
@@ -41,6 +41,8 @@
 // We mean it.
 //
 
+#include <QtCore/qelapsedtimer.h>
+#include <QtCore/qqueue.h>
 #include <QtCore/qtimer.h>
 
 #include <QtKnx/qtknxglobal.h>
@@ -49,6 +51,9 @@
 #include <QtKnx/qknxlinklayerframe.h>
 #include <QtKnx/qknxnetipendpointconnection.h>
 #include <QtKnx/qknxnetipsecureconfiguration.h>
+#include <QtKnx/private/qknxnetipdatagramreader_p.h>
+#include <QtKnx/private/qknxnetipframereassembler_p.h>
+#include <QtKnx/private/qknxssl_p.h>
 
 #include <QtNetwork/qhostaddress.h>
 
@@ -122,6 +127,7 @@ struct Endpoint final
 class Q_KNX_EXPORT QKnxNetIpEndpointConnectionPrivate : public QObjectPrivate
 {
     Q_DECLARE_PUBLIC(QKnxNetIpEndpointConnection)
+    friend class QKnxNetIpTunnel;
 
 public:
     QKnxNetIpEndpointConnectionPrivate(const QHostAddress &address, quint16 port,
@@ -140,12 +146,26 @@ public:
     bool sendCemiRequest();
     void sendStateRequest();
 
+    qint64 writeFrame(const QKnxNetIpFrame &frame);
+    qint64 writeFrame(const QKnxNetIpFrame &frame, const QHostAddress &address, quint16 port);
+    qint64 writeSecureFrame(const QKnxNetIpFrame &frame);
+
     QKnxNetIp::ServiceType processReceivedFrame(const QKnxNetIpFrame &frame);
+    QKnxNetIp::ServiceType processReceivedDatagram(QKnxByteArrayView datagram);
+    QKnxNetIp::ServiceType processSecureWrapper(QKnxByteArrayView bytes);
     virtual void process(const QKnxLinkLayerFrame &frame);
     virtual void process(const QKnxDeviceManagementFrame &frame);
 
     // datapoint related processing
     bool sendTunnelingRequest(const QKnxLinkLayerFrame &frame);
+    bool transmitTunnelingRequest(const QKnxLinkLayerFrame &frame);
+    bool enqueueTunnelingRequest(const QKnxLinkLayerFrame &frame);
+    void sendQueuedTunnelingRequests();
+    void clearTunnelingRequests(bool notify);
+    virtual void tunnelingRequestQueued(const QKnxLinkLayerFrame &frame);
+    virtual void tunnelingRequestSent(const QKnxLinkLayerFrame &frame);
+    virtual void tunnelingRequestAcknowledged(const QKnxLinkLayerFrame &frame);
+    virtual void tunnelingRequestFailed(const QKnxLinkLayerFrame &frame);
     virtual void processTunnelingRequest(const QKnxNetIpFrame &frame);
     virtual void processTunnelingAcknowledge(const QKnxNetIpFrame &frame);
 
@@ -214,6 +234,19 @@ private:
     QKnxNetIpFrame m_lastSendCemiRequest {};
     QKnxNetIpFrame m_lastReceivedCemiRequest {};
 
+    // outbound tunneling queue, drained as acknowledges arrive
+    QQueue<QKnxLinkLayerFrame> m_sendQueue;
+    int m_sendQueueDepth { 0 };
+    bool m_sendQueueDropOldest { false };
+    bool m_waitForTunnelingAcknowledge { false };
+    QKnxLinkLayerFrame m_pendingTunnelingRequest;
+
+    QElapsedTimer m_sendRateTimer;
+    QElapsedTimer m_acknowledgeTime;
+    qint64 m_acknowledgeTimeTotal { 0 };
+    qint64 m_lastAcknowledgeAt { 0 };
+    int m_acknowledgedRequests { 0 };
+
     int m_stateRequests { 0 };
     const int m_maxStateRequests = { 3 };
     QKnxNetIpFrame m_lastStateRequest {};
@@ -237,8 +270,9 @@ private:
     bool m_waitForAcknowledgement { false };
 
     QUdpSocket *m_udpSocket { nullptr };
+    QKnxNetIpDatagramReader m_datagramReader;
     QTcpSocket *m_tcpSocket { nullptr };
-    QKnxByteArray m_rxBuffer;
+    QKnxNetIpFrameReassembler m_rxReassembler;
 
     UserProperties m_user;
 
@@ -247,6 +281,7 @@ private:
     bool m_waitForAuthentication { false };
 
     QKnxByteArray m_sessionKey;
+    QKnxSslCipherContext m_sessionCipher;
     QTimer *m_secureTimer { nullptr };
     QKnxNetIpSecureConfiguration m_secureConfig;
 
@@ -79,6 +79,16 @@ QKnxNetIpFrame::QKnxNetIpFrame(QKnxNetIp::ServiceType type, const QKnxByteArray
     : QKnxNetIpFrame(type, {}, data)
 {}
 
+/*!
+    \overload
+
+    Creates a new KNXnet/IP frame with the given service type \a type and
+    moves \a data into the frame without copying it.
+*/
+QKnxNetIpFrame::QKnxNetIpFrame(QKnxNetIp::ServiceType type, QKnxByteArray &&data)
+    : QKnxNetIpFrame(type, {}, std::move(data))
+{}
+
 /*!
     Creates a new KNXnet/IP frame with the given service type \a type,
     connection header set to \a connectionHeader, and data set to \a data.
@@ -92,6 +102,22 @@ QKnxNetIpFrame::QKnxNetIpFrame(QKnxNetIp::ServiceType type,
     d_ptr->m_header = { type, quint16(connectionHeader.size() + data.size()) };
 }
 
+/*!
+    \overload
+
+    Creates a new KNXnet/IP frame with the given service type \a type,
+    connection header set to \a connectionHeader, and moves \a data into the
+    frame without copying it.
+*/
+QKnxNetIpFrame::QKnxNetIpFrame(QKnxNetIp::ServiceType type,
+        const QKnxNetIpConnectionHeader &connectionHeader, QKnxByteArray &&data)
+    : d_ptr(new QKnxNetIpFramePrivate)
+{
+    d_ptr->m_connectionHeader = connectionHeader;
+    d_ptr->m_header = { type, quint16(connectionHeader.size() + data.size()) };
+    d_ptr->m_data = std::move(data);
+}
+
 /*!
     Creates a new KNXnet/IP frame with the given frame header \a header,
     connection header set to \a connectionHeader, and data set to \a data.
@@ -305,12 +331,70 @@ void QKnxNetIpFrame::setData(const QKnxByteArray &data)
     d_ptr->m_header.setDataSize(dataSize + data.size());
 }
 
+/*!
+    \overload
+
+    Moves \a data into the data part of the KNXnet/IP frame without copying it
+    and updates the total size accordingly.
+*/
+void QKnxNetIpFrame::setData(QKnxByteArray &&data)
+{
+    auto dataSize = d_ptr->m_header.dataSize() - d_ptr->m_data.size();
+    d_ptr->m_header.setDataSize(dataSize + data.size());
+    d_ptr->m_data = std::move(data);
+}
+
 /*!
     Returns an array of bytes that represent the KNXnet/IP frame.
 */
 QKnxByteArray QKnxNetIpFrame::bytes() const
 {
-    return d_ptr->m_header.bytes() + d_ptr->m_connectionHeader.bytes() + d_ptr->m_data;
+    if (!isValid())
+        return d_ptr->m_header.bytes() + d_ptr->m_connectionHeader.bytes() + d_ptr->m_data;
+
+    QKnxByteArray bytes(size(), Qt::Uninitialized);
+    serialize(bytes.data(), bytes.size());
+    return bytes;
+}
+
+/*!
+    Writes the KNXnet/IP frame to the memory pointed to by \a out, which can
+    hold up to \a capacity bytes. Returns the number of bytes written, which
+    equals size(). If the frame is not valid or \a capacity is too small,
+    nothing is written and \c 0 is returned.
+
+    The header, the optional connection header, and the frame's data are
+    copied into the given memory in a single pass, without creating
+    intermediate byte arrays.
+
+    \sa bytes(), writeTo()
+*/
+int QKnxNetIpFrame::serialize(quint8 *out, int capacity) const
+{
+    if (!isValid() || capacity < size())
+        return 0;
+
+    int written = d_ptr->m_header.serialize(out, capacity);
+    written += d_ptr->m_connectionHeader.serialize(out + written, capacity - written);
+
+    const auto &data = d_ptr->m_data;
+    memcpy(out + written, data.constData(), data.size());
+    return written + data.size();
+}
+
+/*!
+    Appends the KNXnet/IP frame to \a out if the frame is valid.
+
+    \sa bytes(), serialize()
+*/
+void QKnxNetIpFrame::writeTo(QKnxByteArray &out) const
+{
+    if (!isValid())
+        return;
+
+    const int offset = out.size();
+    out.resize(offset + size());
+    serialize(out.data() + offset, out.size() - offset);
 }
 
 /*!
@@ -318,6 +402,17 @@ QKnxByteArray QKnxNetIpFrame::bytes() const
     at position \a index inside the array.
 */
 QKnxNetIpFrame QKnxNetIpFrame::fromBytes(const QKnxByteArray &bytes, quint16 index)
+{
+    return fromBytes(QKnxByteArrayView(bytes), index);
+}
+
+/*!
+    \overload
+
+    The bytes are read directly from the memory referenced by the view, without
+    creating intermediate copies.
+*/
+QKnxNetIpFrame QKnxNetIpFrame::fromBytes(QKnxByteArrayView bytes, quint16 index)
 {
     auto header = QKnxNetIpFrameHeader::fromBytes(bytes, index);
     if (!header.isValid())
@@ -346,7 +441,9 @@ QKnxNetIpFrame QKnxNetIpFrame::fromBytes(const QKnxByteArray &bytes, quint16 ind
     const auto dataSize = header.totalSize() - index;
     if ((bytes.size() - index) < dataSize)
         return {};
-    return { header, connHeader, bytes.mid(index, dataSize) };
+    QKnxNetIpFrame frame(header, connHeader);
+    frame.d_ptr->m_data = bytes.mid(index, dataSize).toByteArray();
+    return frame;
 }
 
 /*!
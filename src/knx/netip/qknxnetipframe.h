@@ -33,6 +33,7 @@
 #include <QtCore/qshareddata.h>
 
 #include <QtKnx/qknxbytearray.h>
+#include <QtKnx/qknxbytearrayview.h>
 #include <QtKnx/qknxnetip.h>
 #include <QtKnx/qknxnetipconnectionheader.h>
 #include <QtKnx/qknxnetipframeheader.h>
@@ -47,8 +48,11 @@ public:
     ~QKnxNetIpFrame();
 
     QKnxNetIpFrame(QKnxNetIp::ServiceType type, const QKnxByteArray &data = {});
+    QKnxNetIpFrame(QKnxNetIp::ServiceType type, QKnxByteArray &&data);
     QKnxNetIpFrame(QKnxNetIp::ServiceType type,
         const QKnxNetIpConnectionHeader &connectionHeader, const QKnxByteArray &data = {});
+    QKnxNetIpFrame(QKnxNetIp::ServiceType type,
+        const QKnxNetIpConnectionHeader &connectionHeader, QKnxByteArray &&data);
     QKnxNetIpFrame(const QKnxNetIpFrameHeader &header,
         const QKnxNetIpConnectionHeader &connectionHeader, const QKnxByteArray &data = {});
 
@@ -77,9 +81,13 @@ public:
     QKnxByteArray data() const;
     const QKnxByteArray &constData() const;
     void setData(const QKnxByteArray &data);
+    void setData(QKnxByteArray &&data);
 
     QKnxByteArray bytes() const;
+    int serialize(quint8 *out, int capacity) const;
+    void writeTo(QKnxByteArray &out) const;
     static QKnxNetIpFrame fromBytes(const QKnxByteArray &bytes, quint16 index = 0);
+    static QKnxNetIpFrame fromBytes(QKnxByteArrayView bytes, quint16 index = 0);
 
     QKnxNetIpFrame(const QKnxNetIpFrame &other);
     QKnxNetIpFrame &operator=(const QKnxNetIpFrame &other);
@@ -242,6 +242,36 @@ QKnxByteArray QKnxNetIpFrameHeader::bytes() const
     return { m_bytes[0], m_bytes[1], m_bytes[2], m_bytes[3], m_bytes[4], m_bytes[5] };
 }
 
+/*!
+    Writes the bytes that represent the KNXnet/IP frame header to the memory
+    pointed to by \a out, which can hold up to \a capacity bytes. Returns the
+    number of bytes written. If the header is not valid or \a capacity is too
+    small, nothing is written and \c 0 is returned.
+
+    \sa bytes(), writeTo()
+*/
+int QKnxNetIpFrameHeader::serialize(quint8 *out, int capacity) const
+{
+    if (!isValid() || capacity < int(sizeof(m_bytes)))
+        return 0;
+    memcpy(out, m_bytes, sizeof(m_bytes));
+    return int(sizeof(m_bytes));
+}
+
+/*!
+    Appends the bytes that represent the KNXnet/IP frame header to \a out.
+
+    \sa bytes(), serialize()
+*/
+void QKnxNetIpFrameHeader::writeTo(QKnxByteArray &out) const
+{
+    if (!isValid())
+        return;
+    const int offset = out.size();
+    out.resize(offset + int(sizeof(m_bytes)));
+    serialize(out.data() + offset, int(sizeof(m_bytes)));
+}
+
 /*!
     Constructs the KNXnet/IP frame header from the byte array \a bytes starting
     at position \a index inside the array.
@@ -249,6 +279,17 @@ QKnxByteArray QKnxNetIpFrameHeader::bytes() const
     \sa isNull(), isValid()
 */
 QKnxNetIpFrameHeader QKnxNetIpFrameHeader::fromBytes(const QKnxByteArray &bytes, quint16 index)
+{
+    return fromBytes(QKnxByteArrayView(bytes), index);
+}
+
+/*!
+    \overload
+
+    The bytes are read directly from the memory referenced by the view, without
+    creating intermediate copies.
+*/
+QKnxNetIpFrameHeader QKnxNetIpFrameHeader::fromBytes(QKnxByteArrayView bytes, quint16 index)
 {
     const qint32 availableSize = bytes.size() - index;
     if (availableSize < 1)
@@ -31,6 +31,7 @@
 #define QKNXNETIPFRAMEHEADER_H
 
 #include <QtKnx/qknxbytearray.h>
+#include <QtKnx/qknxbytearrayview.h>
 #include <QtKnx/qknxnetip.h>
 
 QT_BEGIN_NAMESPACE
@@ -66,8 +67,11 @@ public:
 
     quint8 byte(quint8 index) const;
     QKnxByteArray bytes() const;
+    int serialize(quint8 *out, int capacity) const;
+    void writeTo(QKnxByteArray &out) const;
 
     static QKnxNetIpFrameHeader fromBytes(const QKnxByteArray &bytes, quint16 index = 0);
+    static QKnxNetIpFrameHeader fromBytes(QKnxByteArrayView bytes, quint16 index = 0);
 
     bool operator==(const QKnxNetIpFrameHeader &other) const;
     bool operator!=(const QKnxNetIpFrameHeader &other) const;
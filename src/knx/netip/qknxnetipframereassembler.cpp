@@ -0,0 +1,164 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtKnx module.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include "qknxnetipframereassembler_p.h"
+#include "qknxnetipframeheader.h"
+
+#include <QtCore/qvarlengtharray.h>
+
+#include <string.h>
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \internal
+    \class QKnxNetIpFrameReassembler
+
+    \brief The QKnxNetIpFrameReassembler class splits a KNXnet/IP byte stream,
+    as received over TCP, into frames.
+
+    The bytes read from the socket are appended to a ring buffer of fixed
+    capacity. Every complete frame can then be taken out of the buffer, no
+    matter how the frames were split or coalesced into TCP segments, see
+    AN184 v03 KNXnet-IP Core v2 AS, paragraph 2.2.3.2.3.2.
+
+    The memory used never exceeds the capacity. A frame header announcing a
+    frame bigger than the capacity, or an invalid frame header, puts the
+    reassembler into an error state, as the frame boundaries of the stream
+    are lost at that point. The connection should be closed then.
+*/
+
+/*!
+    Creates a reassembler able to buffer \a capacity bytes, which is also the
+    maximum size of a single frame.
+*/
+QKnxNetIpFrameReassembler::QKnxNetIpFrameReassembler(int capacity)
+    : m_buffer(qMax(int(QKnxNetIpFrameHeader::HeaderSize10), capacity))
+{}
+
+/*!
+    Appends as much of \a data as fits into the free space of the buffer and
+    returns the number of bytes appended.
+*/
+int QKnxNetIpFrameReassembler::append(QKnxByteArrayView data)
+{
+    const int count = qMin(data.size(), freeSpace());
+    if (count <= 0)
+        return 0;
+
+    const int capacity = m_buffer.size();
+    const int tail = (m_head + m_size) % capacity;
+    const int first = qMin(count, capacity - tail);
+    memcpy(m_buffer.data() + tail, data.data(), size_t(first));
+    if (first < count)
+        memcpy(m_buffer.data(), data.data() + first, size_t(count - first));
+
+    m_size += count;
+    return count;
+}
+
+/*!
+    Takes the next complete frame out of the buffer and stores it in \a frame.
+    Returns \c true if a frame was taken, otherwise returns \c false, in which
+    case either more data is needed or error() is set.
+
+    \note The stored frame might be invalid if its header was well-formed but
+    its body was not. The frame boundaries are intact in that case and the
+    caller can just discard the frame.
+*/
+bool QKnxNetIpFrameReassembler::takeFrame(QKnxNetIpFrame *frame)
+{
+    if (hasError() || !frame || m_size < QKnxNetIpFrameHeader::HeaderSize10)
+        return false;
+
+    quint8 headerBytes[QKnxNetIpFrameHeader::HeaderSize10];
+    peek(headerBytes, QKnxNetIpFrameHeader::HeaderSize10);
+
+    const auto header = QKnxNetIpFrameHeader::fromBytes(QKnxByteArrayView(headerBytes,
+        QKnxNetIpFrameHeader::HeaderSize10));
+    if (!header.isValid()) {
+        m_error = Error::InvalidHeader;
+        return false;
+    }
+
+    const int totalSize = header.totalSize();
+    if (totalSize > capacity()) {
+        m_error = Error::FrameTooLarge;
+        return false;
+    }
+
+    if (m_size < totalSize)
+        return false;
+
+    if (m_head + totalSize <= capacity()) {
+        *frame = QKnxNetIpFrame::fromBytes(QKnxByteArrayView(m_buffer.constData() + m_head,
+            totalSize));
+    } else {
+        QVarLengthArray<quint8, 256> bytes(totalSize);
+        peek(bytes.data(), totalSize);
+        *frame = QKnxNetIpFrame::fromBytes(QKnxByteArrayView(bytes.constData(), totalSize));
+    }
+
+    m_head = (m_head + totalSize) % capacity();
+    m_size -= totalSize;
+    if (m_size == 0)
+        m_head = 0;
+    return true;
+}
+
+/*!
+    Discards all buffered bytes and resets the error state.
+*/
+void QKnxNetIpFrameReassembler::clear()
+{
+    m_head = 0;
+    m_size = 0;
+    m_error = Error::None;
+}
+
+void QKnxNetIpFrameReassembler::peek(quint8 *out, int count) const
+{
+    const int first = qMin(count, capacity() - m_head);
+    memcpy(out, m_buffer.constData() + m_head, size_t(first));
+    if (first < count)
+        memcpy(out + first, m_buffer.constData(), size_t(count - first));
+}
+
+QT_END_NAMESPACE
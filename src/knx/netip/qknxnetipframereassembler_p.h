@@ -0,0 +1,101 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtKnx module.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#ifndef QKNXNETIPFRAMEREASSEMBLER_P_H
+#define QKNXNETIPFRAMEREASSEMBLER_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt KNX API.  It exists for the convenience
+// of the Qt KNX implementation.  This header file may change from version
+// to version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/qvector.h>
+
+#include <QtKnx/qtknxglobal.h>
+#include <QtKnx/qknxbytearrayview.h>
+#include <QtKnx/qknxnetipframe.h>
+
+QT_BEGIN_NAMESPACE
+
+class Q_AUTOTEST_EXPORT QKnxNetIpFrameReassembler final
+{
+public:
+    enum : int { DefaultCapacity = 4096 };
+
+    enum class Error : quint8
+    {
+        None,
+        InvalidHeader,
+        FrameTooLarge
+    };
+
+    explicit QKnxNetIpFrameReassembler(int capacity = DefaultCapacity);
+
+    int capacity() const { return m_buffer.size(); }
+    int size() const { return m_size; }
+    int freeSpace() const { return m_buffer.size() - m_size; }
+
+    int append(QKnxByteArrayView data);
+    bool takeFrame(QKnxNetIpFrame *frame);
+
+    Error error() const { return m_error; }
+    bool hasError() const { return m_error != Error::None; }
+
+    void clear();
+
+private:
+    void peek(quint8 *out, int count) const;
+
+private:
+    QVector<quint8> m_buffer;
+    int m_head { 0 };
+    int m_size { 0 };
+    Error m_error { Error::None };
+};
+
+QT_END_NAMESPACE
+
+#endif
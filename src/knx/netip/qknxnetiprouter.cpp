@@ -209,6 +209,23 @@ QT_BEGIN_NAMESPACE
 
     This signal is emitted when the KNXnet/IP router receives a routing indication
     \a frame and specifies the action \a routingAction to be applied by the router.
+
+    The frame is only constructed if this signal is connected. Connect to
+    routingIndicationCemiReceived() instead to get the already decoded cEMI
+    frame without an additional copy.
+
+    \sa routingIndicationCemiReceived()
+*/
+
+/*!
+    \fn void QKnxNetIpRouter::routingIndicationCemiReceived(QKnxLinkLayerFrame cemi, QKnxNetIpRouter::FilterAction routingAction)
+    \since 6.2
+
+    This signal is emitted for every valid routing indication, right after
+    routingIndicationReceived(). It passes the cEMI frame \a cemi carried by the
+    routing indication and the action \a routingAction to be applied by the
+    router. The router decodes the frame only once, so there is no need to
+    construct a QKnxNetIpRoutingIndicationProxy to access it.
 */
 
 /*!
@@ -304,11 +321,56 @@ QKnxNetIpRouter::KnxAddressWhitelist QKnxNetIpRouter::filterTable() const
 
 /*!
     Sets the filter table used by the routing algorithm to \a table.
+
+    Only group addresses of \a table are taken into account when routing
+    telegrams in \l {RoutingMode}{Filter} mode.
+
+    \sa setGroupAddressFilterTable()
  */
 void QKnxNetIpRouter::setFilterTable(const QKnxNetIpRouter::KnxAddressWhitelist &table)
 {
     Q_D(QKnxNetIpRouter);
     d->m_filterTable = table;
+    d->m_groupAddressFilter = QKnxGroupAddressFilterTable(table);
+}
+
+/*!
+    \since 6.2
+
+    Returns the group address filter table used by the routing algorithm.
+*/
+QKnxGroupAddressFilterTable QKnxNetIpRouter::groupAddressFilterTable() const
+{
+    Q_D(const QKnxNetIpRouter);
+    return d->m_groupAddressFilter;
+}
+
+/*!
+    \since 6.2
+
+    Sets the group address filter table used by the routing algorithm to
+    \a table. This is the preferred way to set up large filter tables, for
+    example all group addresses of a project or whole main groups, as no
+    per-address set has to be built.
+
+    The group addresses returned by filterTable() are replaced by the ones
+    of \a table, individual addresses set with setFilterTable() are kept.
+
+    \sa filterTable()
+*/
+void QKnxNetIpRouter::setGroupAddressFilterTable(const QKnxGroupAddressFilterTable &table)
+{
+    Q_D(QKnxNetIpRouter);
+    d->m_groupAddressFilter = table;
+
+    auto &filterTable = d->m_filterTable;
+    for (auto it = filterTable.begin(); it != filterTable.end();) {
+        if (it->type() == QKnxAddress::Type::Group)
+            it = filterTable.erase(it);
+        else
+            ++it;
+    }
+    filterTable.unite(table.toSet());
 }
 
 /*!
@@ -467,6 +529,28 @@ void QKnxNetIpRouter::sendRoutingIndication(const QKnxNetIpFrame &frame)
     }
 }
 
+/*!
+    \since 6.2
+
+    Multicasts a routing indication for each cEMI frame of \a frames through
+    the network interface associated with the QKnxNetIpRouter. Frames that are
+    not data indications or are too short to hold a cEMI data frame are
+    skipped.
+
+    This is considerably faster than calling sendRoutingIndication() for every
+    single frame, as the frames are serialized into one buffer and handed to
+    the socket in a single system call where supported. The routing state is
+    checked once for the whole batch, so either all frames or none are sent
+    while the neighbor router is busy.
+
+    The routingIndicationSent() signal is emitted for every frame sent.
+*/
+void QKnxNetIpRouter::sendRoutingIndications(const QList<QKnxLinkLayerFrame> &frames)
+{
+    Q_D(QKnxNetIpRouter);
+    d->sendRoutingIndications(frames);
+}
+
 /*!
     Multicasts the routing busy message containing \a frame through the
     network interface associated with the QKnxNetIpRouter.
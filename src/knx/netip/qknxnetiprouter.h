@@ -31,6 +31,7 @@
 #define QKNXNETIPROUTER_H
 
 #include <QtKnx/qknxaddress.h>
+#include <QtKnx/qknxgroupaddressfiltertable.h>
 #include <QtKnx/qknxnetipframe.h>
 #include <QtKnx/qknxlinklayerframe.h>
 #include <QtKnx/qtknxglobal.h>
@@ -99,6 +100,9 @@ public:
     KnxAddressWhitelist filterTable() const;
     void setFilterTable(const KnxAddressWhitelist &table);
 
+    QKnxGroupAddressFilterTable groupAddressFilterTable() const;
+    void setGroupAddressFilterTable(const QKnxGroupAddressFilterTable &table);
+
     QNetworkInterface interfaceAffinity() const;
     void setInterfaceAffinity(const QHostAddress &address);
     void setInterfaceAffinity(const QNetworkInterface &iface);
@@ -111,6 +115,7 @@ public:
 
 public Q_SLOTS:
     void sendRoutingIndication(const QKnxNetIpFrame &frame);
+    void sendRoutingIndications(const QList<QKnxLinkLayerFrame> &frames);
     void sendRoutingBusy(const QKnxNetIpFrame &frame);
     void sendRoutingLostMessage(const QKnxNetIpFrame &frame);
     void sendRoutingSystemBroadcast(const QKnxNetIpFrame &frame);
@@ -125,6 +130,8 @@ Q_SIGNALS:
     void routingSystemBroadcastSent(QKnxNetIpFrame frame);
 
     void routingIndicationReceived(QKnxNetIpFrame frame, QKnxNetIpRouter::FilterAction action);
+    void routingIndicationCemiReceived(QKnxLinkLayerFrame cemi,
+        QKnxNetIpRouter::FilterAction action);
     void routingBusyReceived(QKnxNetIpFrame frame);
     void routingLostCountReceived(QKnxNetIpFrame frame);
     void routingSystemBroadcastReceived(QKnxNetIpFrame frame);
@@ -38,10 +38,39 @@
 #include "qknxnetiptestrouter_p.h"
 #endif
 
+#include <QtCore/qendian.h>
+#include <QtCore/qmetaobject.h>
 #include <QtCore/qrandom.h>
+#include <QtCore/qvarlengtharray.h>
+
+#if defined(Q_OS_LINUX) && !defined(Q_OS_ANDROID)
+# define QKNX_HAVE_SENDMMSG
+# include <errno.h>
+# include <netinet/in.h>
+# include <sys/socket.h>
+#endif
 
 QT_BEGIN_NAMESPACE
 
+namespace QKnxPrivate
+{
+    // A cEMI L_Data frame carries the message code, the additional info length
+    // and the additional info, two control fields, the source and destination
+    // address, the NPDU length and the TPCI, followed by NPDU length data bytes.
+    enum { MinimumCemiDataSize = 10 };
+
+    static bool isRoutingIndicationCemiValid(QKnxByteArrayView cemi)
+    {
+        if (cemi.size() < MinimumCemiDataSize || QKnxLinkLayerFrame::MessageCode(cemi.at(0))
+            != QKnxLinkLayerFrame::MessageCode::DataIndication) {
+            return false;
+        }
+        const int npduLengthIndex = 2 + cemi.at(1) + 6;
+        return npduLengthIndex < cemi.size()
+            && cemi.size() == MinimumCemiDataSize + cemi.at(1) + cemi.at(npduLengthIndex);
+    }
+}
+
 void QKnxNetIpRouterPrivate::errorOccurred(QKnxNetIpRouter::Error error,
     const QString &errorString)
 {
@@ -167,36 +196,39 @@ void QKnxNetIpRouterPrivate::start()
         m_sameKnxDstAddressIndicationCount = 0;
         m_lastIndicationAddress = QKnxAddress();
         while (m_socket && m_socket->state() == QUdpSocket::BoundState
-            && m_socket->hasPendingDatagrams()) {
-
-            QNetworkDatagram datagram = m_socket->receiveDatagram();
-            if (datagram.senderAddress() == m_ownAddress
-                || m_framesReadCount == 10 // incoming queue too big, signal busy
-                || m_sameKnxDstAddressIndicationCount == 5) {
+            && m_datagramReader.readDatagrams(m_socket) > 0) {
+
+            // The datagrams are handed out as views into the reader's buffers,
+            // they stay valid until the next call to readDatagrams().
+            for (int i = 0; m_socket && i < m_datagramReader.count(); ++i) {
+                if (m_framesReadCount == 10 // incoming queue too big, signal busy
+                    || m_sameKnxDstAddressIndicationCount == 5
+                    || m_datagramReader.senderAddress(i) == m_ownAddress) {
+                        continue; // discard packet
+                }
+
+                const auto data = m_datagramReader.data(i);
+                const auto header = QKnxNetIpFrameHeader::fromBytes(data, 0);
+                if (!header.isValid() || header.totalSize() != data.size())
                     continue; // discard packet
-            }
-
-            auto data = QKnxByteArray::fromByteArray(datagram.data());
-            const auto header = QKnxNetIpFrameHeader::fromBytes(data, 0);
-            if (!header.isValid() || header.totalSize() != data.size())
-                continue; // discard packet
 
-            m_framesReadCount++;
-            switch (header.serviceType()) {
-            case QKnxNetIp::ServiceType::RoutingIndication:
-                processRoutingIndication(QKnxNetIpFrame::fromBytes(data, 0));
-                break;
-            case QKnxNetIp::ServiceType::RoutingBusy:
-                processRoutingBusy(QKnxNetIpFrame::fromBytes(data, 0));
-                break;
-            case QKnxNetIp::ServiceType::RoutingLostMessage:
-                processRoutingLostMessage(QKnxNetIpFrame::fromBytes(data, 0));
-                break;
-            case QKnxNetIp::ServiceType::RoutingSystemBroadcast:
-                processRoutingSystemBroadcast(QKnxNetIpFrame::fromBytes(data, 0));
-                break;
-            default:
-                break;
+                m_framesReadCount++;
+                switch (header.serviceType()) {
+                case QKnxNetIp::ServiceType::RoutingIndication:
+                    processRoutingIndication(header, data);
+                    break;
+                case QKnxNetIp::ServiceType::RoutingBusy:
+                    processRoutingBusy(QKnxNetIpFrame::fromBytes(data, 0));
+                    break;
+                case QKnxNetIp::ServiceType::RoutingLostMessage:
+                    processRoutingLostMessage(QKnxNetIpFrame::fromBytes(data, 0));
+                    break;
+                case QKnxNetIp::ServiceType::RoutingSystemBroadcast:
+                    processRoutingSystemBroadcast(QKnxNetIpFrame::fromBytes(data, 0));
+                    break;
+                default:
+                    break;
+                }
             }
         }
 
@@ -263,17 +295,25 @@ void QKnxNetIpRouterPrivate::cleanup()
     m_error = QKnxNetIpRouter::Error::None;
 }
 
-void QKnxNetIpRouterPrivate::processRoutingIndication(const QKnxNetIpFrame &frame)
+void QKnxNetIpRouterPrivate::processRoutingIndication(const QKnxNetIpFrameHeader &header,
+    QKnxByteArrayView data)
 {
-    QKnxNetIpRoutingIndicationProxy indication(frame);
-    if (!indication.isValid()) {
+    // The header has already been validated against the datagram size. A routing
+    // indication carries no connection header, so the cEMI follows directly and
+    // is decoded only once, straight from the datagram.
+    const quint16 cemiIndex = header.size();
+    const quint16 cemiSize = header.totalSize() - cemiIndex;
+    const auto cemiData = data.mid(cemiIndex, cemiSize);
+
+    if (!QKnxPrivate::isRoutingIndicationCemiValid(cemiData)) {
         errorOccurred(QKnxNetIpRouter::Error::KnxRouting,
             QKnxNetIpRouter::tr("QKnxNetIp Routing Indication Message is not "
                 "correctly formed."));
         return;
     }
 
-    auto cemi = indication.cemi();
+    const auto cemi = QKnxLinkLayerFrame::fromBytes(cemiData, 0, cemiSize,
+        QKnx::MediumType::NetIP);
     auto currentDstAddress = cemi.destinationAddress();
     if (currentDstAddress.type() == QKnxAddress::Type::Individual
         && m_lastIndicationAddress == currentDstAddress) {
@@ -284,7 +324,17 @@ void QKnxNetIpRouterPrivate::processRoutingIndication(const QKnxNetIpFrame &fram
     }
 
     Q_Q(QKnxNetIpRouter);
-    emit q->routingIndicationReceived(frame, filterAction(cemi));
+    const auto action = filterAction(cemi);
+
+    // Only build the frame if someone listens for it; the header and the cEMI
+    // have been checked above, so the frame is valid by construction.
+    static const auto frameSignal =
+        QMetaMethod::fromSignal(&QKnxNetIpRouter::routingIndicationReceived);
+    if (q->isSignalConnected(frameSignal)) {
+        emit q->routingIndicationReceived(QKnxNetIpFrame(header, {}, cemiData.toByteArray()),
+            action);
+    }
+    emit q->routingIndicationCemiReceived(cemi, action);
 }
 
 void QKnxNetIpRouterPrivate::processRoutingBusy(const QKnxNetIpFrame &frame)
@@ -331,9 +381,118 @@ bool QKnxNetIpRouterPrivate::sendFrame(const QKnxNetIpFrame &frame)
     if (m_state != QKnxNetIpRouter::State::Routing)
         return true; // no errors, only ignore the frame
 
-    return m_socket->writeDatagram(frame.bytes().toByteArray(),
-        m_multicastAddress,
-        m_multicastPort) != -1;
+    QVarLengthArray<quint8, 256> buffer(frame.size());
+    if (frame.serialize(buffer.data(), buffer.size()) == 0) {
+        return m_socket->writeDatagram(frame.bytes().toByteArray(),
+            m_multicastAddress,
+            m_multicastPort) != -1;
+    }
+
+    return m_socket->writeDatagram(reinterpret_cast<const char *> (buffer.constData()),
+        buffer.size(), m_multicastAddress, m_multicastPort) != -1;
+}
+
+void QKnxNetIpRouterPrivate::sendRoutingIndications(const QList<QKnxLinkLayerFrame> &frames)
+{
+    // The router state, and therefore the flow control, is checked once for
+    // the whole batch.
+    if (m_state != QKnxNetIpRouter::State::Routing || frames.isEmpty())
+        return;
+
+    const int headerSize = QKnxNetIpFrameHeader::HeaderSize10;
+
+    QVarLengthArray<int, 64> frameIndexes;
+    QVarLengthArray<QKnxByteArrayView, 64> datagrams;
+
+    int totalSize = 0;
+    QVarLengthArray<int, 64> sizes;
+    for (int i = 0; i < frames.size(); ++i) {
+        const auto &cemi = frames.at(i);
+        const int cemiSize = cemi.size();
+        if (cemi.messageCode() != QKnxLinkLayerFrame::MessageCode::DataIndication
+            || cemiSize < QKnxPrivate::MinimumCemiDataSize + cemi.additionalInfosSize()
+            || cemiSize > 0xffff - headerSize) {
+            continue;
+        }
+        frameIndexes.append(i);
+        sizes.append(headerSize + cemiSize);
+        totalSize += headerSize + cemiSize;
+    }
+    if (frameIndexes.isEmpty())
+        return;
+
+    // All datagrams are serialized into a single buffer that is reused between
+    // batches, the views are taken once the buffer does not grow anymore.
+    m_sendBuffer.resize(totalSize);
+    auto out = m_sendBuffer.data();
+    for (int i = 0; i < frameIndexes.size(); ++i) {
+        const int size = sizes.at(i);
+        QKnxNetIpFrameHeader(QKnxNetIp::ServiceType::RoutingIndication, quint16(size - headerSize))
+            .serialize(out, headerSize);
+        frames.at(frameIndexes.at(i)).serialize(out + headerSize, size - headerSize);
+        datagrams.append({ out, size });
+        out += size;
+    }
+
+    const int sent = writeDatagrams(datagrams.constData(), datagrams.size());
+
+    Q_Q(QKnxNetIpRouter);
+    if (q->isSignalConnected(QMetaMethod::fromSignal(&QKnxNetIpRouter::routingIndicationSent))) {
+        for (int i = 0; i < sent; ++i)
+            emit q->routingIndicationSent(QKnxNetIpFrame::fromBytes(datagrams.at(i)));
+    }
+
+    if (sent != datagrams.size()) {
+        errorOccurred(QKnxNetIpRouter::Error::KnxRouting, QKnxNetIpRouter::tr("Could not "
+            "send routing indication."));
+    }
+}
+
+int QKnxNetIpRouterPrivate::writeDatagrams(const QKnxByteArrayView *datagrams, int count)
+{
+    int sent = 0;
+
+#ifdef QKNX_HAVE_SENDMMSG
+    if (m_multicastAddress.protocol() == QAbstractSocket::IPv4Protocol) {
+        sockaddr_in to {};
+        to.sin_family = AF_INET;
+        to.sin_port = qToBigEndian(m_multicastPort);
+        to.sin_addr.s_addr = qToBigEndian(m_multicastAddress.toIPv4Address());
+
+        QVarLengthArray<iovec, 64> iovecs(count);
+        QVarLengthArray<mmsghdr, 64> headers(count);
+        for (int i = 0; i < count; ++i) {
+            iovecs[i].iov_base = const_cast<quint8 *> (datagrams[i].data());
+            iovecs[i].iov_len = size_t(datagrams[i].size());
+
+            headers[i] = {};
+            headers[i].msg_hdr.msg_name = &to;
+            headers[i].msg_hdr.msg_namelen = sizeof(to);
+            headers[i].msg_hdr.msg_iov = &iovecs[i];
+            headers[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        const int fd = int(m_socket->socketDescriptor());
+        while (sent < count) {
+            const int result = ::sendmmsg(fd, headers.data() + sent, unsigned(count - sent), 0);
+            if (result < 0 && errno == EINTR)
+                continue;
+            if (result <= 0)
+                break;
+            sent += result;
+        }
+    }
+#endif
+
+    // Whatever could not be sent in a batch goes through QUdpSocket, which
+    // also takes care of reporting socket errors.
+    for (; sent < count; ++sent) {
+        if (m_socket->writeDatagram(reinterpret_cast<const char *> (datagrams[sent].data()),
+            datagrams[sent].size(), m_multicastAddress, m_multicastPort) == -1) {
+            break;
+        }
+    }
+    return sent;
 }
 
 void QKnxNetIpRouterPrivate::flowControlHandling(quint16 newBusyWaitTime)
@@ -367,7 +526,7 @@ QKnxNetIpRouter::FilterAction
     if (dst.type() == QKnxAddress::Type::Group) {
         bool routingCondition = true;
         if (m_routingMode == QKnxNetIpRouter::RoutingMode::Filter)
-            routingCondition = m_filterTable.contains(dst);
+            routingCondition = m_groupAddressFilter.contains(dst);
         if (m_routingMode == QKnxNetIpRouter::RoutingMode::Block)
             return QKnxNetIpRouter::FilterAction::IgnoreTotally;
         if (routingCondition && hopCount > 0 && hopCount <= 7)
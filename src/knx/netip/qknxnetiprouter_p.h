@@ -44,6 +44,8 @@
 #include <QtCore/qtimer.h>
 #include <QtCore/private/qobject_p.h>
 
+#include <QtKnx/qknxgroupaddressfiltertable.h>
+#include <QtKnx/private/qknxnetipdatagramreader_p.h>
 #include <QtKnx/qknxnetip.h>
 #include <QtKnx/qknxnetipframe.h>
 #include <QtKnx/qknxnetiprouter.h>
@@ -67,12 +69,14 @@ public:
 
     void cleanup();
 
-    void processRoutingIndication(const QKnxNetIpFrame &frame);
+    void processRoutingIndication(const QKnxNetIpFrameHeader &header, QKnxByteArrayView data);
     void processRoutingBusy(const QKnxNetIpFrame &frame);
     void processRoutingLostMessage(const QKnxNetIpFrame &frame);
     void processRoutingSystemBroadcast(const QKnxNetIpFrame &frame);
 
     bool sendFrame(const QKnxNetIpFrame &frame);
+    void sendRoutingIndications(const QList<QKnxLinkLayerFrame> &frames);
+    int writeDatagrams(const QKnxByteArrayView *datagrams, int count);
 
     void flowControlHandling(quint16 newBusyWaitTime);
 
@@ -81,6 +85,8 @@ public:
 
     QKnxNetIpRouter::FilterAction filterAction(const QKnxLinkLayerFrame &frame);
 
+    QKnxNetIpDatagramReader m_datagramReader;
+    QVector<quint8> m_sendBuffer;
     QUdpSocket *m_socket { nullptr };
 
     QKnxAddress m_individualAddress;
@@ -114,6 +120,7 @@ public:
     QString m_errorMessage;
 
     QKnxNetIpRouter::KnxAddressWhitelist m_filterTable;
+    QKnxGroupAddressFilterTable m_groupAddressFilter;
     QKnxNetIpRouter::RoutingMode m_routingMode { QKnxNetIpRouter::RoutingMode::Block };
 };
 
@@ -490,7 +490,7 @@ QKnxNetIpFrame QKnxNetIpSearchResponseProxy::ExtendedBuilder::create() const
                 dibsBytes += dib.bytes();
         }
     }
-    return { QKnxNetIp::ServiceType::ExtendedSearchResponse, dibsBytes };
+    return { QKnxNetIp::ServiceType::ExtendedSearchResponse, std::move(dibsBytes) };
 }
 
 /*!
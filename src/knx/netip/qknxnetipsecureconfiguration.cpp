@@ -31,6 +31,8 @@
 #include "qknxnetipsecureconfiguration.h"
 
 #include <QtCore/qfile.h>
+#include <QtCore/qthreadpool.h>
+#include <QtCore/qvector.h>
 
 #include "private/qknxkeyring_p.h"
 #include "private/qknxnetipsecureconfiguration_p.h"
@@ -69,8 +71,36 @@ namespace QKnxPrivate
         return s;
     }
 
+    // Decrypting the passwords, generating the private key and, if requested,
+    // deriving the password hashes is independent for each entry of the keyring,
+    // so with more than one entry the work is spread over a thread pool.
+    template <typename T, typename Create>
+    static QList<QKnxNetIpSecureConfiguration> prepare(const QList<T> &entries, Create create,
+        const QKnxByteArray &pwHash, const QKnxByteArray &createdHash, bool precompute)
+    {
+        QVector<QKnxNetIpSecureConfiguration> results(entries.size());
+        auto data = results.data();
+        auto prepareEntry = [&](int i) {
+            data[i] = create(entries.at(i), pwHash, createdHash);
+            if (precompute)
+                data[i].precomputePasswordHashes();
+        };
+
+        if (entries.size() < 2) {
+            for (int i = 0; i < entries.size(); ++i)
+                prepareEntry(i);
+        } else {
+            QThreadPool pool;
+            for (int i = 0; i < entries.size(); ++i)
+                pool.start([&prepareEntry, i]() { prepareEntry(i); });
+            pool.waitForDone();
+        }
+        return results.toList();
+    }
+
     static QList<QKnxNetIpSecureConfiguration> fromKeyring(QKnxNetIpSecureConfiguration::Type type,
-        const QKnxAddress &ia, const QString &filePath, const QByteArray &password, bool validate)
+        const QKnxAddress &ia, const QString &filePath, const QByteArray &password, bool validate,
+        QKnxNetIpSecureConfiguration::KeyDerivation derivation)
     {
         QFile file;
         file.setFileName(filePath);
@@ -93,21 +123,22 @@ namespace QKnxPrivate
         const auto createdHash = QKnxCryptographicEngine::hashSha256(keyring.Created.toUtf8());
 
         auto iaString = ia.toString();
-        QList<QKnxNetIpSecureConfiguration> results;
+        const bool precompute =
+            (derivation == QKnxNetIpSecureConfiguration::KeyDerivation::Precompute);
 
         if (type == QKnxNetIpSecureConfiguration::Type::Tunneling) {
             if (keyring.Interface.isEmpty())
                 return {};
 
             if (!iaString.isEmpty()) { // only a single interface is requested
-                for (const auto iface : qAsConst(keyring.Interface)) {
+                for (const auto &iface : qAsConst(keyring.Interface)) {
                     if (iaString != iface.IndividualAddress)
                         continue;
-                    return { QKnxPrivate::fromInterface(iface, pwHash, createdHash) };
+                    return prepare<QKnx::Ets::Keyring::QKnxInterface>({ iface }, fromInterface,
+                        pwHash, createdHash, precompute);
                 }
             } else {
-                for (const auto iface : qAsConst(keyring.Interface))
-                    results.append(QKnxPrivate::fromInterface(iface, pwHash, createdHash));
+                return prepare(keyring.Interface, fromInterface, pwHash, createdHash, precompute);
             }
         }
 
@@ -117,21 +148,47 @@ namespace QKnxPrivate
 
             const auto devices = keyring.Devices.value(0).Device;
             if (!iaString.isEmpty()) { // only a single device is requested
-                for (const auto device : devices) {
+                for (const auto &device : devices) {
                     if (iaString != device.IndividualAddress)
                         continue;
-                    return { QKnxPrivate::fromDevice(device, pwHash, createdHash) };
+                    return prepare<QKnx::Ets::Keyring::QKnxDevice>({ device }, fromDevice, pwHash,
+                        createdHash, precompute);
                 }
             } else {
-                for (const auto device : devices)
-                    results.append(QKnxPrivate::fromDevice(device, pwHash, createdHash));
+                return prepare(devices, fromDevice, pwHash, createdHash, precompute);
             }
         }
 
-        return results;
+        return {};
     }
 }
 
+/*!
+    \internal
+
+    Returns the precomputed user password hash, or derives it if it has not
+    been precomputed.
+*/
+QKnxByteArray QKnxNetIpSecureConfigurationPrivate::userPasswordHash() const
+{
+    if (!m_userPasswordHash.isEmpty())
+        return m_userPasswordHash;
+    return QKnxCryptographicEngine::userPasswordHash(userPassword);
+}
+
+/*!
+    \internal
+
+    Returns the precomputed device authentication code hash, or derives it if
+    it has not been precomputed.
+*/
+QKnxByteArray QKnxNetIpSecureConfigurationPrivate::deviceAuthenticationCodeHash() const
+{
+    if (!m_deviceAuthenticationCodeHash.isEmpty())
+        return m_deviceAuthenticationCodeHash;
+    return QKnxCryptographicEngine::deviceAuthenticationCodeHash(deviceAuthenticationCode);
+}
+
 /*!
     \since 5.13
     \inmodule QtKnx
@@ -162,6 +219,20 @@ namespace QKnxPrivate
             KNXnet/IP secure device management configuration.
 */
 
+/*!
+    \since 6.2
+    \enum QKnxNetIpSecureConfiguration::KeyDerivation
+
+    This enum describes when the password hashes of a secure configuration
+    constructed from an ETS exported keyring (*.knxkeys) file are derived.
+
+    \value Lazy
+            The hashes are derived when the configuration is first used to set
+            up a secure session.
+    \value Precompute
+            The hashes are derived while loading the keyring.
+*/
+
 /*!
     Constructs a new, empty, invalid secure configuration.
 
@@ -189,7 +260,29 @@ QKnxNetIpSecureConfiguration::~QKnxNetIpSecureConfiguration() = default;
 QList<QKnxNetIpSecureConfiguration> QKnxNetIpSecureConfiguration::fromKeyring(Type type,
     const QString &keyring, const QByteArray &password, bool validate)
 {
-    return QKnxPrivate::fromKeyring(type, {}, keyring, password, validate);
+    return QKnxPrivate::fromKeyring(type, {}, keyring, password, validate, KeyDerivation::Lazy);
+}
+
+/*!
+    \since 6.2
+    \overload fromKeyring()
+
+    Constructs a list of secure configurations for the given type \a type from
+    an ETS exported \a keyring (*.knxkeys) file that was encrypted with the
+    given password \a password. Set the \a validate argument to \c true to
+    verify that all data in the keyring file is trustworthy, \c false to omit
+    the check.
+
+    The entries of the keyring are prepared in parallel on a thread pool. If
+    \a derivation is set to \l {KeyDerivation::Precompute}, the password hashes
+    of each configuration are derived as well, see precomputePasswordHashes().
+    With \l {KeyDerivation::Lazy}, a hash is derived only once a configuration
+    is used to set up a secure session.
+*/
+QList<QKnxNetIpSecureConfiguration> QKnxNetIpSecureConfiguration::fromKeyring(Type type,
+    const QString &keyring, const QByteArray &password, bool validate, KeyDerivation derivation)
+{
+    return QKnxPrivate::fromKeyring(type, {}, keyring, password, validate, derivation);
 }
 
 /*!
@@ -206,7 +299,8 @@ QList<QKnxNetIpSecureConfiguration> QKnxNetIpSecureConfiguration::fromKeyring(Ty
 QKnxNetIpSecureConfiguration QKnxNetIpSecureConfiguration::fromKeyring(QKnxNetIpSecureConfiguration::Type type,
     const QKnxAddress &ia, const QString &keyring, const QByteArray &password, bool validate)
 {
-    return QKnxPrivate::fromKeyring(type, ia, keyring, password, validate).value(0, {});
+    return QKnxPrivate::fromKeyring(type, ia, keyring, password, validate, KeyDerivation::Lazy)
+        .value(0, {});
 }
 
 /*!
@@ -332,6 +426,7 @@ QByteArray QKnxNetIpSecureConfiguration::userPassword() const
 void QKnxNetIpSecureConfiguration::setUserPassword(const QByteArray &userPassword)
 {
     d->userPassword = userPassword;
+    d->m_userPasswordHash = {};
 }
 
 /*!
@@ -375,8 +470,10 @@ QByteArray QKnxNetIpSecureConfiguration::deviceAuthenticationCode() const
 bool QKnxNetIpSecureConfiguration::setDeviceAuthenticationCode(const QByteArray &authenticationCode)
 {
     auto valid = !authenticationCode.isEmpty();
-    if (valid)
+    if (valid) {
         d->deviceAuthenticationCode = authenticationCode;
+        d->m_deviceAuthenticationCodeHash = {};
+    }
     return valid;
 }
 
@@ -399,6 +496,29 @@ void QKnxNetIpSecureConfiguration::setKeepSecureSessionAlive(bool keepAlive)
     d->keepAlive = keepAlive;
 }
 
+/*!
+    \since 6.2
+
+    Derives the user password hash and the device authentication code hash
+    from the currently set user password and device authentication code and
+    stores them with the secure configuration.
+
+    Deriving the hashes runs the expensive password-based key derivation
+    function (PBKDF2). Calling this function up front, for example while
+    loading the configuration, avoids doing so while a secure session is
+    being set up. Setting a new password or authentication code discards the
+    corresponding hash.
+*/
+void QKnxNetIpSecureConfiguration::precomputePasswordHashes()
+{
+    if (!d->userPassword.isEmpty() && d->m_userPasswordHash.isEmpty())
+        d->m_userPasswordHash = QKnxCryptographicEngine::userPasswordHash(d->userPassword);
+    if (!d->deviceAuthenticationCode.isEmpty() && d->m_deviceAuthenticationCodeHash.isEmpty()) {
+        d->m_deviceAuthenticationCodeHash = QKnxCryptographicEngine
+            ::deviceAuthenticationCodeHash(d->deviceAuthenticationCode);
+    }
+}
+
 /*!
     Constructs a copy of \a other.
 */
@@ -48,11 +48,20 @@ public:
         DeviceManagement = 001
     };
 
+    enum class KeyDerivation : quint8
+    {
+        Lazy = 0x00,
+        Precompute = 0x01
+    };
+
     QKnxNetIpSecureConfiguration();
     ~QKnxNetIpSecureConfiguration();
 
     static QList<QKnxNetIpSecureConfiguration> fromKeyring(QKnxNetIpSecureConfiguration::Type type,
         const QString &keyring, const QByteArray &password, bool validate);
+    static QList<QKnxNetIpSecureConfiguration> fromKeyring(QKnxNetIpSecureConfiguration::Type type,
+        const QString &keyring, const QByteArray &password, bool validate,
+        QKnxNetIpSecureConfiguration::KeyDerivation derivation);
 
     static QKnxNetIpSecureConfiguration fromKeyring(QKnxNetIpSecureConfiguration::Type type,
         const QKnxAddress &ia, const QString &keyring, const QByteArray &password, bool validate);
@@ -83,6 +92,8 @@ public:
     bool isSecureSessionKeepAliveSet() const;
     void setKeepSecureSessionAlive(bool keepAlive);
 
+    void precomputePasswordHashes();
+
     QKnxNetIpSecureConfiguration(const QKnxNetIpSecureConfiguration &other);
     QKnxNetIpSecureConfiguration &operator=(const QKnxNetIpSecureConfiguration &other);
 
@@ -97,6 +108,7 @@ public:
 private:
     friend class QKnxNetIpEndpointConnection;
     friend class QKnxNetIpEndpointConnectionPrivate;
+    friend class QKnxNetIpSecureConfigurationPrivate;
     QSharedDataPointer<QKnxNetIpSecureConfigurationPrivate> d;
 };
 Q_DECLARE_SHARED(QKnxNetIpSecureConfiguration)
@@ -42,7 +42,9 @@
 //
 
 #include <QtKnx/qknxaddress.h>
+#include <QtKnx/qknxbytearray.h>
 #include <QtKnx/qknxnetip.h>
+#include <QtKnx/qknxnetipsecureconfiguration.h>
 #include <QtKnx/qknxsecurekey.h>
 
 QT_BEGIN_NAMESPACE
@@ -53,6 +55,11 @@ public:
     QKnxNetIpSecureConfigurationPrivate() = default;
     ~QKnxNetIpSecureConfigurationPrivate() = default;
 
+    static const QKnxNetIpSecureConfigurationPrivate *get(const QKnxNetIpSecureConfiguration &c)
+    {
+        return c.d.constData();
+    }
+
     QKnxSecureKey privateKey;
     QKnxSecureKey publicKey;
     QKnxAddress host;
@@ -61,6 +68,13 @@ public:
     QKnxAddress ia;
     QByteArray deviceAuthenticationCode;
     bool keepAlive { false };
+
+    QKnxByteArray userPasswordHash() const;
+    QKnxByteArray deviceAuthenticationCodeHash() const;
+
+    // derived from the passwords above, see precomputePasswordHashes()
+    QKnxByteArray m_userPasswordHash;
+    QKnxByteArray m_deviceAuthenticationCodeHash;
 };
 
 QT_END_NAMESPACE
@@ -259,7 +259,7 @@ QKnxNetIpDib QKnxNetIpSecuredServiceFamiliesDibProxy::Builder::create() const
     QKnxByteArray bytes;
     for (const auto &info : qAsConst(d_ptr->m_infos))
         bytes += { quint8(info.ServiceFamily), info.RequiredSecurityVersion };
-    return { QKnxNetIp::DescriptionType::SecuredServices, bytes };
+    return { QKnxNetIp::DescriptionType::SecuredServices, std::move(bytes) };
 }
 
 /*!
@@ -0,0 +1,215 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtKnx module.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include "qknxnetipsecurewrappercodec_p.h"
+
+#include <QtKnx/private/qknxcryptographicengine_p.h>
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \internal
+    \class QKnxNetIpSecureWrapperCodec
+
+    \brief The QKnxNetIpSecureWrapperCodec class encodes and decodes KNXnet/IP
+    secure wrapper frames directly in a datagram buffer.
+
+    Building a secure wrapper with QKnxNetIpSecureWrapperProxy::secureBuilder()
+    serializes the encapsulated frame, encrypts it into a new array, computes
+    the MAC over a concatenation of temporaries and serializes everything once
+    more. The codec instead serializes the encapsulated frame once into the
+    output buffer and encrypts and authenticates it there. Receiving works the
+    same way in reverse, the payload is decrypted and verified in place.
+
+    Both directions use a QKnxSslCipherContext that is expected to be keyed
+    with the session key for the lifetime of the secure session.
+*/
+
+namespace QKnxPrivate
+{
+    static void writeSecurityInfo(quint8 *out, const QKnxNetIpSecureWrapperCodec::SecurityInfo &info)
+    {
+        out[0] = quint8(info.sessionId >> 8);
+        out[1] = quint8(info.sessionId);
+        for (int i = 0; i < 6; ++i)
+            out[2 + i] = quint8(info.sequenceNumber >> (8 * (5 - i)));
+        for (int i = 0; i < 6; ++i)
+            out[8 + i] = info.serialNumber.value(i, 0x00);
+        out[14] = quint8(info.messageTag >> 8);
+        out[15] = quint8(info.messageTag);
+    }
+
+    static void readSecurityInfo(const quint8 *in, QKnxNetIpSecureWrapperCodec::SecurityInfo *info)
+    {
+        info->sessionId = quint16(in[0] << 8 | in[1]);
+        info->sequenceNumber = 0;
+        for (int i = 0; i < 6; ++i)
+            info->sequenceNumber = (info->sequenceNumber << 8) | in[2 + i];
+        info->serialNumber = QKnxByteArrayView(in + 8, 6);
+        info->messageTag = quint16(in[14] << 8 | in[15]);
+    }
+}
+
+/*!
+    Encodes \a frame into a secure wrapper frame with the security information
+    \a info, encrypted and authenticated with \a context. The secure wrapper
+    frame is written to \a out, which must provide at least encodedSize()
+    bytes of \a capacity.
+
+    Returns the number of bytes written, or \c 0 on error.
+*/
+int QKnxNetIpSecureWrapperCodec::encode(QKnxSslCipherContext &context,
+    const QKnxNetIpFrame &frame, const SecurityInfo &info, quint8 *out, int capacity)
+{
+    const int size = encodedSize(frame);
+    if (!context.isValid() || !frame.isValid() || size > capacity || size > 0xffff
+        || info.sequenceNumber > Q_UINT48_MAX) {
+        return 0;
+    }
+
+    const QKnxNetIpFrameHeader header(QKnxNetIp::ServiceType::SecureWrapper,
+        quint16(size - QKnxNetIpFrameHeader::HeaderSize10));
+    if (header.serialize(out, capacity) != QKnxNetIpFrameHeader::HeaderSize10)
+        return 0;
+
+    quint8 *securityInfo = out + QKnxNetIpFrameHeader::HeaderSize10;
+    QKnxPrivate::writeSecurityInfo(securityInfo, info);
+
+    quint8 *payload = securityInfo + SecurityInfoSize;
+    const int payloadSize = frame.serialize(payload, capacity - (payload - out));
+    if (payloadSize != frame.size())
+        return 0;
+
+    // the MAC is computed over the plain payload, then both get encrypted
+    quint8 *mac = payload + payloadSize;
+    if (!QKnxCryptographicEnginePrivate::computeMac(context, header, info.sessionId,
+            { payload, payloadSize }, info.sequenceNumber, info.serialNumber, info.messageTag, mac)
+        || !QKnxCryptographicEnginePrivate::processPayload(context, payload, payload, payloadSize,
+            info.sequenceNumber, info.serialNumber, info.messageTag)
+        || !QKnxCryptographicEnginePrivate::processMac(context, mac, mac, MacSize,
+            info.sequenceNumber, info.serialNumber, info.messageTag)) {
+        return 0;
+    }
+    return size;
+}
+
+/*!
+    Decrypts and verifies the secure wrapper frame of \a size bytes stored in
+    \a bytes using \a context. The encapsulated frame is decrypted in place.
+    If \a info is not \c nullptr, the security information of the frame is
+    stored in it; its serial number refers to \a bytes.
+
+    Returns a view on the decrypted encapsulated frame inside \a bytes, or an
+    empty view if the frame is not a secure wrapper frame or the message
+    authentication code could not be verified. In the latter case the content
+    of \a bytes is undefined.
+*/
+QKnxByteArrayView QKnxNetIpSecureWrapperCodec::decode(QKnxSslCipherContext &context,
+    quint8 *bytes, int size, SecurityInfo *info)
+{
+    if (size < Overhead)
+        return {};
+    return decode(context, { bytes, size }, bytes + QKnxNetIpFrameHeader::HeaderSize10
+        + SecurityInfoSize, size - Overhead, info);
+}
+
+/*!
+    Decrypts and verifies the secure wrapper frame \a bytes using \a context,
+    without modifying it. The encapsulated frame is decrypted into \a out,
+    which must provide at least the encapsulated frame's size as \a capacity,
+    that is the size of \a bytes minus Overhead. If \a info is not
+    \c nullptr, the security information of the frame is stored in it; its
+    serial number refers to \a bytes.
+
+    This avoids copying a received datagram before decrypting it. Returns a
+    view on the decrypted encapsulated frame inside \a out, or an empty view
+    if the frame is not a secure wrapper frame or the message authentication
+    code could not be verified. In the latter case the content of \a out is
+    undefined.
+*/
+QKnxByteArrayView QKnxNetIpSecureWrapperCodec::decode(QKnxSslCipherContext &context,
+    QKnxByteArrayView bytes, quint8 *out, int capacity, SecurityInfo *info)
+{
+    const int size = bytes.size();
+    if (!context.isValid() || size < Overhead + QKnxNetIpFrameHeader::HeaderSize10)
+        return {};
+
+    const auto header = QKnxNetIpFrameHeader::fromBytes(bytes);
+    if (!header.isValid() || header.serviceType() != QKnxNetIp::ServiceType::SecureWrapper
+        || header.totalSize() != size) {
+        return {};
+    }
+
+    const int payloadSize = size - Overhead;
+    if (!out || capacity < payloadSize)
+        return {};
+
+    SecurityInfo securityInfo;
+    const quint8 *securityInfoBytes = bytes.data() + QKnxNetIpFrameHeader::HeaderSize10;
+    QKnxPrivate::readSecurityInfo(securityInfoBytes, &securityInfo);
+
+    const quint8 *payload = securityInfoBytes + SecurityInfoSize;
+    const quint8 *encryptedMac = payload + payloadSize;
+
+    quint8 mac[MacSize];
+    quint8 decryptedMac[MacSize];
+    if (!QKnxCryptographicEnginePrivate::processPayload(context, payload, out, payloadSize,
+            securityInfo.sequenceNumber, securityInfo.serialNumber, securityInfo.messageTag)
+        || !QKnxCryptographicEnginePrivate::computeMac(context, header, securityInfo.sessionId,
+            { out, payloadSize }, securityInfo.sequenceNumber, securityInfo.serialNumber,
+            securityInfo.messageTag, mac)
+        || !QKnxCryptographicEnginePrivate::processMac(context, encryptedMac, decryptedMac,
+            MacSize, securityInfo.sequenceNumber, securityInfo.serialNumber,
+            securityInfo.messageTag)) {
+        return {};
+    }
+
+    quint8 difference = 0;
+    for (int i = 0; i < MacSize; ++i)
+        difference |= quint8(mac[i] ^ decryptedMac[i]);
+    if (difference != 0)
+        return {};
+
+    if (info)
+        *info = securityInfo;
+    return { out, payloadSize };
+}
+
+QT_END_NAMESPACE
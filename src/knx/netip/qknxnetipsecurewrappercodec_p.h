@@ -0,0 +1,96 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtKnx module.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#ifndef QKNXNETIPSECUREWRAPPERCODEC_P_H
+#define QKNXNETIPSECUREWRAPPERCODEC_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt KNX API.  It exists for the convenience
+// of the Qt KNX implementation.  This header file may change from version
+// to version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtKnx/qknxbytearrayview.h>
+#include <QtKnx/qknxnetipframe.h>
+#include <QtKnx/qknxnetipframeheader.h>
+#include <QtKnx/qtknxglobal.h>
+#include <QtKnx/private/qknxssl_p.h>
+
+QT_BEGIN_NAMESPACE
+
+class Q_AUTOTEST_EXPORT QKnxNetIpSecureWrapperCodec final
+{
+public:
+    enum : int
+    {
+        SecurityInfoSize = 16,
+        MacSize = 16,
+        Overhead = QKnxNetIpFrameHeader::HeaderSize10 + SecurityInfoSize + MacSize
+    };
+
+    struct SecurityInfo
+    {
+        quint16 sessionId { 0 };
+        quint48 sequenceNumber { 0 };
+        QKnxByteArrayView serialNumber;
+        quint16 messageTag { 0 };
+    };
+
+    static int encodedSize(const QKnxNetIpFrame &frame)
+    {
+        return frame.size() + Overhead;
+    }
+
+    static int encode(QKnxSslCipherContext &context, const QKnxNetIpFrame &frame,
+        const SecurityInfo &info, quint8 *out, int capacity);
+    static QKnxByteArrayView decode(QKnxSslCipherContext &context, quint8 *bytes, int size,
+        SecurityInfo *info = nullptr);
+    static QKnxByteArrayView decode(QKnxSslCipherContext &context, QKnxByteArrayView bytes,
+        quint8 *out, int capacity, SecurityInfo *info = nullptr);
+};
+
+QT_END_NAMESPACE
+
+#endif
@@ -262,7 +262,7 @@ QKnxNetIpDib QKnxNetIpServiceFamiliesDibProxy::Builder::create() const
     QKnxByteArray bytes;
     for (const auto &info : qAsConst(m_infos))
         bytes += { quint8(info.ServiceFamily), info.ServiceFamilyVersion };
-    return { QKnxNetIp::DescriptionType::SupportedServiceFamilies, bytes };
+    return { QKnxNetIp::DescriptionType::SupportedServiceFamilies, std::move(bytes) };
 }
 
 QT_END_NAMESPACE
@@ -312,6 +312,24 @@ QKnxNetIpSessionAuthenticateProxy::SecureBuilder &
     return *this;
 }
 
+/*!
+    \since 6.2
+
+    Sets the already derived user password hash to \a userPasswordHash and
+    returns a reference to the builder. The hash is used by the create()
+    overload that does not take the session password, which avoids deriving
+    the hash again for every session.
+
+    \sa QKnxCryptographicEngine::userPasswordHash()
+*/
+QKnxNetIpSessionAuthenticateProxy::SecureBuilder &
+    QKnxNetIpSessionAuthenticateProxy::SecureBuilder::setUserPasswordHash(
+                                                        const QKnxByteArray &userPasswordHash)
+{
+    d_ptr->m_userPasswordHash = userPasswordHash;
+    return *this;
+}
+
 /*!
     Creates and returns a KNXnet/IP session authentication frame.
 
@@ -334,20 +352,53 @@ QKnxNetIpFrame QKnxNetIpSessionAuthenticateProxy::SecureBuilder::create(
     if (!QKnxNetIp::isSecureUserId(d_ptr->m_id))
         return { QKnxNetIp::ServiceType::SessionAuthenticate };
 
+    return SecureBuilder(*this)
+        .setUserPasswordHash(QKnxCryptographicEngine::userPasswordHash(sessionPassword))
+        .create(clientPublicKey, serverPublicKey);
+#else
+    Q_UNUSED(sessionPassword)
+    Q_UNUSED(clientPublicKey)
+    Q_UNUSED(serverPublicKey)
+    return { QKnxNetIp::ServiceType::SessionAuthenticate };
+#endif
+}
+
+/*!
+    \since 6.2
+
+    Creates and returns a KNXnet/IP session authentication frame.
+
+    The function computes the AES128 CCM message authentication code (MAC)
+    with the user password hash set with setUserPasswordHash(), the Curve25519
+    client public key \a clientPublicKey, the Curve25519 server public key
+    \a serverPublicKey and appends it to the newly created frame.
+
+    \note The returned frame may be invalid depending on the values used during
+    setup.
+
+    \sa isValid()
+*/
+QKnxNetIpFrame QKnxNetIpSessionAuthenticateProxy::SecureBuilder::create(
+                                                        const QKnxByteArray &clientPublicKey,
+                                                        const QKnxByteArray &serverPublicKey) const
+{
+#if QT_CONFIG(opensslv11)
+    if (!QKnxNetIp::isSecureUserId(d_ptr->m_id) || d_ptr->m_userPasswordHash.isEmpty())
+        return { QKnxNetIp::ServiceType::SessionAuthenticate };
+
     auto builder = QKnxNetIpSessionAuthenticateProxy::builder();
     auto frame = builder
         .setUserId(d_ptr->m_id)
         .setMessageAuthenticationCode(QKnxByteArray(16, 0x00)) // dummy MAC to get a proper header
         .create();
 
-    auto userPasswordHash = QKnxCryptographicEngine::userPasswordHash(sessionPassword);
+    const auto &userPasswordHash = d_ptr->m_userPasswordHash;
     auto mac = QKnxCryptographicEngine::computeMessageAuthenticationCode(userPasswordHash, frame.
         header(), d_ptr->m_id, QKnxCryptographicEngine::XOR(clientPublicKey, serverPublicKey));
     mac = QKnxCryptographicEngine::encryptMessageAuthenticationCode(userPasswordHash, mac);
 
     return builder.setMessageAuthenticationCode(mac).create();
 #else
-    Q_UNUSED(sessionPassword)
     Q_UNUSED(clientPublicKey)
     Q_UNUSED(serverPublicKey)
     return { QKnxNetIp::ServiceType::SessionAuthenticate };
@@ -76,10 +76,13 @@ public:
         ~SecureBuilder();
 
         SecureBuilder &setUserId(QKnxNetIp::SecureUserId userId);
+        SecureBuilder &setUserPasswordHash(const QKnxByteArray &userPasswordHash);
 
         QKnxNetIpFrame create(const QByteArray &sessionPassword,
                               const QKnxByteArray &clientPublicKey,
                               const QKnxByteArray &serverPublicKey) const;
+        QKnxNetIpFrame create(const QKnxByteArray &clientPublicKey,
+                              const QKnxByteArray &serverPublicKey) const;
 
         SecureBuilder(const SecureBuilder &other);
         SecureBuilder &operator=(const SecureBuilder &other);
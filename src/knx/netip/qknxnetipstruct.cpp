@@ -162,6 +162,14 @@ QT_BEGIN_NAMESPACE
     \a dataField.
 */
 
+/*!
+    \fn template <typename CodeType> QKnxNetIpStruct<CodeType>::QKnxNetIpStruct(CodeType codeType, QKnxByteArray &&dataField)
+    \overload
+
+    Creates a new KNXnet/IP structure with the specified \a codeType and moves
+    the payload \a dataField into the structure without copying it.
+*/
+
 /*!
     \fn template <typename CodeType> QKnxNetIpStruct<CodeType>::QKnxNetIpStruct(const QKnxNetIpStructHeader<CodeType> &headerField, const QKnxByteArray &dataField = {})
 
@@ -187,6 +195,26 @@ QT_BEGIN_NAMESPACE
     the header and the payload.
 */
 
+/*!
+    \fn template <typename CodeType> int QKnxNetIpStruct<CodeType>::serialize(quint8 *out, int capacity) const
+
+    Writes the KNXnet/IP structure including the header and the payload to the
+    memory pointed to by \a out, which can hold up to \a capacity bytes.
+    Returns the number of bytes written. If the header is not valid or
+    \a capacity is too small, nothing is written and \c 0 is returned.
+
+    \sa bytes(), writeTo()
+*/
+
+/*!
+    \fn template <typename CodeType> void QKnxNetIpStruct<CodeType>::writeTo(QKnxByteArray &out) const
+
+    Appends the KNXnet/IP structure including the header and the payload to
+    \a out if the header is valid.
+
+    \sa bytes(), serialize()
+*/
+
 /*!
     \fn template <typename CodeType> QKnxNetIpStruct<CodeType>::constData() const
 
@@ -214,6 +242,14 @@ QT_BEGIN_NAMESPACE
     \sa isNull(), isValid()
 */
 
+/*!
+    \fn template <typename CodeType> QKnxNetIpStruct<CodeType>::fromBytes(QKnxByteArrayView bytes, quint16 index)
+    \overload
+
+    The bytes are read directly from the memory referenced by the view, without
+    creating intermediate copies.
+*/
+
 /*!
     \fn template <typename CodeType> QKnxNetIpStruct<CodeType>::header() const
 
@@ -244,6 +280,14 @@ QT_BEGIN_NAMESPACE
     data size accordingly.
 */
 
+/*!
+    \fn template <typename CodeType> QKnxNetIpStruct<CodeType>::setData(QKnxByteArray &&dataField)
+    \overload
+
+    Moves \a dataField into the KNXnet/IP structure without copying it and
+    updates the data size accordingly.
+*/
+
 /*!
     \fn template <typename CodeType> QKnxNetIpStruct<CodeType>::setHeader(const QKnxNetIpStructHeader<CodeType> &headerField)
 
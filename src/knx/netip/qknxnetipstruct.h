@@ -31,6 +31,7 @@
 #define QKNXNETIPSTRUCT_H
 
 #include <QtKnx/qknxbytearray.h>
+#include <QtKnx/qknxbytearrayview.h>
 #include <QtKnx/qknxnetip.h>
 #include <QtKnx/qknxtraits.h>
 #include <QtKnx/qknxnetipstructheader.h>
@@ -52,6 +53,12 @@ public:
          setData(dataField);
     }
 
+    QKnxNetIpStruct(CodeType codeType, QKnxByteArray &&dataField)
+        : m_header(codeType)
+    {
+         setData(std::move(dataField));
+    }
+
     QKnxNetIpStruct(const QKnxNetIpStructHeader<CodeType> &headerField,
             const QKnxByteArray &dataField = {})
         : m_header(headerField)
@@ -109,17 +116,45 @@ public:
         m_header.setDataSize(dataField.size());
     }
 
+    void setData(QKnxByteArray &&dataField)
+    {
+        m_header.setDataSize(dataField.size());
+        m_data = std::move(dataField);
+    }
+
     QKnxByteArray bytes() const
     {
         return m_header.bytes() + m_data;
     }
 
+    int serialize(quint8 *out, int capacity) const
+    {
+        if (!m_header.isValid() || capacity < m_header.size() + m_data.size())
+            return 0;
+        const int headerSize = m_header.serialize(out, capacity);
+        memcpy(out + headerSize, m_data.constData(), m_data.size());
+        return headerSize + m_data.size();
+    }
+
+    void writeTo(QKnxByteArray &out) const
+    {
+        if (!m_header.isValid())
+            return;
+        m_header.writeTo(out);
+        out.append(m_data);
+    }
+
     static QKnxNetIpStruct fromBytes(const QKnxByteArray &bytes, quint16 index = 0)
+    {
+        return fromBytes(QKnxByteArrayView(bytes), index);
+    }
+
+    static QKnxNetIpStruct fromBytes(QKnxByteArrayView bytes, quint16 index = 0)
     {
         auto header = QKnxNetIpStructHeader<CodeType>::fromBytes(bytes, index);
         if (!header.isValid())
             return {};
-        return { header, bytes.mid(index + header.size(), header.dataSize()) };
+        return { header, bytes.mid(index + header.size(), header.dataSize()).toByteArray() };
     }
 
     bool operator==(const QKnxNetIpStruct &other) const
@@ -173,6 +173,25 @@ QT_BEGIN_NAMESPACE
     Returns an array of bytes that represent the KNXnet/IP structure header.
 */
 
+/*!
+    \fn template <typename CodeType> int QKnxNetIpStructHeader<CodeType>::serialize(quint8 *out, int capacity) const
+
+    Writes the KNXnet/IP structure header to the memory pointed to by \a out,
+    which can hold up to \a capacity bytes. Returns the number of bytes
+    written. If the header is null or \a capacity is too small, nothing is
+    written and \c 0 is returned.
+
+    \sa bytes(), writeTo()
+*/
+
+/*!
+    \fn template <typename CodeType> void QKnxNetIpStructHeader<CodeType>::writeTo(QKnxByteArray &out) const
+
+    Appends the KNXnet/IP structure header to \a out.
+
+    \sa bytes(), serialize()
+*/
+
 /*!
     \fn template <typename CodeType> static QKnxNetIpStructHeader<CodeType>::fromBytes(const QKnxByteArray &bytes, quint16 index = 0)
 
@@ -182,6 +201,14 @@ QT_BEGIN_NAMESPACE
     \sa isNull(), isValid()
 */
 
+/*!
+    \fn template <typename CodeType> static QKnxNetIpStructHeader<CodeType>::fromBytes(QKnxByteArrayView bytes, quint16 index = 0)
+    \overload
+
+    The bytes are read directly from the memory referenced by the view, without
+    creating intermediate copies.
+*/
+
 /*!
     \fn template <typename CodeType> bool QKnxNetIpStructHeader<CodeType>::operator==(const QKnxNetIpStructHeader &other) const
 
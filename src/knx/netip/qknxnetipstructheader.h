@@ -31,6 +31,7 @@
 #define QKNXNETIPSTRUCTHEADER_H
 
 #include <QtKnx/qknxbytearray.h>
+#include <QtKnx/qknxbytearrayview.h>
 #include <QtKnx/qknxnetip.h>
 #include <QtKnx/qknxtraits.h>
 #include <QtKnx/qknxutils.h>
@@ -144,7 +145,31 @@ public:
         return {};
     }
 
+    int serialize(quint8 *out, int capacity) const
+    {
+        const int headerSize = size();
+        if ((headerSize != 2 && headerSize != 4) || capacity < headerSize)
+            return 0;
+        memcpy(out, m_bytes + 1, headerSize);
+        return headerSize;
+    }
+
+    void writeTo(QKnxByteArray &out) const
+    {
+        const int headerSize = size();
+        if (headerSize != 2 && headerSize != 4)
+            return;
+        const int offset = out.size();
+        out.resize(offset + headerSize);
+        serialize(out.data() + offset, headerSize);
+    }
+
     static QKnxNetIpStructHeader fromBytes(const QKnxByteArray &bytes, quint16 index = 0)
+    {
+        return fromBytes(QKnxByteArrayView(bytes), index);
+    }
+
+    static QKnxNetIpStructHeader fromBytes(QKnxByteArrayView bytes, quint16 index = 0)
     {
         const qint32 availableSize = bytes.size() - index;
         if (availableSize < 1)
@@ -78,6 +78,51 @@ QT_BEGIN_NAMESPACE
     link layer frame \a frame as payload) from the KNXnet/IP server.
 */
 
+/*!
+    \enum QKnxNetIpTunnel::QueueOverflowPolicy
+    \since 6.2
+
+    This enum describes what happens when a frame is sent while the send queue
+    is full.
+
+    \value RejectNew
+            The frame is not queued and sendFrame() returns \c false.
+    \value DropOldest
+            The oldest frame is removed from the queue, frameFailed() is
+            emitted for it, and the new frame is queued.
+*/
+
+/*!
+    \since 6.2
+    \fn void QKnxNetIpTunnel::frameQueued(QKnxLinkLayerFrame frame)
+
+    This signal is emitted when \a frame is appended to the send queue because
+    a previous frame is still waiting for its acknowledgment.
+*/
+
+/*!
+    \since 6.2
+    \fn void QKnxNetIpTunnel::frameSent(QKnxLinkLayerFrame frame)
+
+    This signal is emitted when \a frame is sent to the KNXnet/IP server.
+*/
+
+/*!
+    \since 6.2
+    \fn void QKnxNetIpTunnel::frameAcknowledged(QKnxLinkLayerFrame frame)
+
+    This signal is emitted when the KNXnet/IP server acknowledges the receipt
+    of \a frame. Only UDP connections acknowledge frames.
+*/
+
+/*!
+    \since 6.2
+    \fn void QKnxNetIpTunnel::frameFailed(QKnxLinkLayerFrame frame)
+
+    This signal is emitted when \a frame is dropped from the send queue, or
+    could not be delivered because the connection was closed.
+*/
+
 /*!
     \since 5.12
     \fn void QKnxNetIpTunnel::tunnelingFeatureInfoReceived(QKnx::InterfaceFeature feature, QKnxByteArray value)
@@ -115,6 +160,11 @@ public:
     void processConnectResponse(const QKnxNetIpFrame &frame) override;
     void processTunnelingFeatureFrame(const QKnxNetIpFrame &frame) override;
 
+    void tunnelingRequestQueued(const QKnxLinkLayerFrame &frame) override;
+    void tunnelingRequestSent(const QKnxLinkLayerFrame &frame) override;
+    void tunnelingRequestAcknowledged(const QKnxLinkLayerFrame &frame) override;
+    void tunnelingRequestFailed(const QKnxLinkLayerFrame &frame) override;
+
 private:
     QKnxAddress m_address;
     QKnxNetIp::TunnelLayer m_layer { QKnxNetIp::TunnelLayer::Unknown };
@@ -161,6 +211,30 @@ void QKnxNetIpTunnelPrivate::processTunnelingFeatureFrame(const QKnxNetIpFrame &
     }
 }
 
+void QKnxNetIpTunnelPrivate::tunnelingRequestQueued(const QKnxLinkLayerFrame &frame)
+{
+    Q_Q(QKnxNetIpTunnel);
+    emit q->frameQueued(frame);
+}
+
+void QKnxNetIpTunnelPrivate::tunnelingRequestSent(const QKnxLinkLayerFrame &frame)
+{
+    Q_Q(QKnxNetIpTunnel);
+    emit q->frameSent(frame);
+}
+
+void QKnxNetIpTunnelPrivate::tunnelingRequestAcknowledged(const QKnxLinkLayerFrame &frame)
+{
+    Q_Q(QKnxNetIpTunnel);
+    emit q->frameAcknowledged(frame);
+}
+
+void QKnxNetIpTunnelPrivate::tunnelingRequestFailed(const QKnxLinkLayerFrame &frame)
+{
+    Q_Q(QKnxNetIpTunnel);
+    emit q->frameFailed(frame);
+}
+
 /*!
     Creates a tunnel connection with the parent \a parent.
 */
@@ -198,6 +272,17 @@ QKnxNetIpTunnel::QKnxNetIpTunnel(const QHostAddress &localAddress,
         layer), parent)
 {}
 
+/*!
+    Destroys the tunnel connection. Frames still waiting in the send queue are
+    discarded without emitting frameFailed().
+*/
+QKnxNetIpTunnel::~QKnxNetIpTunnel()
+{
+    // The base class destructor disconnects from the host, at which point the
+    // signals of this class can no longer be emitted safely.
+    d_func()->clearTunnelingRequests(false);
+}
+
 /*!
     Returns the individual address of the KNXnet/IP client assigned by the
     KNXnet/IP server.
@@ -253,7 +338,14 @@ void QKnxNetIpTunnel::setTunnelLayer(QKnxNetIp::TunnelLayer layer)
     If no connection is currently established, returns \c false and does not
     send the frame.
 
-    \sa QKnxNetIpEndpointConnection::State
+    Only one tunneling request can be waiting for an acknowledgment at a time.
+    If a previous request has not been acknowledged yet, the frame is appended
+    to the send queue and sent automatically once it is the frame's turn. If
+    the send queue is disabled or full, and the overflow policy is
+    \l {QueueOverflowPolicy}{RejectNew}, returns \c false and does not send
+    the frame.
+
+    \sa QKnxNetIpEndpointConnection::State, setSendQueueDepth()
 */
 bool QKnxNetIpTunnel::sendFrame(const QKnxLinkLayerFrame &frame)
 {
@@ -267,6 +359,115 @@ bool QKnxNetIpTunnel::sendFrame(const QKnxLinkLayerFrame &frame)
     return d->sendTunnelingRequest(frame);
 }
 
+/*!
+    \since 6.2
+
+    Returns the maximum number of frames held in the send queue. The default
+    value is \c 0, meaning that frames sent while a previous frame is waiting
+    for its acknowledgment are rejected.
+
+    \sa sendFrame()
+*/
+int QKnxNetIpTunnel::sendQueueDepth() const
+{
+    return d_func()->m_sendQueueDepth;
+}
+
+/*!
+    \since 6.2
+
+    Sets the maximum number of frames held in the send queue to \a depth.
+    Frames exceeding the new depth are removed from the front of the queue and
+    reported via frameFailed().
+*/
+void QKnxNetIpTunnel::setSendQueueDepth(int depth)
+{
+    Q_D(QKnxNetIpTunnel);
+    d->m_sendQueueDepth = qMax(0, depth);
+    while (d->m_sendQueue.size() > d->m_sendQueueDepth)
+        d->tunnelingRequestFailed(d->m_sendQueue.dequeue());
+}
+
+/*!
+    \since 6.2
+
+    Returns the policy applied when a frame is sent while the send queue is
+    full. The default policy is \l {QueueOverflowPolicy}{RejectNew}.
+*/
+QKnxNetIpTunnel::QueueOverflowPolicy QKnxNetIpTunnel::sendQueueOverflowPolicy() const
+{
+    return d_func()->m_sendQueueDropOldest ? QueueOverflowPolicy::DropOldest
+        : QueueOverflowPolicy::RejectNew;
+}
+
+/*!
+    \since 6.2
+
+    Sets the policy applied when a frame is sent while the send queue is full
+    to \a policy.
+*/
+void QKnxNetIpTunnel::setSendQueueOverflowPolicy(QueueOverflowPolicy policy)
+{
+    d_func()->m_sendQueueDropOldest = (policy == QueueOverflowPolicy::DropOldest);
+}
+
+/*!
+    \since 6.2
+
+    Returns the number of frames currently waiting in the send queue, not
+    including the frame waiting for its acknowledgment.
+*/
+int QKnxNetIpTunnel::sendQueueSize() const
+{
+    return d_func()->m_sendQueue.size();
+}
+
+/*!
+    \since 6.2
+
+    Removes all frames from the send queue. The frameFailed() signal is emitted
+    for each removed frame. A frame already waiting for its acknowledgment is
+    not affected.
+*/
+void QKnxNetIpTunnel::clearSendQueue()
+{
+    Q_D(QKnxNetIpTunnel);
+    const auto queue = std::move(d->m_sendQueue);
+    d->m_sendQueue.clear();
+    for (const auto &frame : queue)
+        d->tunnelingRequestFailed(frame);
+}
+
+/*!
+    \since 6.2
+
+    Returns the number of acknowledged frames per second, measured from the
+    first frame sent on the current connection up to the latest
+    acknowledgment. Returns \c 0 if no frame has been acknowledged yet.
+*/
+qreal QKnxNetIpTunnel::sendRate() const
+{
+    Q_D(const QKnxNetIpTunnel);
+    if (d->m_acknowledgedRequests == 0 || d->m_lastAcknowledgeAt <= 0)
+        return 0;
+    return d->m_acknowledgedRequests * 1e9 / d->m_lastAcknowledgeAt;
+}
+
+/*!
+    \since 6.2
+
+    Returns the average time in milliseconds between sending a frame and
+    receiving its acknowledgment on the current connection, including possible
+    retransmissions. Returns \c 0 if no frame has been acknowledged yet.
+*/
+qreal QKnxNetIpTunnel::averageAcknowledgeTime() const
+{
+    Q_D(const QKnxNetIpTunnel);
+    if (d->m_acknowledgedRequests == 0)
+        return 0;
+    return d->m_acknowledgeTimeTotal / 1e6 / d->m_acknowledgedRequests;
+}
+
 /*!
     \since 5.12
 
@@ -45,8 +45,15 @@ class Q_KNX_EXPORT QKnxNetIpTunnel final : public QKnxNetIpEndpointConnection
     Q_DECLARE_PRIVATE(QKnxNetIpTunnel)
 
 public:
+    enum class QueueOverflowPolicy : quint8
+    {
+        RejectNew,
+        DropOldest
+    };
+    Q_ENUM(QueueOverflowPolicy)
+
     QKnxNetIpTunnel(QObject *parent = nullptr);
-    ~QKnxNetIpTunnel() override = default;
+    ~QKnxNetIpTunnel() override;
 
     QKnxNetIpTunnel(const QHostAddress &localAddress, QObject *parent = nullptr);
     QKnxNetIpTunnel(const QHostAddress &localAddress, quint16 localPort, QObject *parent = nullptr);
@@ -63,12 +70,29 @@ public:
 
     bool sendFrame(const QKnxLinkLayerFrame &frame);
 
+    int sendQueueDepth() const;
+    void setSendQueueDepth(int depth);
+
+    QueueOverflowPolicy sendQueueOverflowPolicy() const;
+    void setSendQueueOverflowPolicy(QueueOverflowPolicy policy);
+
+    int sendQueueSize() const;
+    void clearSendQueue();
+
+    qreal sendRate() const;
+    qreal averageAcknowledgeTime() const;
+
     bool sendTunnelingFeatureGet(QKnx::InterfaceFeature feature);
     bool sendTunnelingFeatureSet(QKnx::InterfaceFeature feature, const QKnxByteArray &value);
 
 Q_SIGNALS:
     void frameReceived(QKnxLinkLayerFrame frame);
 
+    void frameQueued(QKnxLinkLayerFrame frame);
+    void frameSent(QKnxLinkLayerFrame frame);
+    void frameAcknowledged(QKnxLinkLayerFrame frame);
+    void frameFailed(QKnxLinkLayerFrame frame);
+
     void tunnelingFeatureInfoReceived(QKnx::InterfaceFeature feature, QKnxByteArray value);
     void tunnelingFeatureResponseReceived(QKnx::InterfaceFeature feature, QKnx::ReturnCode code,
                                           QKnxByteArray value);
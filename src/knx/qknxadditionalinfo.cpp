@@ -290,6 +290,33 @@ QKnxByteArray QKnxAdditionalInfo::bytes() const
     return m_bytes;
 }
 
+/*!
+    Writes the bytes that represent the additional info object to the memory
+    pointed to by \a out, which can hold up to \a capacity bytes. Returns the
+    number of bytes written. If the object is not valid or \a capacity is too
+    small, nothing is written and \c 0 is returned.
+
+    \sa bytes(), writeTo()
+*/
+int QKnxAdditionalInfo::serialize(quint8 *out, int capacity) const
+{
+    if (!isValid() || capacity < m_bytes.size())
+        return 0;
+    memcpy(out, m_bytes.constData(), m_bytes.size());
+    return m_bytes.size();
+}
+
+/*!
+    Appends the bytes that represent the additional info object to \a out.
+
+    \sa bytes(), serialize()
+*/
+void QKnxAdditionalInfo::writeTo(QKnxByteArray &out) const
+{
+    if (isValid())
+        out.append(m_bytes);
+}
+
 /*!
     Constructs the additional info object from the byte array \a bytes starting
     at position \a index inside the array.
@@ -297,6 +324,17 @@ QKnxByteArray QKnxAdditionalInfo::bytes() const
     \sa isNull(), isValid()
 */
 QKnxAdditionalInfo QKnxAdditionalInfo::fromBytes(const QKnxByteArray &bytes, quint16 index)
+{
+    return fromBytes(QKnxByteArrayView(bytes), index);
+}
+
+/*!
+    \overload
+
+    The bytes are read directly from the memory referenced by the view, without
+    creating intermediate copies.
+*/
+QKnxAdditionalInfo QKnxAdditionalInfo::fromBytes(QKnxByteArrayView bytes, quint16 index)
 {
     const qint32 availableSize = bytes.size() - index;
     if (availableSize < 2)
@@ -306,7 +344,8 @@ QKnxAdditionalInfo QKnxAdditionalInfo::fromBytes(const QKnxByteArray &bytes, qui
     if (availableSize < size)
         return {};
 
-    return { QKnxAdditionalInfo::Type(bytes.at(index)), bytes.mid(index + 2, bytes.at(index + 1)) };
+    return { QKnxAdditionalInfo::Type(bytes.at(index)),
+        bytes.mid(index + 2, bytes.at(index + 1)).toByteArray() };
 }
 
 /*!
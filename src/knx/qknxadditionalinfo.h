@@ -34,6 +34,7 @@
 #include <QtCore/qstring.h>
 
 #include <QtKnx/qknxbytearray.h>
+#include <QtKnx/qknxbytearrayview.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -79,8 +80,11 @@ public:
 
     quint8 byte(quint8 index) const;
     QKnxByteArray bytes() const;
+    int serialize(quint8 *out, int capacity) const;
+    void writeTo(QKnxByteArray &out) const;
 
     static QKnxAdditionalInfo fromBytes(const QKnxByteArray &bytes, quint16 index = 0);
+    static QKnxAdditionalInfo fromBytes(QKnxByteArrayView bytes, quint16 index = 0);
     static qint32 expectedDataSize(QKnxAdditionalInfo::Type type, bool *isFixedSize = nullptr);
 
     bool operator==(const QKnxAdditionalInfo &other) const;
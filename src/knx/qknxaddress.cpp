@@ -78,12 +78,10 @@ QT_BEGIN_NAMESPACE
 */
 
 /*!
+    \fn QKnxAddress::Type QKnxAddress::type() const
+
     Returns the address type.
 */
-QKnxAddress::Type QKnxAddress::type() const
-{
-    return m_type;
-}
 
 /*!
     \fn QKnxAddress::QKnxAddress()
@@ -102,7 +100,7 @@ QKnxAddress::QKnxAddress(QKnxAddress::Type type, quint16 address)
     if (type != QKnxAddress::Type::Group && type != QKnxAddress::Type::Individual)
         return;
 
-    m_type = type;
+    setType(type);
     m_address = address;
 }
 
@@ -165,7 +163,7 @@ QKnxAddress::QKnxAddress(QKnxAddress::Type type, const QString &address)
     }
     if (type == QKnxAddress::Type::Group || type == QKnxAddress::Type::Individual) {
         if (convert({ QStringView{address}.mid(0) }) && sections.count() == 1) {
-            m_type = type;
+            setType(type);
             m_address = sections[0];
         }
     }
@@ -184,7 +182,7 @@ QKnxAddress::QKnxAddress(QKnxAddress::Type type, const QKnxByteArray &address)
     if (type != QKnxAddress::Type::Group && type != QKnxAddress::Type::Individual)
         return;
 
-    m_type = type;
+    setType(type);
     m_address = QKnxUtils::QUint16::fromBytes(address);
 }
 
@@ -228,7 +226,7 @@ QKnxAddress QKnxAddress::createIndividual(quint8 area, quint16 line, quint8 sequ
 */
 quint8 QKnxAddress::mainOrAreaSection() const
 {
-    if (m_type == QKnxAddress::Type::Individual)
+    if (type() == QKnxAddress::Type::Individual)
         return (m_address >> 12);
     return ((m_address >> 11) & 0x1f); // two and three level notation
 }
@@ -241,7 +239,7 @@ quint8 QKnxAddress::mainOrAreaSection() const
 */
 quint8 QKnxAddress::middleOrLineSection() const
 {
-    if (m_type == QKnxAddress::Type::Group)
+    if (type() == QKnxAddress::Type::Group)
         return ((m_address >> 8) & 0x07);
 
     // individual address
@@ -260,7 +258,7 @@ quint8 QKnxAddress::middleOrLineSection() const
 quint16 QKnxAddress::subOrDeviceSection(Notation notation) const
 {
     // group address with two level notation
-    if (m_type == QKnxAddress::Type::Group && notation == Notation::TwoLevel)
+    if (type() == QKnxAddress::Type::Group && notation == Notation::TwoLevel)
         return (m_address & 0x07ff);
 
     // individual address and group address with three level
@@ -273,7 +271,7 @@ quint16 QKnxAddress::subOrDeviceSection(Notation notation) const
 */
 bool QKnxAddress::isBroadcast() const
 {
-    return (m_type == QKnxAddress::Type::Group) && (m_address == 0x0000);
+    return (type() == QKnxAddress::Type::Group) && (m_address == 0x0000);
 }
 
 /*!
@@ -334,7 +332,7 @@ QKnxAddress QKnxAddress::Individual::Unregistered = { QKnxAddress::Type::Individ
 */
 bool QKnxAddress::isCouplerOrRouter() const
 {
-    return (m_type == QKnxAddress::Type::Individual) && (quint8(m_address) == 0x00);
+    return (type() == QKnxAddress::Type::Individual) && (quint8(m_address) == 0x00);
 }
 
 /*!
@@ -343,17 +341,14 @@ bool QKnxAddress::isCouplerOrRouter() const
 */
 bool QKnxAddress::isUnregistered() const
 {
-    return (m_type == QKnxAddress::Type::Individual) && (quint8(m_address) == 0xff);
+    return (type() == QKnxAddress::Type::Individual) && (quint8(m_address) == 0xff);
 }
 
 /*!
+    \fn bool QKnxAddress::isValid() const
+
     Returns \c true if this is a valid KNX address object; \c false otherwise.
 */
-bool QKnxAddress::isValid() const
-{
-    return (m_type == QKnxAddress::Type::Group || m_type == QKnxAddress::Type::Individual)
-        && m_address >= 0;
-}
 
 /*!
     Returns the KNX address as a string formatted using the internal stored
@@ -369,39 +364,45 @@ bool QKnxAddress::isValid() const
 QString QKnxAddress::toString(Notation notation) const
 {
     if (notation == QKnxAddress::Notation::ThreeLevel) {
-        if (m_type == QKnxAddress::Type::Group) {
+        if (type() == QKnxAddress::Type::Group) {
             return QStringLiteral("%1/%2/%3").arg((m_address >> 11) & 0x1f)
                 .arg((m_address >> 8) & 0x07).arg(m_address & 0xff);
         }
-        if (m_type == QKnxAddress::Type::Individual) {
+        if (type() == QKnxAddress::Type::Individual) {
             return QStringLiteral("%1.%2.%3").arg(m_address >> 12)
                 .arg((m_address >> 8) & 0x0f).arg(m_address & 0xff);
         }
     }
-    if (notation == QKnxAddress::Notation::TwoLevel && m_type == QKnxAddress::Type::Group)
+    if (notation == QKnxAddress::Notation::TwoLevel && type() == QKnxAddress::Type::Group)
         return QStringLiteral("%1/%2").arg((m_address >> 11) & 0x1f).arg(m_address & 0x07ff);
     return QString();
 }
 
 /*!
+    \fn bool QKnxAddress::operator==(const QKnxAddress &other) const
+
     Returns \c true if this object is equal with \a other; otherwise
     returns \c false.
 */
 
-bool QKnxAddress::operator==(const QKnxAddress &other) const
-{
-    return m_address == other.m_address && m_type == other.m_type;
-}
-
 /*!
+    \fn bool QKnxAddress::operator!=(const QKnxAddress &other) const
+
     Returns \c true if this object is not equal with \a other; otherwise
     returns \c false.
 */
 
-bool QKnxAddress::operator!=(const QKnxAddress &other) const
-{
-    return !operator==(other);
-}
+/*!
+    \fn bool QKnxAddress::operator<(const QKnxAddress &other) const
+    \since 6.2
+
+    Returns \c true if this object is ordered before \a other; otherwise
+    returns \c false. Invalid addresses are ordered before individual
+    addresses, which in turn are ordered before group addresses. Addresses of
+    the same type are ordered by their 16-bit value.
+
+    This allows to use QKnxAddress as key in ordered containers such as QMap.
+*/
 
 /*!
     \fn QKnxByteArray QKnxAddress::bytes() const
@@ -411,6 +412,16 @@ bool QKnxAddress::operator!=(const QKnxAddress &other) const
     value are part of the address.
 */
 
+/*!
+    \fn quint16 QKnxAddress::toUInt16() const
+    \since 6.2
+
+    Returns the raw 16-bit value of the KNX address if the address is valid;
+    otherwise returns \c 0.
+
+    \sa isValid(), type()
+*/
+
 /*!
     \relates QKnxAddress
 
@@ -457,19 +468,19 @@ QKnxAddress::QKnxAddress(QKnxAddress::Type type, quint16 sec1, quint16 *sec2, qu
     if (type == QKnxAddress::Type::Group) {
         if (!sec2) {
             if (checkRange(QKnxAddress::Notation::TwoLevel)) {
-                m_type = type;
+                setType(type);
                 m_address = quint16(sec1 << 11 | sec3);
             }
         } else {
             if (checkRange(QKnxAddress::Notation::ThreeLevel)) {
-                m_type = type;
+                setType(type);
                 m_address = quint16(sec1 << 11 | (*sec2) << 8 | sec3);
             }
         }
     }
     if (type == QKnxAddress::Type::Individual) {
     if (checkRange(QKnxAddress::Notation::ThreeLevel)) {
-            m_type = type;
+            setType(type);
             m_address = quint16(sec1 << 12 | (*sec2) << 8 | sec3);
         }
     }
@@ -477,7 +488,7 @@ QKnxAddress::QKnxAddress(QKnxAddress::Type type, quint16 sec1, quint16 *sec2, qu
 
 size_t qHash(const QKnxAddress &key, uint seed) Q_DECL_NOTHROW
 {
-    return qHash(key.bytes(), seed);
+    return qHash(quint32(key.type()) << 16 | key.toUInt16(), seed);
 }
 
 QT_END_NAMESPACE
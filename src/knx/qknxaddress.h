@@ -45,7 +45,11 @@ public:
         Group = 0x01,
         Individual = 0x00
     };
-    QKnxAddress::Type type() const;
+    Q_DECL_CONSTEXPR QKnxAddress::Type type() const
+    {
+        return m_kind == 0 ? static_cast<QKnxAddress::Type>(0xff)
+            : static_cast<QKnxAddress::Type>(m_kind - 1);
+    }
 
     enum class Notation : quint8
     {
@@ -67,7 +71,7 @@ public:
     quint8 middleOrLineSection() const;
     quint16 subOrDeviceSection(Notation notation = Notation::ThreeLevel) const;
 
-    bool isValid() const;
+    Q_DECL_CONSTEXPR bool isValid() const { return m_kind != 0; }
     bool isBroadcast() const;
 
     bool isUnregistered() const;
@@ -81,24 +85,39 @@ public:
     {
         if (!isValid())
             return {};
-        return QKnxUtils::QUint16::bytes(quint16(m_address));
+        return QKnxUtils::QUint16::bytes(m_address);
     }
+    Q_DECL_CONSTEXPR quint16 toUInt16() const { return m_address; }
 
     QString toString(Notation notation = Notation::ThreeLevel) const;
 
-    bool operator==(const QKnxAddress &other) const;
-    bool operator!=(const QKnxAddress &other) const;
+    Q_DECL_CONSTEXPR bool operator==(const QKnxAddress &other) const
+    {
+        return m_address == other.m_address && m_kind == other.m_kind;
+    }
+    Q_DECL_CONSTEXPR bool operator!=(const QKnxAddress &other) const
+    {
+        return !operator==(other);
+    }
+    Q_DECL_CONSTEXPR bool operator<(const QKnxAddress &other) const
+    {
+        return (quint32(m_kind) << 16 | m_address) < (quint32(other.m_kind) << 16 | other.m_address);
+    }
 
 private:
     QKnxAddress(QKnxAddress::Type type, quint16 sec1, quint16 *sec2, quint16 sec3);
+    void setType(QKnxAddress::Type type) { m_kind = quint8(type) + 1; }
 
 private:
-    qint32 m_address = -1;
-    QKnxAddress::Type m_type = static_cast<QKnxAddress::Type>(0xff);
+    // A zero-initialized object represents an invalid address, m_kind stores
+    // the address type plus one for valid addresses.
+    quint16 m_address = 0;
+    quint8 m_kind = 0;
 };
 Q_KNX_EXPORT QDebug operator<<(QDebug debug, const QKnxAddress &address);
 Q_KNX_EXPORT Q_DECL_PURE_FUNCTION size_t qHash(const QKnxAddress &key, uint seed = 0) Q_DECL_NOTHROW;
 
+Q_DECLARE_TYPEINFO(QKnxAddress, Q_PRIMITIVE_TYPE);
 Q_DECLARE_TYPEINFO(QKnxAddress::Type, Q_PRIMITIVE_TYPE);
 Q_DECLARE_TYPEINFO(QKnxAddress::Notation, Q_PRIMITIVE_TYPE);
 
@@ -566,9 +566,21 @@ QKnxByteArray QKnxDeviceManagementFrame::bytes() const
 QKnxDeviceManagementFrame QKnxDeviceManagementFrame::fromBytes(const QKnxByteArray &data,
     quint16 index, quint16 size)
 {
-    if (data.size() < 1)
+    return fromBytes(QKnxByteArrayView(data), index, size);
+}
+
+/*!
+    \overload
+
+    The bytes are read directly from the memory referenced by the view, without
+    creating intermediate copies.
+*/
+QKnxDeviceManagementFrame QKnxDeviceManagementFrame::fromBytes(QKnxByteArrayView data,
+    quint16 index, quint16 size)
+{
+    if (data.size() - index < 1)
         return {};
-    return { MessageCode(data.at(index)), data.mid(index + 1, size - 1) };
+    return { MessageCode(data.at(index)), data.mid(index + 1, size - 1).toByteArray() };
 }
 
 /*!
@@ -33,6 +33,7 @@
 #include <QtCore/qshareddata.h>
 
 #include <QtKnx/qknxbytearray.h>
+#include <QtKnx/qknxbytearrayview.h>
 #include <QtKnx/qtknxglobal.h>
 #include <QtKnx/qknxinterfaceobjectproperty.h>
 #include <QtKnx/qknxinterfaceobjecttype.h>
@@ -114,6 +115,8 @@ public:
     QKnxByteArray bytes() const;
     static QKnxDeviceManagementFrame fromBytes(const QKnxByteArray &data, quint16 index,
         quint16 size);
+    static QKnxDeviceManagementFrame fromBytes(QKnxByteArrayView data, quint16 index,
+        quint16 size);
 
     QKnxDeviceManagementFrame(const QKnxDeviceManagementFrame &other);
     QKnxDeviceManagementFrame &operator=(const QKnxDeviceManagementFrame &other);
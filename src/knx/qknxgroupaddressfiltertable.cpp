@@ -0,0 +1,254 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtKnx module.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include "qknxgroupaddressfiltertable.h"
+#include "qknxgroupaddressinfos.h"
+
+QT_BEGIN_NAMESPACE
+
+namespace {
+    // One bit for every possible 16-bit group address, 8 KiB in total.
+    const int GroupAddressCount = 0x10000;
+}
+
+/*!
+    \class QKnxGroupAddressFilterTable
+
+    \since 6.2
+    \inmodule QtKnx
+    \ingroup qtknx-general-classes
+
+    \brief The QKnxGroupAddressFilterTable class represents a set of KNX group
+    addresses used to filter routed telegrams.
+
+    The table stores one bit for each of the 65,536 possible group addresses,
+    so checking whether an address is part of the table is a single bit test,
+    independent of the number of entries. The storage is allocated the first
+    time an address is inserted and is implicitly shared between copies.
+
+    Individual addresses are never part of the table, inserting them has no
+    effect and contains() always returns \c false for them.
+
+    Besides inserting single addresses, whole ranges can be inserted at once.
+    The following code inserts all group addresses of main group 3:
+
+    \code
+        QKnxGroupAddressFilterTable table;
+        table.insert(QKnxAddress::createGroup(3, 0, 0),
+            QKnxAddress::createGroup(3, 7, 255));
+    \endcode
+
+    \sa QKnxNetIpRouter::setGroupAddressFilterTable()
+*/
+
+/*!
+    \fn QKnxGroupAddressFilterTable::QKnxGroupAddressFilterTable()
+
+    Constructs an empty filter table.
+*/
+
+/*!
+    Constructs a filter table containing the group addresses of \a addresses.
+*/
+QKnxGroupAddressFilterTable::QKnxGroupAddressFilterTable(const QSet<QKnxAddress> &addresses)
+{
+    for (const auto &address : addresses)
+        insert(address);
+}
+
+/*!
+    Constructs a filter table containing all group addresses found in \a infos
+    for the project with the ID \a projectId and the installation
+    \a installation.
+*/
+QKnxGroupAddressFilterTable::QKnxGroupAddressFilterTable(const QKnxGroupAddressInfos &infos,
+        const QString &projectId, const QString &installation)
+{
+    insert(infos, projectId, installation);
+}
+
+/*!
+    Returns \c true if the table does not contain any group address; otherwise
+    returns \c false.
+*/
+bool QKnxGroupAddressFilterTable::isEmpty() const
+{
+    return m_count == 0;
+}
+
+/*!
+    Returns the number of group addresses in the table.
+*/
+int QKnxGroupAddressFilterTable::count() const
+{
+    return m_count;
+}
+
+/*!
+    Removes all group addresses from the table and releases its storage.
+*/
+void QKnxGroupAddressFilterTable::clear()
+{
+    m_bits.clear();
+    m_count = 0;
+}
+
+/*!
+    \fn bool QKnxGroupAddressFilterTable::contains(const QKnxAddress &address) const
+
+    Returns \c true if the group address \a address is part of the table;
+    otherwise returns \c false.
+*/
+
+/*!
+    Inserts the group address \a address into the table. Invalid and
+    individual addresses are ignored.
+*/
+void QKnxGroupAddressFilterTable::insert(const QKnxAddress &address)
+{
+    setRange(address, address, true);
+}
+
+/*!
+    Inserts all group addresses from \a first up to and including \a last
+    into the table. The range is ignored if one of the addresses is not a
+    valid group address.
+*/
+void QKnxGroupAddressFilterTable::insert(const QKnxAddress &first, const QKnxAddress &last)
+{
+    setRange(first, last, true);
+}
+
+/*!
+    Inserts all group addresses found in \a infos for the project with the ID
+    \a projectId and the installation \a installation into the table.
+*/
+void QKnxGroupAddressFilterTable::insert(const QKnxGroupAddressInfos &infos,
+    const QString &projectId, const QString &installation)
+{
+    const auto addressInfos = infos.addressInfos(projectId, installation);
+    for (const auto &info : addressInfos)
+        insert(info.address());
+}
+
+/*!
+    Removes the group address \a address from the table.
+*/
+void QKnxGroupAddressFilterTable::remove(const QKnxAddress &address)
+{
+    setRange(address, address, false);
+}
+
+/*!
+    Removes all group addresses from \a first up to and including \a last
+    from the table.
+*/
+void QKnxGroupAddressFilterTable::remove(const QKnxAddress &first, const QKnxAddress &last)
+{
+    setRange(first, last, false);
+}
+
+/*!
+    Returns the group addresses of the table as a set.
+*/
+QSet<QKnxAddress> QKnxGroupAddressFilterTable::toSet() const
+{
+    QSet<QKnxAddress> set;
+    for (int i = 0; i < m_bits.size(); ++i) {
+        if (m_bits.testBit(i))
+            set.insert({ QKnxAddress::Type::Group, quint16(i) });
+    }
+    return set;
+}
+
+/*!
+    Returns \c true if this table and the given \a other table contain the
+    same group addresses; otherwise returns \c false.
+*/
+bool QKnxGroupAddressFilterTable::operator==(const QKnxGroupAddressFilterTable &other) const
+{
+    if (m_count != other.m_count)
+        return false;
+    return m_count == 0 || m_bits == other.m_bits;
+}
+
+/*!
+    Returns \c true if this table and the given \a other table do not contain
+    the same group addresses; otherwise returns \c false.
+*/
+bool QKnxGroupAddressFilterTable::operator!=(const QKnxGroupAddressFilterTable &other) const
+{
+    return !operator==(other);
+}
+
+/*!
+    \internal
+*/
+void QKnxGroupAddressFilterTable::setRange(const QKnxAddress &first, const QKnxAddress &last,
+    bool value)
+{
+    if (first.type() != QKnxAddress::Type::Group || last.type() != QKnxAddress::Type::Group)
+        return;
+
+    if (m_bits.isEmpty()) {
+        if (!value)
+            return;
+        m_bits.resize(GroupAddressCount);
+    }
+
+    const int begin = qMin(first.toUInt16(), last.toUInt16());
+    const int end = qMax(first.toUInt16(), last.toUInt16()) + 1;
+    if (end - begin == 1) {
+        if (m_bits.testBit(begin) == value)
+            return;
+        m_bits.setBit(begin, value);
+        m_count += value ? 1 : -1;
+        return;
+    }
+
+    // keep the number of addresses up to date without counting the whole table
+    int changed = end - begin;
+    for (int i = begin; i < end; ++i)
+        changed -= (m_bits.testBit(i) == value);
+    m_bits.fill(value, begin, end);
+    m_count += value ? changed : -changed;
+}
+
+QT_END_NAMESPACE
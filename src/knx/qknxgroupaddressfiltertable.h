@@ -0,0 +1,93 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtKnx module.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#ifndef QKNXGROUPADDRESSFILTERTABLE_H
+#define QKNXGROUPADDRESSFILTERTABLE_H
+
+#include <QtCore/qbitarray.h>
+#include <QtCore/qset.h>
+#include <QtKnx/qknxaddress.h>
+#include <QtKnx/qtknxglobal.h>
+
+QT_BEGIN_NAMESPACE
+
+class QKnxGroupAddressInfos;
+class Q_KNX_EXPORT QKnxGroupAddressFilterTable final
+{
+public:
+    QKnxGroupAddressFilterTable() = default;
+    explicit QKnxGroupAddressFilterTable(const QSet<QKnxAddress> &addresses);
+    QKnxGroupAddressFilterTable(const QKnxGroupAddressInfos &infos, const QString &projectId,
+        const QString &installation = {});
+
+    bool isEmpty() const;
+    int count() const;
+    void clear();
+
+    bool contains(const QKnxAddress &address) const
+    {
+        return address.type() == QKnxAddress::Type::Group && !m_bits.isEmpty()
+            && m_bits.testBit(address.toUInt16());
+    }
+
+    void insert(const QKnxAddress &address);
+    void insert(const QKnxAddress &first, const QKnxAddress &last);
+    void insert(const QKnxGroupAddressInfos &infos, const QString &projectId,
+        const QString &installation = {});
+
+    void remove(const QKnxAddress &address);
+    void remove(const QKnxAddress &first, const QKnxAddress &last);
+
+    QSet<QKnxAddress> toSet() const;
+
+    bool operator==(const QKnxGroupAddressFilterTable &other) const;
+    bool operator!=(const QKnxGroupAddressFilterTable &other) const;
+
+private:
+    void setRange(const QKnxAddress &first, const QKnxAddress &last, bool value);
+
+private:
+    QBitArray m_bits;
+    int m_count = 0;
+};
+
+QT_END_NAMESPACE
+
+#endif
@@ -126,8 +126,42 @@ public:
     quint8 m_additionalInfoSize { 0 };
     mutable bool m_additionalInfosSorted { true };
     mutable QList<QKnxAdditionalInfo> m_additionalInfos;
+
+    void setServiceInformation(QKnxByteArrayView data);
 };
 
+void QKnxLinkLayerFramePrivate::setServiceInformation(QKnxByteArrayView data)
+{
+    if (data.size() < 1)
+        return;
+
+    const auto address = [data](QKnxAddress::Type type, int index) -> QKnxAddress {
+        if (data.size() - index < 2)
+            return {};
+        return { type, QKnxUtils::QUint16::fromBytes(data, index) };
+    };
+
+    int index = 1;
+    quint8 addinfoLen = data.at(0);
+    while (index < addinfoLen) {
+        auto info = QKnxAdditionalInfo::fromBytes(data, index);
+        m_additionalInfos.append(info);
+        m_additionalInfosSorted = false;
+        m_additionalInfoSize += info.size();
+        index = index + info.size() + 1;
+    }
+    m_ctrl = QKnxControlField(data.value(index));
+    ++index;
+    m_extCtrl = QKnxExtendedControlField(data.value(index));
+    ++index;
+    m_srcAddress = address(QKnxAddress::Type::Individual, index);
+    index += 2;
+    m_dstAddress = address(m_extCtrl.destinationAddressType(), index);
+    index += 2;
+    // length doesn't include TPCI therefore add +1
+    m_tpdu = QKnxTpdu::fromBytes(data, index + 1, data.value(index) + 1, m_mediumType);
+}
+
 /*!
     Constructs an empty link layer frame with the medium type set to
     \l QKnx::MediumType \c NetIP.
@@ -400,11 +434,25 @@ void QKnxLinkLayerFrame::setMediumType(QKnx::MediumType type)
 }
 
 /*!
-    Returns the number of bytes of the link layer frame.
+    Returns the number of bytes of the link layer frame if it is valid;
+    otherwise returns \c 0.
+
+    The size is computed from the frame's fields without encoding the frame.
 */
 quint16 QKnxLinkLayerFrame::size() const
 {
-    return bytes().size();
+    if (!isValid())
+        return 0;
+
+    int size = 2; // message code and additional info length
+    for (const auto &info : qAsConst(d_ptr->m_additionalInfos))
+        size += (info.isValid() ? info.size() : 0);
+
+    size += d_ptr->m_ctrl.size() + d_ptr->m_extCtrl.size();
+    size += (d_ptr->m_srcAddress.isValid() ? d_ptr->m_srcAddress.size() : 0);
+    size += (d_ptr->m_dstAddress.isValid() ? d_ptr->m_dstAddress.size() : 0);
+
+    return quint16(size + 1 + d_ptr->m_tpdu.size()); // 1 -> NPDU length field
 }
 
 /*!
@@ -422,26 +470,7 @@ QKnxByteArray QKnxLinkLayerFrame::serviceInformation() const
 */
 void QKnxLinkLayerFrame::setServiceInformation(const QKnxByteArray &data)
 {
-    if (data.size() < 1)
-        return;
-
-    int index = 1;
-    quint8 addinfoLen = data.at(0);
-    while (index < addinfoLen) {
-        auto info = QKnxAdditionalInfo::fromBytes(data, index);
-        addAdditionalInfo(info);
-        index = index + info.size() + 1;
-    }
-    d_ptr->m_ctrl = QKnxControlField(data.at(index));
-    ++index;
-    d_ptr->m_extCtrl = QKnxExtendedControlField(data.at(index));
-    ++index;
-    d_ptr->m_srcAddress = { QKnxAddress::Type::Individual, data.mid(index, 2) };
-    index += 2;
-    d_ptr->m_dstAddress = { d_ptr->m_extCtrl.destinationAddressType(), data.mid(index, 2) };
-    index += 2;
-    // length doesn't include TPCI therefore add +1
-    d_ptr->m_tpdu = QKnxTpdu::fromBytes(data, index + 1, data.at(index) + 1, d_ptr->m_mediumType);
+    d_ptr->setServiceInformation(data);
 }
 
 /*!
@@ -450,21 +479,69 @@ void QKnxLinkLayerFrame::setServiceInformation(const QKnxByteArray &data)
 */
 QKnxByteArray QKnxLinkLayerFrame::bytes() const
 {
-    if (!isValid())
+    const auto size = this->size();
+    if (size == 0)
         return {};
 
-    QKnxByteArray addAdditionalInfoBytes;
-    for (const auto &info : d_ptr->m_additionalInfos)
-        addAdditionalInfoBytes += info.bytes();
+    QKnxByteArray bytes(size, Qt::Uninitialized);
+    serialize(bytes.data(), size);
+    return bytes;
+}
+
+/*!
+    Writes the link layer frame to the memory pointed to by \a out, which can
+    hold up to \a capacity bytes. Returns the number of bytes written, which
+    equals size(). If the frame is not valid or \a capacity is too small,
+    nothing is written and \c 0 is returned.
+
+    The fields are encoded directly into the given memory, without creating
+    intermediate byte arrays.
+
+    \sa bytes(), writeTo()
+*/
+int QKnxLinkLayerFrame::serialize(quint8 *out, int capacity) const
+{
+    const int size = this->size();
+    if (size == 0 || capacity < size)
+        return 0;
+
+    auto p = out;
+    *p++ = quint8(d_ptr->m_code);
+    *p++ = d_ptr->m_additionalInfoSize;
+    for (const auto &info : qAsConst(d_ptr->m_additionalInfos))
+        p += info.serialize(p, size - int(p - out));
+
+    *p++ = d_ptr->m_ctrl.byte();
+    *p++ = d_ptr->m_extCtrl.byte();
+
+    for (const auto &address : { d_ptr->m_srcAddress, d_ptr->m_dstAddress }) {
+        if (!address.isValid())
+            continue;
+        const auto addressBytes = address.bytes();
+        *p++ = addressBytes.at(0);
+        *p++ = addressBytes.at(1);
+    }
 
-    return QKnxByteArray { quint8(d_ptr->m_code), d_ptr->m_additionalInfoSize }
-        + addAdditionalInfoBytes
-        + d_ptr->m_ctrl.bytes()
-        + d_ptr->m_extCtrl.bytes()
-        + d_ptr->m_srcAddress.bytes()
-        + d_ptr->m_dstAddress.bytes()
-        + QKnxUtils::QUint8::bytes(d_ptr->m_tpdu.dataSize())
-        + d_ptr->m_tpdu.bytes();
+    *p++ = quint8(d_ptr->m_tpdu.dataSize());
+    p += d_ptr->m_tpdu.serialize(p, size - int(p - out));
+
+    return int(p - out);
+}
+
+/*!
+    Appends the link layer frame to \a out if the frame is valid.
+
+    \sa bytes(), serialize()
+*/
+void QKnxLinkLayerFrame::writeTo(QKnxByteArray &out) const
+{
+    const int size = this->size();
+    if (size == 0)
+        return;
+
+    const int offset = out.size();
+    out.resize(offset + size);
+    serialize(out.data() + offset, size);
 }
 
 /*!
@@ -474,6 +551,18 @@ QKnxByteArray QKnxLinkLayerFrame::bytes() const
 */
 QKnxLinkLayerFrame QKnxLinkLayerFrame::fromBytes(const QKnxByteArray &data, quint16 index,
     quint16 size, QKnx::MediumType mediumType)
+{
+    return fromBytes(QKnxByteArrayView(data), index, size, mediumType);
+}
+
+/*!
+    \overload
+
+    The bytes are read directly from the memory referenced by the view, without
+    creating intermediate copies.
+*/
+QKnxLinkLayerFrame QKnxLinkLayerFrame::fromBytes(QKnxByteArrayView data, quint16 index,
+    quint16 size, QKnx::MediumType mediumType)
 {
     // data is not big enough according to the given size to be read
     const qint32 availableSize = (data.size() - index) - size;
@@ -482,7 +571,7 @@ QKnxLinkLayerFrame QKnxLinkLayerFrame::fromBytes(const QKnxByteArray &data, quin
 
     QKnxLinkLayerFrame frame(MessageCode(data.value(index)));
     frame.setMediumType(mediumType);
-    frame.setServiceInformation(data.mid(index + 1, size - 1));
+    frame.d_ptr->setServiceInformation(data.mid(index + 1, size - 1));
     return frame;
 }
 
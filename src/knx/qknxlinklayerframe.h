@@ -33,6 +33,7 @@
 #include <QtKnx/qknxadditionalinfo.h>
 #include <QtKnx/qknxaddress.h>
 #include <QtKnx/qknxbytearray.h>
+#include <QtKnx/qknxbytearrayview.h>
 #include <QtKnx/qknxcontrolfield.h>
 #include <QtKnx/qknxextendedcontrolfield.h>
 #include <QtKnx/qtknxglobal.h>
@@ -93,8 +94,12 @@ public:
     void setServiceInformation(const QKnxByteArray &serviceInfo);
 
     QKnxByteArray bytes() const;
+    int serialize(quint8 *out, int capacity) const;
+    void writeTo(QKnxByteArray &out) const;
     static QKnxLinkLayerFrame fromBytes(const QKnxByteArray &data, quint16 index, quint16 size,
         QKnx::MediumType mediumType = QKnx::MediumType::NetIP);
+    static QKnxLinkLayerFrame fromBytes(QKnxByteArrayView data, quint16 index, quint16 size,
+        QKnx::MediumType mediumType = QKnx::MediumType::NetIP);
 
     // Parts of the LinkLayer frame alway there (regardless of the MessageCode/Frame Type)
     const QKnxAddress sourceAddress() const;
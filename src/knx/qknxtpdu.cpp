@@ -626,6 +626,32 @@ QKnxByteArray QKnxTpdu::bytes() const
     return d_ptr->m_tpduBytes;
 }
 
+/*!
+    Writes the TPDU to the memory pointed to by \a out, which can hold up to
+    \a capacity bytes. Returns the number of bytes written, which equals size().
+    If \a capacity is too small, nothing is written and \c 0 is returned.
+
+    \sa bytes(), writeTo()
+*/
+int QKnxTpdu::serialize(quint8 *out, int capacity) const
+{
+    const auto &bytes = d_ptr->m_tpduBytes;
+    if (capacity < bytes.size())
+        return 0;
+    memcpy(out, bytes.constData(), bytes.size());
+    return bytes.size();
+}
+
+/*!
+    Appends the TPDU to \a out.
+
+    \sa bytes(), serialize()
+*/
+void QKnxTpdu::writeTo(QKnxByteArray &out) const
+{
+    out.append(d_ptr->m_tpduBytes);
+}
+
 /*!
     Creates a TPDU with the medium type \a mediumType from the byte array
     \a data starting at the position \a index inside the array with the size
@@ -633,13 +659,25 @@ QKnxByteArray QKnxTpdu::bytes() const
 */
 QKnxTpdu QKnxTpdu::fromBytes(const QKnxByteArray &data, quint16 index, quint16 size,
     QKnx::MediumType mediumType)
+{
+    return fromBytes(QKnxByteArrayView(data), index, size, mediumType);
+}
+
+/*!
+    \overload
+
+    The bytes are read directly from the memory referenced by the view, without
+    creating intermediate copies.
+*/
+QKnxTpdu QKnxTpdu::fromBytes(QKnxByteArrayView data, quint16 index, quint16 size,
+    QKnx::MediumType mediumType)
 {
     // data is not big enough according to the given size to be read
     const qint32 availableSize = (data.size() - index) - size;
     if (availableSize < 0) // the TPDU consists at least out of a single byte (TPCI)
         return { TransportControlField::Invalid, ApplicationControlField::Invalid };
 
-    QKnxTpdu tpdu(data.mid(index, size));
+    QKnxTpdu tpdu(data.mid(index, size).toByteArray());
     tpdu.setMediumType(mediumType);
     tpdu.setTransportControlField(QKnxTpdu::tpci(data, index));
     tpdu.setApplicationControlField(QKnxTpdu::apci(data, index));
@@ -657,6 +695,17 @@ QKnxTpdu QKnxTpdu::fromBytes(const QKnxByteArray &data, quint16 index, quint16 s
     to pass data that is a TPDU.
 */
 quint8 QKnxTpdu::sequenceNumber(const QKnxByteArray &data, quint8 index, bool *ok)
+{
+    return sequenceNumber(QKnxByteArrayView(data), index, ok);
+}
+
+/*!
+    \overload
+
+    The bytes are read directly from the memory referenced by the view, without
+    creating intermediate copies.
+*/
+quint8 QKnxTpdu::sequenceNumber(QKnxByteArrayView data, quint8 index, bool *ok)
 {
     if (ok)
         *ok = false;
@@ -690,6 +739,17 @@ quint8 QKnxTpdu::sequenceNumber(const QKnxByteArray &data, quint8 index, bool *o
     to pass data that is a TPDU.
 */
 QKnxTpdu::TransportControlField QKnxTpdu::tpci(const QKnxByteArray &data, quint8 index)
+{
+    return tpci(QKnxByteArrayView(data), index);
+}
+
+/*!
+    \overload
+
+    The bytes are read directly from the memory referenced by the view, without
+    creating intermediate copies.
+*/
+QKnxTpdu::TransportControlField QKnxTpdu::tpci(QKnxByteArrayView data, quint8 index)
 {
     if (data.size() - index < 1)
         return QKnxTpdu::TransportControlField::Invalid;
@@ -722,6 +782,17 @@ QKnxTpdu::TransportControlField QKnxTpdu::tpci(const QKnxByteArray &data, quint8
     to pass data that is a TPDU.
 */
 QKnxTpdu::ApplicationControlField QKnxTpdu::apci(const QKnxByteArray &data, quint8 index)
+{
+    return apci(QKnxByteArrayView(data), index);
+}
+
+/*!
+    \overload
+
+    The bytes are read directly from the memory referenced by the view, without
+    creating intermediate copies.
+*/
+QKnxTpdu::ApplicationControlField QKnxTpdu::apci(QKnxByteArrayView data, quint8 index)
 {
     if (data.size() - index < 2)
         return QKnxTpdu::ApplicationControlField::Invalid;
@@ -32,6 +32,7 @@
 
 #include <QtCore/qshareddata.h>
 #include <QtKnx/qknxbytearray.h>
+#include <QtKnx/qknxbytearrayview.h>
 #include <QtKnx/qtknxglobal.h>
 #include <QtKnx/qknxnetip.h>
 
@@ -191,13 +192,21 @@ public:
     void setData(const QKnxByteArray &data);
 
     QKnxByteArray bytes() const;
+    int serialize(quint8 *out, int capacity) const;
+    void writeTo(QKnxByteArray &out) const;
     static QKnxTpdu fromBytes(const QKnxByteArray &data, quint16 index, quint16 size,
         QKnx::MediumType mediumType = QKnx::MediumType::NetIP);
+    static QKnxTpdu fromBytes(QKnxByteArrayView data, quint16 index, quint16 size,
+        QKnx::MediumType mediumType = QKnx::MediumType::NetIP);
 
     static QKnxTpdu::TransportControlField tpci(const QKnxByteArray &data, quint8 index);
     static QKnxTpdu::ApplicationControlField apci(const QKnxByteArray &data, quint8 index);
     static quint8 sequenceNumber(const QKnxByteArray &data, quint8 index, bool *ok = nullptr);
 
+    static QKnxTpdu::TransportControlField tpci(QKnxByteArrayView data, quint8 index);
+    static QKnxTpdu::ApplicationControlField apci(QKnxByteArrayView data, quint8 index);
+    static quint8 sequenceNumber(QKnxByteArrayView data, quint8 index, bool *ok = nullptr);
+
     QKnxTpdu(const QKnxTpdu &other);
     QKnxTpdu &operator=(const QKnxTpdu &other);
 
@@ -31,6 +31,7 @@
 #define QKNXUTILS_H
 
 #include <QtKnx/qknxbytearray.h>
+#include <QtKnx/qknxbytearrayview.h>
 #include <QtKnx/qtknxglobal.h>
 #include <QtNetwork/qhostaddress.h>
 
@@ -46,6 +47,11 @@ struct QKnxUtils final
         }
 
         static quint8 fromBytes(const QKnxByteArray &data, quint16 index = 0)
+        {
+            return fromBytes(QKnxByteArrayView(data), index);
+        }
+
+        static quint8 fromBytes(QKnxByteArrayView data, quint16 index = 0)
         {
             if (data.size() - index < 1)
                 return {};
@@ -61,6 +67,11 @@ struct QKnxUtils final
         }
 
         static quint16 fromBytes(const QKnxByteArray &data, quint16 index = 0)
+        {
+            return fromBytes(QKnxByteArrayView(data), index);
+        }
+
+        static quint16 fromBytes(QKnxByteArrayView data, quint16 index = 0)
         {
             if (data.size() - index < 2)
                 return {};
@@ -77,6 +88,11 @@ struct QKnxUtils final
         }
 
         static quint32 fromBytes(const QKnxByteArray &data, quint16 index = 0)
+        {
+            return fromBytes(QKnxByteArrayView(data), index);
+        }
+
+        static quint32 fromBytes(QKnxByteArrayView data, quint16 index = 0)
         {
             if (data.size() - index < 4)
                 return {};
@@ -96,6 +112,11 @@ struct QKnxUtils final
         }
 
         static quint48 fromBytes(const QKnxByteArray &data, quint16 index = 0)
+        {
+            return fromBytes(QKnxByteArrayView(data), index);
+        }
+
+        static quint48 fromBytes(QKnxByteArrayView data, quint16 index = 0)
         {
             if (data.size() - index < 6)
                 return {};
@@ -118,6 +139,11 @@ struct QKnxUtils final
         }
 
         static quint64 fromBytes(const QKnxByteArray &data, quint16 index = 0)
+        {
+            return fromBytes(QKnxByteArrayView(data), index);
+        }
+
+        static quint64 fromBytes(QKnxByteArrayView data, quint16 index = 0)
         {
             if (data.size() - index < 8)
                 return {};
@@ -140,6 +166,11 @@ struct QKnxUtils final
         }
 
         static QHostAddress fromBytes(const QKnxByteArray &data, quint16 index = 0)
+        {
+            return fromBytes(QKnxByteArrayView(data), index);
+        }
+
+        static QHostAddress fromBytes(QKnxByteArrayView data, quint16 index = 0)
         {
             if (data.size() - index < 4)
                 return {};
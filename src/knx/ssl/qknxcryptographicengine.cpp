@@ -35,6 +35,7 @@
 #include "qknxnetipsessionstatus.h"
 #include "qknxnetiptimernotify.h"
 
+#include "private/qknxcryptographicengine_p.h"
 #include "private/qknxssl_p.h"
 
 #include <QtCore/qcryptographichash.h>
@@ -42,6 +43,8 @@
 
 #include <QtNetwork/qpassworddigestor.h>
 
+#include <string.h>
+
 QT_BEGIN_NAMESPACE
 
 /*!
@@ -210,6 +213,17 @@ QKnxByteArray QKnxCryptographicEngine::sessionKey(const QKnxByteArray &sharedSec
         QCryptographicHash::Sha256)).mid(0, 16);
 }
 
+namespace QKnxPrivate
+{
+    static QKnxByteArray passwordHash(const QByteArray &password, const QByteArray &salt)
+    {
+        if (auto cache = QKnxKeyDerivationCache::instance())
+            return cache->pbkdf2Sha256(password, salt);
+        return QKnxByteArray::fromByteArray(QPasswordDigestor::deriveKeyPbkdf2(QCryptographicHash
+            ::Algorithm::Sha256, password, salt, 0x10000, QKnxKeyDerivationCache::KeySize));
+    }
+}
+
 /*!
     Returns the password hash derived from the user chosen password \a password.
 
@@ -218,9 +232,8 @@ QKnxByteArray QKnxCryptographicEngine::sessionKey(const QKnxByteArray &sharedSec
 */
 QKnxByteArray QKnxCryptographicEngine::userPasswordHash(const QByteArray &password)
 {
-    const auto hash = QPasswordDigestor::deriveKeyPbkdf2(QCryptographicHash::Algorithm::Sha256,
-        password, QByteArray("user-password.1.secure.ip.knx.org"), 0x10000, 16);
-    return QKnxByteArray::fromByteArray(hash);
+    return QKnxPrivate::passwordHash(password,
+        QByteArrayLiteral("user-password.1.secure.ip.knx.org"));
 }
 
 /*!
@@ -232,9 +245,7 @@ QKnxByteArray QKnxCryptographicEngine::userPasswordHash(const QByteArray &passwo
 */
 QKnxByteArray QKnxCryptographicEngine::keyringPasswordHash(const QByteArray &password)
 {
-    const auto hash = QPasswordDigestor::deriveKeyPbkdf2(QCryptographicHash::Algorithm::Sha256,
-        password, "1.keyring.ets.knx.org", 0x10000, 16);
-    return QKnxByteArray::fromByteArray(hash);
+    return QKnxPrivate::passwordHash(password, QByteArrayLiteral("1.keyring.ets.knx.org"));
 }
 
 /*!
@@ -246,9 +257,8 @@ QKnxByteArray QKnxCryptographicEngine::keyringPasswordHash(const QByteArray &pas
 */
 QKnxByteArray QKnxCryptographicEngine::deviceAuthenticationCodeHash(const QByteArray &password)
 {
-    const auto hash = QPasswordDigestor::deriveKeyPbkdf2(QCryptographicHash::Algorithm::Sha256,
-        password, "device-authentication-code.1.secure.ip.knx.org", 0x10000, 16);
-    return QKnxByteArray::fromByteArray(hash);
+    return QKnxPrivate::passwordHash(password,
+        QByteArrayLiteral("device-authentication-code.1.secure.ip.knx.org"));
 }
 
 /*!
@@ -277,18 +287,46 @@ QKnxByteArray QKnxCryptographicEngine::XOR(const QKnxByteArray &left, const QKnx
 
 namespace QKnxPrivate
 {
-    static const quint8 iv[16] { 0x00 };
-
-    static QKnxByteArray b0(quint48 sequence, const QKnxByteArray &serial, quint16 tag, quint16 len)
+    class CbcMac
     {
-        return QKnxUtils::QUint48::bytes(sequence) + serial + QKnxUtils::QUint16::bytes(tag)
-            + QKnxUtils::QUint16::bytes(len);
-    }
+    public:
+        explicit CbcMac(QKnxSslCipherContext &context)
+            : m_context(context)
+        {}
+
+        void addData(const quint8 *data, int size)
+        {
+            for (int i = 0; i < size; ++i) {
+                m_state[m_fill++] ^= data[i];
+                if (m_fill == QKnxSslCipherContext::BlockSize) {
+                    m_ok = m_ok && m_context.encryptBlocks(m_state, m_state, 1);
+                    m_fill = 0;
+                }
+            }
+        }
 
-    static QKnxByteArray ctr0(quint48 sequence, const QKnxByteArray &serial, quint16 tag)
-    {
-        return QKnxPrivate::b0(sequence, serial, tag, 0xff00);
-    }
+        void addData(quint16 value)
+        {
+            const quint8 bytes[2] { quint8(value >> 8), quint8(value) };
+            addData(bytes, 2);
+        }
+
+        bool result(quint8 *mac)
+        {
+            // The data is zero padded to the next multiple of the block size, a
+            // full block is added if it already is one. Padding with zeros does not
+            // change the state, so only the last block needs to be encrypted.
+            m_ok = m_ok && m_context.encryptBlocks(m_state, m_state, 1);
+            memcpy(mac, m_state, QKnxSslCipherContext::BlockSize);
+            return m_ok;
+        }
+
+    private:
+        QKnxSslCipherContext &m_context;
+        quint8 m_state[QKnxSslCipherContext::BlockSize] { };
+        int m_fill { 0 };
+        bool m_ok { true };
+    };
 
     static QKnxByteArray processMAC(const QKnxByteArray &key, const QKnxByteArray &mac,
         quint48 sequenceNumber, const QKnxByteArray &serialNumber, quint16 messageTag)
@@ -296,11 +334,15 @@ namespace QKnxPrivate
         if (key.isEmpty() || mac.isEmpty())
             return {};
 
-        auto Ctr0 = QKnxPrivate::ctr0(sequenceNumber,
-            (serialNumber.isEmpty() ? QKnxByteArray(6, 0x00) : serialNumber), messageTag);
-
-        return QKnxCryptographicEngine::XOR(QKnxSsl::doCrypt(key, { iv, 16 }, Ctr0,
-            QKnxSsl::Encrypt).right(16), mac);
+        QKnxSslCipherContext context(key);
+        auto result = mac;
+        result.resize(qMax(result.size(), int(QKnxCryptographicEnginePrivate::MacSize)));
+        auto out = result.data();
+        if (!QKnxCryptographicEnginePrivate::processMac(context, out, out,
+            QKnxCryptographicEnginePrivate::MacSize, sequenceNumber, serialNumber, messageTag)) {
+            return {};
+        }
+        return result;
     }
 
     static QKnxByteArray processPayload(const QKnxByteArray &key, const QKnxByteArray &payload,
@@ -309,17 +351,277 @@ namespace QKnxPrivate
         if (key.isEmpty() || payload.isEmpty())
             return {};
 
-        auto Ctr0 = QKnxPrivate::ctr0(sequenceNumber,
-            (serialNumber.isEmpty() ? QKnxByteArray(6, 0x00) : serialNumber), messageTag);
+        QKnxSslCipherContext context(key);
+        QKnxByteArray result(payload.size(), Qt::Uninitialized);
+        if (!QKnxCryptographicEnginePrivate::processPayload(context, payload.constData(),
+            result.data(), result.size(), sequenceNumber, serialNumber, messageTag)) {
+            return {};
+        }
+        return result;
+    }
+}
+
+/*!
+    \internal
+    \class QKnxCryptographicEnginePrivate
+
+    \brief The QKnxCryptographicEnginePrivate class implements the KNXnet/IP
+    secure CCM primitives on top of a reusable QKnxSslCipherContext.
+
+    Callers that keep a context for the lifetime of a session key, such as a
+    secure session, avoid setting up a new cipher for each block. All functions
+    work on caller supplied buffers.
+*/
+
+/*!
+    Writes the 16 byte block built from \a sequenceNumber, \a serialNumber,
+    \a messageTag and \a trailer into \a block. This is either the first block
+    B0 of the CBC-MAC input, or with \a trailer set to \c 0xff00 the first
+    counter block Ctr0. An empty \a serialNumber is replaced by zeros.
+*/
+void QKnxCryptographicEnginePrivate::counterBlock(quint8 *block, quint48 sequenceNumber,
+    QKnxByteArrayView serialNumber, quint16 messageTag, quint16 trailer)
+{
+    for (int i = 0; i < 6; ++i)
+        block[i] = quint8(sequenceNumber >> (8 * (5 - i)));
+    for (int i = 0; i < SerialNumberSize; ++i)
+        block[6 + i] = serialNumber.value(i, 0x00);
+    block[12] = quint8(messageTag >> 8);
+    block[13] = quint8(messageTag);
+    block[14] = quint8(trailer >> 8);
+    block[15] = quint8(trailer);
+}
+
+/*!
+    Encrypts or decrypts \a size bytes of a secure wrapper payload from \a in
+    into \a out using \a context, \a sequenceNumber, \a serialNumber and
+    \a messageTag. The buffers may be the same. Returns \c true on success;
+    otherwise returns \c false.
+*/
+bool QKnxCryptographicEnginePrivate::processPayload(QKnxSslCipherContext &context,
+    const quint8 *in, quint8 *out, int size, quint48 sequenceNumber,
+    QKnxByteArrayView serialNumber, quint16 messageTag)
+{
+    quint8 counter[QKnxSslCipherContext::BlockSize];
+    counterBlock(counter, sequenceNumber, serialNumber, messageTag, 0xff00);
+    counter[15] = quint8(counter[15] + 1); // the payload starts with Ctr1
+    return context.cryptCounter(counter, in, out, size);
+}
+
+/*!
+    Encrypts or decrypts the first \a size bytes of the message authentication
+    code in \a in into \a out using \a context, \a sequenceNumber,
+    \a serialNumber and \a messageTag. At most 16 bytes are processed. The
+    buffers may be the same. Returns \c true on success; otherwise returns
+    \c false.
+*/
+bool QKnxCryptographicEnginePrivate::processMac(QKnxSslCipherContext &context, const quint8 *in,
+    quint8 *out, int size, quint48 sequenceNumber, QKnxByteArrayView serialNumber,
+    quint16 messageTag)
+{
+    quint8 counter[QKnxSslCipherContext::BlockSize];
+    counterBlock(counter, sequenceNumber, serialNumber, messageTag, 0xff00);
+    return context.cryptCounter(counter, in, out, qMin(size, int(MacSize)));
+}
+
+/*!
+    Computes the unencrypted message authentication code for a frame with the
+    given \a header, \a id and \a data using \a context, \a sequenceNumber,
+    \a serialNumber and \a messageTag, and writes its 16 bytes into \a mac.
+    The CBC-MAC is computed in a single pass without assembling its input.
+
+    Returns \c true on success; otherwise returns \c false.
+
+    \sa QKnxCryptographicEngine::computeMessageAuthenticationCode()
+*/
+bool QKnxCryptographicEnginePrivate::computeMac(QKnxSslCipherContext &context,
+    const QKnxNetIpFrameHeader &header, quint16 id, QKnxByteArrayView data,
+    quint48 sequenceNumber, QKnxByteArrayView serialNumber, quint16 messageTag, quint8 *mac)
+{
+    if (!context.isValid() || !header.isValid())
+        return false;
+
+    quint8 headerBytes[QKnxNetIpFrameHeader::HeaderSize10];
+    if (header.serialize(headerBytes, sizeof(headerBytes)) != QKnxNetIpFrameHeader::HeaderSize10)
+        return false;
+
+    quint8 b0[QKnxSslCipherContext::BlockSize];
+    QKnxPrivate::CbcMac cbcMac(context);
+
+    switch (header.serviceType()) {
+    case QKnxNetIp::ServiceType::SecureWrapper:
+        if (data.size() == 0)
+            return false;
+        counterBlock(b0, sequenceNumber, serialNumber, messageTag, quint16(data.size()));
+        cbcMac.addData(b0, sizeof(b0));
+        cbcMac.addData(quint16(sizeof(headerBytes) + 2));
+        cbcMac.addData(headerBytes, sizeof(headerBytes));
+        cbcMac.addData(id);
+        cbcMac.addData(data.data(), data.size());
+        break;
+    case QKnxNetIp::ServiceType::SessionResponse:
+    case QKnxNetIp::ServiceType::SessionAuthenticate:
+        if (data.size() == 0)
+            return false;
+        counterBlock(b0, sequenceNumber, serialNumber, messageTag, 0);
+        cbcMac.addData(b0, sizeof(b0));
+        cbcMac.addData(quint16(sizeof(headerBytes) + 2 + data.size()));
+        cbcMac.addData(headerBytes, sizeof(headerBytes));
+        cbcMac.addData(id);
+        cbcMac.addData(data.data(), data.size());
+        break;
+    case QKnxNetIp::ServiceType::TimerNotify:
+        counterBlock(b0, sequenceNumber, serialNumber, messageTag, 0);
+        cbcMac.addData(b0, sizeof(b0));
+        cbcMac.addData(quint16(sizeof(headerBytes)));
+        cbcMac.addData(headerBytes, sizeof(headerBytes));
+        break;
+    default:
+        return false;
+    }
+    return cbcMac.result(mac);
+}
+
+namespace QKnxPrivate
+{
+    static void secureZero(void *data, size_t size)
+    {
+        // volatile keeps the compiler from removing the stores to dead memory
+        volatile quint8 *bytes = static_cast<volatile quint8 *> (data);
+        while (size--)
+            *bytes++ = 0x00;
+    }
+}
 
-        QKnxByteArray ctrArray;
-        for (int i = 0; i < (payload.size() + 15) >> 4; ++i) {
-            Ctr0.set(15, Ctr0.at(15) + 1);
-            ctrArray += QKnxSsl::doCrypt(key, { iv, 16 }, Ctr0, QKnxSsl::Encrypt).right(16);
+Q_GLOBAL_STATIC(QKnxKeyDerivationCache, qt_knxKeyDerivationCache)
+
+/*!
+    \internal
+    \class QKnxKeyDerivationCache
+
+    \brief The QKnxKeyDerivationCache class caches keys derived with PBKDF2.
+
+    Deriving a password hash runs 65536 iterations of HMAC-SHA256, which is
+    noticeable each time a secure session is set up. The cache keeps the most
+    recently derived keys, looked up by a SHA-256 hash over the salt and the
+    password, so the password itself is never stored. The number of entries
+    is bounded and evicted keys are overwritten with zeros.
+*/
+
+/*!
+    Destroys the cache and overwrites all cached keys with zeros.
+*/
+QKnxKeyDerivationCache::~QKnxKeyDerivationCache()
+{
+    clear();
+}
+
+/*!
+    Returns the process wide key derivation cache.
+*/
+QKnxKeyDerivationCache *QKnxKeyDerivationCache::instance()
+{
+    return qt_knxKeyDerivationCache();
+}
+
+/*!
+    Returns the 16 byte key derived from \a password and \a salt with
+    PBKDF2-HMAC-SHA256 and 65536 iterations. The key is taken from the cache
+    if it was derived before, otherwise it is derived and added to the cache.
+
+    The derivation runs without holding the cache lock, so several threads can
+    derive different keys at the same time.
+*/
+QKnxByteArray QKnxKeyDerivationCache::pbkdf2Sha256(const QByteArray &password,
+    const QByteArray &salt)
+{
+    QCryptographicHash hash(QCryptographicHash::Sha256);
+    hash.addData(salt);
+    hash.addData("\0", 1);
+    hash.addData(password);
+    const auto secretHash = hash.result();
+
+    {
+        QMutexLocker locker(&m_mutex);
+        for (int i = m_entries.size() - 1; i >= 0; --i) {
+            if (m_entries.at(i).secretHash != secretHash)
+                continue;
+            if (i != m_entries.size() - 1)
+                m_entries.move(i, m_entries.size() - 1); // mark as most recently used
+            return QKnxByteArray(m_entries.constLast().key, KeySize);
         }
+    }
 
-        return QKnxCryptographicEngine::XOR(ctrArray, payload, false);
+    auto key = QPasswordDigestor::deriveKeyPbkdf2(QCryptographicHash::Algorithm::Sha256,
+        password, salt, 0x10000, KeySize);
+    if (key.size() != KeySize)
+        return {};
+    const auto result = QKnxByteArray::fromByteArray(key);
+
+    QMutexLocker locker(&m_mutex);
+    if (m_capacity > 0) {
+        bool found = false;
+        for (const auto &entry : qAsConst(m_entries))
+            found |= (entry.secretHash == secretHash);
+
+        if (!found) {
+            evict(m_entries.size() - m_capacity + 1);
+            m_entries.append({ secretHash, {} });
+            memcpy(m_entries.last().key, key.constData(), KeySize);
+        }
     }
+    QKnxPrivate::secureZero(key.data(), size_t(key.size()));
+    return result;
+}
+
+/*!
+    Returns the maximum number of keys kept in the cache.
+*/
+int QKnxKeyDerivationCache::capacity() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_capacity;
+}
+
+/*!
+    Sets the maximum number of keys kept in the cache to \a capacity, evicting
+    the least recently used keys if needed. A \a capacity of \c 0 disables the
+    cache.
+*/
+void QKnxKeyDerivationCache::setCapacity(int capacity)
+{
+    QMutexLocker locker(&m_mutex);
+    m_capacity = qMax(0, capacity);
+    evict(m_entries.size() - m_capacity);
+}
+
+/*!
+    Returns the number of keys in the cache.
+*/
+int QKnxKeyDerivationCache::size() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_entries.size();
+}
+
+/*!
+    Removes all keys from the cache and overwrites them with zeros.
+*/
+void QKnxKeyDerivationCache::clear()
+{
+    QMutexLocker locker(&m_mutex);
+    evict(m_entries.size());
+}
+
+void QKnxKeyDerivationCache::evict(int count)
+{
+    count = qMin(count, m_entries.size());
+    if (count <= 0)
+        return;
+
+    for (int i = 0; i < count; ++i)
+        QKnxPrivate::secureZero(m_entries[i].key, KeySize);
+    m_entries.remove(0, count);
 }
 
 /*!
@@ -343,35 +645,13 @@ QKnxByteArray QKnxCryptographicEngine::computeMessageAuthenticationCode(const QK
     if (key.isEmpty() || !header.isValid())
         return {};
 
-    auto sn = (serialNumber.isEmpty() ? QKnxByteArray(6, 0x00) : serialNumber);
-
-    QKnxByteArray B0, B;
-    if (header.serviceType() == QKnxNetIp::ServiceType::SecureWrapper) {
-        if (data.isEmpty())
-            return {};
-
-        const auto A = header.bytes() + QKnxUtils::QUint16::bytes(id);
-        B0 = QKnxPrivate::b0(sequenceNumber, sn, messageTag, quint16(data.size()));
-        B = B0 + QKnxUtils::QUint16::bytes(quint16(A.size())) + A + data;
-    } else if (header.serviceType() == QKnxNetIp::ServiceType::SessionResponse
-        || header.serviceType() == QKnxNetIp::ServiceType::SessionAuthenticate) {
-            if (data.isEmpty())
-                return {};
-
-            const auto A = header.bytes() + QKnxUtils::QUint16::bytes(id);
-            B0 = QKnxPrivate::b0(sequenceNumber, sn, messageTag, 0);
-            B = B0 + QKnxUtils::QUint16::bytes(quint16(A.size() + data.size())) + A + data;
-    } else if (header.serviceType() == QKnxNetIp::ServiceType::TimerNotify) {
-        const auto A = header.bytes();
-        B0 = QKnxPrivate::b0(sequenceNumber, sn, messageTag, 0);
-        B = B0 + QKnxUtils::QUint16::bytes(quint16(A.size())) + A;
-    }
-
-    if (B.isEmpty())
+    QKnxSslCipherContext context(key);
+    QKnxByteArray mac(QKnxCryptographicEnginePrivate::MacSize, Qt::Uninitialized);
+    if (!QKnxCryptographicEnginePrivate::computeMac(context, header, id, data, sequenceNumber,
+        serialNumber, messageTag, mac.data())) {
         return {};
-    B.resize(B.size() + (16 - (B.size() % 16))); // pad to multiple of 16
-
-    return QKnxSsl::doCrypt(key, { QKnxPrivate::iv, 16 }, B, QKnxSsl::Encrypt).right(16);
+    }
+    return mac;
 }
 
 /*!
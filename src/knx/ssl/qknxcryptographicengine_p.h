@@ -0,0 +1,118 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtKnx module.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#ifndef QKNXCRYPTOGRAPHICENGINE_P_H
+#define QKNXCRYPTOGRAPHICENGINE_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt KNX API.  It exists for the convenience
+// of the Qt KNX implementation.  This header file may change from version
+// to version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtCore/qmutex.h>
+#include <QtCore/qvector.h>
+
+#include <QtKnx/qknxbytearrayview.h>
+#include <QtKnx/qknxnetipframeheader.h>
+#include <QtKnx/qtknxglobal.h>
+#include <QtKnx/private/qknxssl_p.h>
+
+QT_BEGIN_NAMESPACE
+
+class Q_AUTOTEST_EXPORT QKnxCryptographicEnginePrivate final
+{
+public:
+    enum : int { MacSize = 16, SerialNumberSize = 6 };
+
+    static void counterBlock(quint8 *block, quint48 sequenceNumber, QKnxByteArrayView serialNumber,
+        quint16 messageTag, quint16 trailer);
+
+    static bool processPayload(QKnxSslCipherContext &context, const quint8 *in, quint8 *out,
+        int size, quint48 sequenceNumber, QKnxByteArrayView serialNumber, quint16 messageTag);
+    static bool processMac(QKnxSslCipherContext &context, const quint8 *in, quint8 *out,
+        int size, quint48 sequenceNumber, QKnxByteArrayView serialNumber, quint16 messageTag);
+
+    static bool computeMac(QKnxSslCipherContext &context, const QKnxNetIpFrameHeader &header,
+        quint16 id, QKnxByteArrayView data, quint48 sequenceNumber, QKnxByteArrayView serialNumber,
+        quint16 messageTag, quint8 *mac);
+};
+
+class Q_AUTOTEST_EXPORT QKnxKeyDerivationCache final
+{
+public:
+    enum : int { DefaultCapacity = 32, KeySize = 16 };
+
+    QKnxKeyDerivationCache() = default;
+    ~QKnxKeyDerivationCache();
+
+    static QKnxKeyDerivationCache *instance();
+
+    QKnxByteArray pbkdf2Sha256(const QByteArray &password, const QByteArray &salt);
+
+    int capacity() const;
+    void setCapacity(int capacity);
+
+    int size() const;
+    void clear();
+
+private:
+    Q_DISABLE_COPY(QKnxKeyDerivationCache)
+
+    struct Entry
+    {
+        QByteArray secretHash;
+        quint8 key[KeySize];
+    };
+    void evict(int count);
+
+    mutable QMutex m_mutex;
+    QVector<Entry> m_entries; // least recently used first
+    int m_capacity { DefaultCapacity };
+};
+
+QT_END_NAMESPACE
+
+#endif
@@ -38,6 +38,8 @@
 
 #include <QtCore/qmutex.h>
 
+#include <string.h>
+
 QT_BEGIN_NAMESPACE
 
 class QKnxOpenSsl
@@ -176,4 +178,160 @@ QKnxByteArray QKnxSsl::doCrypt(const QKnxByteArray &key, const QKnxByteArray &iv
 #endif
 }
 
+/*!
+    \internal
+    \class QKnxSslCipherContext
+
+    \brief The QKnxSslCipherContext class keeps a keyed AES-128 cipher context
+    alive, so it can be reused for any number of operations with the same key.
+
+    KNXnet/IP secure frames are encrypted in counter (CTR) mode and
+    authenticated with a CBC-MAC, both of which are built on single block
+    encryptions. QKnxSslCipherContext sets up the key schedule once, while
+    doCrypt() creates and frees a new context for every call. All operations
+    write into caller supplied buffers and do not allocate.
+*/
+
+/*!
+    Creates a cipher context for the given \a key.
+
+    \sa setKey()
+*/
+QKnxSslCipherContext::QKnxSslCipherContext(const QKnxByteArray &key)
+{
+    setKey(key);
+}
+
+/*!
+    Destroys the cipher context and frees the underlying OpenSSL context.
+*/
+QKnxSslCipherContext::~QKnxSslCipherContext()
+{
+    reset();
+}
+
+/*!
+    Move-constructs a cipher context from \a other.
+*/
+QKnxSslCipherContext::QKnxSslCipherContext(QKnxSslCipherContext &&other) Q_DECL_NOTHROW
+    : m_ctx(other.m_ctx)
+    , m_key(std::move(other.m_key))
+{
+    other.m_ctx = nullptr;
+    other.m_key = {};
+}
+
+/*!
+    Move-assigns \a other to this cipher context.
+*/
+QKnxSslCipherContext &QKnxSslCipherContext::operator=(QKnxSslCipherContext &&other) Q_DECL_NOTHROW
+{
+    qSwap(m_ctx, other.m_ctx);
+    qSwap(m_key, other.m_key);
+    return *this;
+}
+
+/*!
+    Sets up the context for the AES-128 \a key. Returns \c true on success;
+    otherwise returns \c false and the context becomes invalid. Nothing is
+    done if the context is already set up for the same key.
+*/
+bool QKnxSslCipherContext::setKey(const QKnxByteArray &key)
+{
+    if (isValid() && m_key == key)
+        return true;
+    reset();
+
+#if QT_CONFIG(opensslv11)
+    if (key.size() != KeySize || !qt_QKnxOpenSsl->supportsSsl())
+        return false;
+
+    auto ctx = QKnxPrivate::q_EVP_CIPHER_CTX_new();
+    if (!ctx)
+        return false;
+
+    if (QKnxPrivate::q_EVP_CipherInit_ex(ctx, QKnxPrivate::q_EVP_aes_128_ecb(), nullptr,
+        key.constData(), nullptr, QKnxSsl::Encrypt) <= 0
+        || QKnxPrivate::q_EVP_CIPHER_CTX_set_padding(ctx, 0) <= 0) {
+        QKnxPrivate::q_EVP_CIPHER_CTX_free(ctx);
+        return false;
+    }
+
+    m_ctx = ctx;
+    m_key = key;
+    return true;
+#else
+    Q_UNUSED(key)
+    return false;
+#endif
+}
+
+/*!
+    Frees the underlying OpenSSL context and forgets the key.
+*/
+void QKnxSslCipherContext::reset()
+{
+#if QT_CONFIG(opensslv11)
+    if (m_ctx)
+        QKnxPrivate::q_EVP_CIPHER_CTX_free(m_ctx);
+#endif
+    m_ctx = nullptr;
+    m_key = {};
+}
+
+/*!
+    Encrypts \a blocks blocks of 16 bytes from \a in into \a out. The buffers
+    may be the same. Returns \c true on success; otherwise returns \c false.
+*/
+bool QKnxSslCipherContext::encryptBlocks(const quint8 *in, quint8 *out, int blocks)
+{
+#if QT_CONFIG(opensslv11)
+    if (!m_ctx || blocks < 0)
+        return false;
+
+    int outl = 0;
+    return QKnxPrivate::q_EVP_CipherUpdate(m_ctx, out, &outl, in, blocks * BlockSize) > 0
+        && outl == blocks * BlockSize;
+#else
+    Q_UNUSED(in)
+    Q_UNUSED(out)
+    Q_UNUSED(blocks)
+    return false;
+#endif
+}
+
+/*!
+    Encrypts or decrypts \a size bytes from \a in into \a out in counter mode,
+    starting with the 16 byte counter block \a counter. As specified for
+    KNXnet/IP secure, only the last byte of the counter block is incremented
+    for each following block. The buffers may be the same. Returns \c true on
+    success; otherwise returns \c false.
+*/
+bool QKnxSslCipherContext::cryptCounter(const quint8 *counter, const quint8 *in, quint8 *out,
+    int size)
+{
+    if (!m_ctx || size < 0)
+        return false;
+
+    enum : int { ChunkBlocks = 16 };
+    quint8 keyStream[ChunkBlocks * BlockSize];
+
+    quint8 next = counter[BlockSize - 1];
+    for (int offset = 0; offset < size;) {
+        const int blocks = qMin(int(ChunkBlocks), (size - offset + BlockSize - 1) / BlockSize);
+        for (int i = 0; i < blocks; ++i) {
+            memcpy(keyStream + i * BlockSize, counter, BlockSize - 1);
+            keyStream[i * BlockSize + BlockSize - 1] = next++;
+        }
+        if (!encryptBlocks(keyStream, keyStream, blocks))
+            return false;
+
+        const int count = qMin(size - offset, blocks * BlockSize);
+        for (int i = 0; i < count; ++i)
+            out[offset + i] = in[offset + i] ^ keyStream[i];
+        offset += count;
+    }
+    return true;
+}
+
 QT_END_NAMESPACE
@@ -61,6 +61,36 @@ public:
         const QKnxByteArray &data, Mode mode);
 };
 
+struct evp_cipher_ctx_st;
+
+class Q_AUTOTEST_EXPORT QKnxSslCipherContext final
+{
+public:
+    enum : int { BlockSize = 16, KeySize = 16 };
+
+    QKnxSslCipherContext() = default;
+    explicit QKnxSslCipherContext(const QKnxByteArray &key);
+    ~QKnxSslCipherContext();
+
+    QKnxSslCipherContext(QKnxSslCipherContext &&other) Q_DECL_NOTHROW;
+    QKnxSslCipherContext &operator=(QKnxSslCipherContext &&other) Q_DECL_NOTHROW;
+
+    bool isValid() const { return m_ctx != nullptr; }
+    const QKnxByteArray &key() const { return m_key; }
+
+    bool setKey(const QKnxByteArray &key);
+    void reset();
+
+    bool encryptBlocks(const quint8 *in, quint8 *out, int blocks);
+    bool cryptCounter(const quint8 *counter, const quint8 *in, quint8 *out, int size);
+
+private:
+    Q_DISABLE_COPY(QKnxSslCipherContext)
+
+    evp_cipher_ctx_st *m_ctx { nullptr };
+    QKnxByteArray m_key;
+};
+
 QT_END_NAMESPACE
 
 #endif
@@ -580,6 +580,7 @@ DEFINEFUNC(void, PKCS12_free, PKCS12 *pkcs12, pkcs12, return, DUMMYARG)
     DEFINEFUNC3(int, EVP_CipherFinal_ex, EVP_CIPHER_CTX *ctx, ctx, unsigned char *outm, outm, int *outl, outl, return 0, return)
 
     DEFINEFUNC(const EVP_CIPHER *, EVP_aes_128_cbc, DUMMYARG, DUMMYARG, return nullptr, return)
+    DEFINEFUNC(const EVP_CIPHER *, EVP_aes_128_ecb, DUMMYARG, DUMMYARG, return nullptr, return)
     DEFINEFUNC2(int, EVP_CIPHER_CTX_set_padding, EVP_CIPHER_CTX *x, x, int padding, padding, return 0, return)
 
     DEFINEFUNC(const EVP_MD *, EVP_sha256, DUMMYARG, DUMMYARG, return nullptr, return)
@@ -1322,6 +1323,7 @@ bool q_resolveOpenSslSymbols()
     RESOLVEFUNC(EVP_CipherFinal_ex)
 
     RESOLVEFUNC(EVP_aes_128_cbc)
+    RESOLVEFUNC(EVP_aes_128_ecb)
     RESOLVEFUNC(EVP_CIPHER_CTX_set_padding)
 
     RESOLVEFUNC(EVP_sha256)
@@ -1,6 +1,7 @@
 HEADERS += ssl/qknxcryptographicengine.h \
            ssl/qknxsecurekey.h \
            ssl/qknxssl_p.h \
+           ssl/qknxcryptographicengine_p.h \
            ssl/qknxkeyring_p.h
 
 SOURCES += ssl/qknxcryptographicengine.cpp \
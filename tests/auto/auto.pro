@@ -38,6 +38,7 @@ SUBDIRS += cmake \
     qknxdatapointtype \
     qknxproject \
     qknxgroupaddressinfo \
+    qknxgroupaddressfiltertable \
     qknxbytearray \
     qknxnetiptunnelingfeature \
     qknxnetiptunnelinginfodib \
@@ -47,4 +48,7 @@ SUBDIRS += cmake \
     qknxnetipsessionrequest \
     qknxnetipsessionresponse \
     qknxnetiprouter \
+    qknxnetiptunnel \
+    qknxnetipsecureconfiguration \
+    qknxnetipframereassembler \
     qknxcryptographicengine
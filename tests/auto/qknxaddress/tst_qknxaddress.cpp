@@ -27,6 +27,8 @@
 ******************************************************************************/
 
 #include <QtCore/qdebug.h>
+#include <QtCore/qset.h>
+#include <QtCore/qvector.h>
 #include <QtKnx/qknxaddress.h>
 #include <QtTest/qtest.h>
 
@@ -61,6 +63,7 @@ private slots:
         QCOMPARE(address.isValid(), false);
         QCOMPARE(address.toString(), QStringLiteral(""));
         QCOMPARE(address.bytes(), QKnxByteArray {});
+        QCOMPARE(address.toUInt16(), quint16(0));
     }
 
     void testConstructorFromQuint16_data()
@@ -590,6 +593,48 @@ private slots:
          QCOMPARE(address, QKnxAddress(QKnxAddress::Type::Group, 0x0000));
          QCOMPARE(address == QKnxAddress(QKnxAddress::Type::Individual, 0x0000), false);
          QCOMPARE(address != QKnxAddress(QKnxAddress::Type::Individual, 0x0000), true);
+
+         QCOMPARE(QKnxAddress() < QKnxAddress(QKnxAddress::Type::Individual, 0xffff), true);
+         QCOMPARE(QKnxAddress(QKnxAddress::Type::Individual, 0xffff) < address, true);
+         QCOMPARE(address < QKnxAddress(QKnxAddress::Type::Group, 0x0001), true);
+         QCOMPARE(address < address, false);
+    }
+
+    void testValueType()
+    {
+        QVERIFY(std::is_trivially_copyable<QKnxAddress>::value);
+        QVERIFY(!QTypeInfo<QKnxAddress>::isComplex);
+
+        Q_CONSTEXPR QKnxAddress invalid;
+        Q_STATIC_ASSERT(!invalid.isValid());
+        Q_STATIC_ASSERT(invalid.toUInt16() == 0);
+
+        QVector<QKnxAddress> addresses(3);
+        for (const auto &address : qAsConst(addresses))
+            QCOMPARE(address.isValid(), false);
+
+        const QKnxAddress group(QKnxAddress::Type::Group, 0x0901);
+        QCOMPARE(group.toUInt16(), quint16(0x0901));
+        QCOMPARE(QKnxAddress(QKnxAddress::Type::Individual, 0x0901).toUInt16(), quint16(0x0901));
+
+        QCOMPARE(qHash(group), qHash(QKnxAddress(QKnxAddress::Type::Group, "1/1/1")));
+        QVERIFY(qHash(group) != qHash(QKnxAddress(QKnxAddress::Type::Individual, 0x0901)));
+    }
+
+    void benchmarkFilterTableLookup()
+    {
+        QSet<QKnxAddress> filterTable;
+        for (quint16 i = 0; i < 10000; ++i)
+            filterTable.insert({ QKnxAddress::Type::Group, quint16(i * 3) });
+
+        const QKnxAddress hit(QKnxAddress::Type::Group, 3 * 4711);
+        const QKnxAddress miss(QKnxAddress::Type::Group, 3 * 4711 + 1);
+
+        bool found = false;
+        QBENCHMARK {
+            found = filterTable.contains(hit) && !filterTable.contains(miss);
+        }
+        QVERIFY(found);
     }
 
     void testDebugStream()
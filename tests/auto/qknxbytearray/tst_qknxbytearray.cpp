@@ -30,6 +30,10 @@
 #include <QtTest/QtTest>
 
 #include <QtKnx/qknxbytearray.h>
+#include <QtKnx/qknxbytearrayview.h>
+#include <QtKnx/qknxlinklayerframebuilder.h>
+#include <QtKnx/qknxnetiptunnelingrequest.h>
+#include <QtKnx/qknxutils.h>
 
 class tst_QKnxByteArray : public QObject
 {
@@ -37,6 +41,9 @@ class tst_QKnxByteArray : public QObject
 
 private slots:
     void swap();
+    void move();
+    void inlineStorage();
+    void concatenateTemporaries();
     void startsWith_data();
     void startsWith();
     void startsWith_char();
@@ -58,6 +65,8 @@ private slots:
     void lastIndexOf();
     void toFromHex_data();
     void toFromHex();
+    void view();
+    void benchmarkBuildFrame();
 };
 
 void tst_QKnxByteArray::swap()
@@ -68,6 +77,110 @@ void tst_QKnxByteArray::swap()
     QCOMPARE(b2, QKnxByteArray("b1", 2));
 }
 
+void tst_QKnxByteArray::move()
+{
+    QKnxByteArray b1 { 0x01, 0x02, 0x03 };
+
+    QKnxByteArray b2(std::move(b1));
+    QCOMPARE(b2, QKnxByteArray({ 0x01, 0x02, 0x03 }));
+    QVERIFY(b1.isEmpty());
+
+    QKnxByteArray b3;
+    b3 = std::move(b2);
+    QCOMPARE(b3, QKnxByteArray({ 0x01, 0x02, 0x03 }));
+    QVERIFY(b2.isEmpty());
+
+    const QKnxByteArray reference(64, 0xaa);
+    QKnxByteArray b4(reference);
+    b4.set(0, 0x00);
+    const auto data = b4.constData();
+
+    QKnxByteArray b5(std::move(b4));
+    QCOMPARE(b5.constData(), data);
+    QVERIFY(b4.isEmpty());
+
+    QKnxByteArray b6;
+    b6 = std::move(b5);
+    QCOMPARE(b6.constData(), data);
+    QVERIFY(b5.isEmpty());
+    QCOMPARE(b6.mid(1), reference.mid(1));
+}
+
+void tst_QKnxByteArray::inlineStorage()
+{
+    QKnxByteArray ba;
+    for (int i = 0; i < 15; ++i)
+        ba.append(quint8(i));
+
+    auto object = reinterpret_cast<const quint8 *> (&ba);
+    QVERIFY(ba.constData() >= object && ba.constData() < object + sizeof(QKnxByteArray));
+    QCOMPARE(ba.constData()[ba.size()], quint8(0x00));
+
+    ba.append(quint8(15));
+    QCOMPARE(ba.size(), 16);
+    QVERIFY(ba.constData() < object || ba.constData() >= object + sizeof(QKnxByteArray));
+    QCOMPARE(ba.constData()[ba.size()], quint8(0x00));
+    for (int i = 0; i < ba.size(); ++i)
+        QCOMPARE(ba.at(i), quint8(i));
+
+    QKnxByteArray copy(ba);
+    copy.set(0, 0xff);
+    QCOMPARE(ba.at(0), quint8(0x00));
+
+    ba.remove(0, 1);
+    QCOMPARE(ba.size(), 15);
+    QVERIFY(ba.constData() >= object && ba.constData() < object + sizeof(QKnxByteArray));
+    QCOMPARE(ba.constData()[ba.size()], quint8(0x00));
+    for (int i = 0; i < ba.size(); ++i)
+        QCOMPARE(ba.at(i), quint8(i + 1));
+
+    QCOMPARE(QKnxByteArray::fromByteArray(copy.toByteArray()), copy);
+    QCOMPARE(QKnxByteArray::fromByteArray(ba.toByteArray()), ba);
+    QVERIFY(QKnxByteArray::fromByteArray(QByteArray()).isNull());
+
+    ba.resize(40);
+    QCOMPARE(ba.size(), 40);
+    QCOMPARE(ba.at(14), quint8(15));
+    QCOMPARE(ba.at(39), quint8(0x00));
+
+    QKnxByteArray inlined { 0x01 }, spilled(20, 0x02);
+    inlined.swap(spilled);
+    QCOMPARE(inlined, QKnxByteArray(20, 0x02));
+    QCOMPARE(spilled, QKnxByteArray({ 0x01 }));
+    spilled = inlined;
+    QCOMPARE(spilled, inlined);
+
+    QKnxByteArray small { 0x01, 0x02, 0x03 };
+    const QByteArray &bytes = small.toByteArray();
+    QCOMPARE(bytes, QByteArray("\x01\x02\x03"));
+    QCOMPARE(&small.toByteArray(), &bytes);
+    small.set(0, 0xff);
+    QCOMPARE(small.toByteArray(), QByteArray("\xff\x02\x03"));
+    small.append(0x04);
+    QCOMPARE(small.toByteArray(), QByteArray("\xff\x02\x03\x04"));
+    const QKnxByteArray smallCopy(small);
+    QCOMPARE(smallCopy.toByteArray(), small.toByteArray());
+    QVERIFY(&smallCopy.toByteArray() != &small.toByteArray());
+    QVERIFY(QKnxByteArray().toByteArray().isNull());
+
+    const auto view = small.view();
+    QCOMPARE(view.constData(), small.constData());
+    QCOMPARE(view.size(), small.size());
+}
+
+void tst_QKnxByteArray::concatenateTemporaries()
+{
+    const QKnxByteArray b1 { 0x01 }, b2 { 0x02, 0x03 }, b3 { 0x04 };
+    const auto result = b1 + b2 + b3 + quint8(0x05);
+    QCOMPARE(result, QKnxByteArray({ 0x01, 0x02, 0x03, 0x04, 0x05 }));
+    QCOMPARE(b1, QKnxByteArray({ 0x01 }));
+
+    QKnxByteArray tmp { 0x06 };
+    const QKnxByteArray moved = std::move(tmp) + quint8(0x07);
+    QCOMPARE(moved, QKnxByteArray({ 0x06, 0x07 }));
+    QVERIFY(tmp.isEmpty());
+}
+
 void tst_QKnxByteArray::startsWith_data()
 {
     QTest::addColumn<QKnxByteArray>("ba");
@@ -580,6 +693,60 @@ void tst_QKnxByteArray::toFromHex()
     QCOMPARE(QKnxByteArray::fromHex(hex_alt1), str);
 }
 
+void tst_QKnxByteArray::view()
+{
+    QKnxByteArrayView null;
+    QVERIFY(null.isNull());
+    QVERIFY(null.isEmpty());
+    QCOMPARE(null.toByteArray(), QKnxByteArray());
+
+    const QKnxByteArray bytes { 0x06, 0x10, 0x05, 0x30, 0x00, 0x08, 0x01, 0x02 };
+    const QKnxByteArrayView view(bytes);
+    QCOMPARE(view.size(), bytes.size());
+    QCOMPARE(view.constData(), bytes.constData());
+    QVERIFY(view == bytes);
+
+    QCOMPARE(view.left(2).constData(), bytes.constData());
+    QCOMPARE(view.left(2).toByteArray(), bytes.left(2));
+    QCOMPARE(view.left(-1).size(), 0);
+    QCOMPARE(view.left(100).size(), bytes.size());
+
+    QCOMPARE(view.right(2).constData(), bytes.constData() + 6);
+    QCOMPARE(view.right(2).toByteArray(), bytes.right(2));
+    QCOMPARE(view.right(100).size(), bytes.size());
+
+    QCOMPARE(view.mid(6).constData(), bytes.constData() + 6);
+    QCOMPARE(view.mid(6).toByteArray(), bytes.mid(6));
+    QCOMPARE(view.mid(2, 2).toByteArray(), bytes.mid(2, 2));
+    QCOMPARE(view.mid(2, 100).toByteArray(), bytes.mid(2, 100));
+    QVERIFY(view.mid(8).isEmpty());
+    QVERIFY(view.mid(-1).isEmpty());
+
+    QCOMPARE(view.value(7), quint8(0x02));
+    QCOMPARE(view.value(8, 0xff), quint8(0xff));
+    QCOMPARE(QKnxUtils::QUint16::fromBytes(view, 4), quint16(0x0008));
+}
+
+void tst_QKnxByteArray::benchmarkBuildFrame()
+{
+    const auto cemi = QKnxLinkLayerFrame::builder()
+        .setMedium(QKnx::MediumType::NetIP)
+        .setData(QKnxByteArray::fromHex("1100bce0110a0a0b010080"))
+        .createFrame();
+    QVERIFY(cemi.isValid());
+
+    QKnxByteArray bytes;
+    QBENCHMARK {
+        bytes = QKnxNetIpTunnelingRequestProxy::builder()
+            .setChannelId(1)
+            .setSequenceNumber(0)
+            .setCemi(cemi)
+            .create()
+            .bytes();
+    }
+    QCOMPARE(bytes, QKnxByteArray::fromHex("06100420001504010000") + cemi.bytes());
+}
+
 //void tst_QKnxByteArray::compare_data()
 //{
 //    QTest::addColumn<QKnxByteArray>("str1");
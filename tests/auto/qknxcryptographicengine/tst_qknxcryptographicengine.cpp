@@ -36,6 +36,9 @@
 #include <QtKnx/qknxnetipsessionresponse.h>
 #include <QtKnx/qknxnetipsessionstatus.h>
 #include <QtKnx/qknxnetiptimernotify.h>
+#include <QtKnx/private/qknxcryptographicengine_p.h>
+#include <QtKnx/private/qknxnetipsecurewrappercodec_p.h>
+#include <QtKnx/private/qknxssl_p.h>
 #include <QtTest/qtest.h>
 
 QT_BEGIN_NAMESPACE
@@ -178,6 +181,40 @@ private slots:
         QCOMPARE(result, QKnxByteArray::fromHex("e158e4012047bd6cc41aafbc5c04c1fc"));
     }
 
+    void testKeyDerivationCache()
+    {
+        const QByteArray salt("user-password.1.secure.ip.knx.org");
+        const auto secret = QKnxByteArray::fromHex("03fcedb66660251ec81a1a716901696a");
+
+        QKnxKeyDerivationCache cache;
+        QCOMPARE(cache.capacity(), int(QKnxKeyDerivationCache::DefaultCapacity));
+        QCOMPARE(cache.size(), 0);
+
+        QCOMPARE(cache.pbkdf2Sha256("secret", salt), secret);
+        QCOMPARE(cache.size(), 1);
+        QCOMPARE(cache.pbkdf2Sha256("secret", salt), secret);
+        QCOMPARE(cache.size(), 1);
+
+        // the same password with another salt is another entry
+        QCOMPARE(cache.pbkdf2Sha256("trustme", "device-authentication-code.1.secure.ip.knx.org"),
+            QKnxByteArray::fromHex("e158e4012047bd6cc41aafbc5c04c1fc"));
+        QCOMPARE(cache.size(), 2);
+        cache.pbkdf2Sha256("secret", "device-authentication-code.1.secure.ip.knx.org");
+        QCOMPARE(cache.size(), 3);
+
+        cache.setCapacity(2);
+        QCOMPARE(cache.size(), 2);
+        QCOMPARE(cache.pbkdf2Sha256("secret", salt), secret); // evicted, derived again
+        QCOMPARE(cache.size(), 2);
+
+        cache.clear();
+        QCOMPARE(cache.size(), 0);
+
+        cache.setCapacity(0);
+        QCOMPARE(cache.pbkdf2Sha256("secret", salt), secret);
+        QCOMPARE(cache.size(), 0);
+    }
+
     void testMessageAuthenticationCode()
     {
         if (QKnxCryptographicEngine::sslLibraryVersionNumber() < 0x1010000fL)
@@ -514,6 +551,166 @@ private slots:
         QCOMPARE(proxy2.isValid(), true);
         QCOMPARE(proxy2.userId(), QKnxNetIp::SecureUserId::Management);
         QCOMPARE(proxy2.messageAuthenticationCode(), mac);
+
+        auto sessionAuth3 = QKnxNetIpSessionAuthenticateProxy::secureBuilder()
+            .setUserId(QKnxNetIp::SecureUserId::Management)
+            .setUserPasswordHash(QKnxCryptographicEngine::userPasswordHash(password))
+            .create(clientPublicKey, serverPublicKey);
+        QCOMPARE(sessionAuth3.bytes(), sessionAuth2.bytes());
+
+        // no password hash, or a user ID that is not valid
+        auto sessionAuth4 = QKnxNetIpSessionAuthenticateProxy::secureBuilder()
+            .setUserId(QKnxNetIp::SecureUserId::Management)
+            .create(clientPublicKey, serverPublicKey);
+        QCOMPARE(QKnxNetIpSessionAuthenticateProxy(sessionAuth4).isValid(), false);
+
+        auto sessionAuth5 = QKnxNetIpSessionAuthenticateProxy::secureBuilder()
+            .setUserId(QKnxNetIp::SecureUserId::Reserved)
+            .setUserPasswordHash(QKnxCryptographicEngine::userPasswordHash(password))
+            .create(clientPublicKey, serverPublicKey);
+        QCOMPARE(QKnxNetIpSessionAuthenticateProxy(sessionAuth5).isValid(), false);
+    }
+
+    void testCipherContext()
+    {
+        QKnxSslCipherContext context;
+        QCOMPARE(context.isValid(), false);
+        QCOMPARE(context.setKey(QKnxByteArray(15, 0x00)), false);
+        QCOMPARE(context.isValid(), false);
+
+        if (QKnxCryptographicEngine::sslLibraryVersionNumber() < 0x1010000fL)
+            return;
+
+        // FIPS-197, appendix C.1
+        const auto key = QKnxByteArray::fromHex("000102030405060708090a0b0c0d0e0f");
+        QCOMPARE(context.setKey(key), true);
+        QCOMPARE(context.isValid(), true);
+        QCOMPARE(context.key(), key);
+
+        auto block = QKnxByteArray::fromHex("00112233445566778899aabbccddeeff");
+        QCOMPARE(context.encryptBlocks(block.constData(), block.data(), 1), true);
+        QCOMPARE(block, QKnxByteArray::fromHex("69c4e0d86a7b0430d8cdb78070b4c55a"));
+
+        // more than one chunk of counter blocks, and a partial last block
+        QKnxByteArray payload(300, Qt::Uninitialized);
+        for (int i = 0; i < payload.size(); ++i)
+            payload.set(i, quint8(i));
+
+        auto counter = QKnxByteArray::fromHex("00000000000000fa123456780000ff01");
+        QKnxByteArray keyStream;
+        for (int i = 0; i < (payload.size() + 15) / 16; ++i) {
+            auto ctr = counter;
+            ctr.set(15, quint8(ctr.at(15) + i));
+            QCOMPARE(context.encryptBlocks(ctr.constData(), ctr.data(), 1), true);
+            keyStream += ctr;
+        }
+
+        auto encrypted = payload;
+        auto data = encrypted.data();
+        QCOMPARE(context.cryptCounter(counter.constData(), data, data, encrypted.size()), true);
+        QCOMPARE(encrypted, QKnxCryptographicEngine::XOR(keyStream, payload, false));
+
+        QCOMPARE(context.cryptCounter(counter.constData(), data, data, encrypted.size()), true);
+        QCOMPARE(encrypted, payload);
+
+        QKnxSslCipherContext moved(std::move(context));
+        QCOMPARE(moved.isValid(), true);
+        QCOMPARE(context.isValid(), false);
+
+        moved.reset();
+        QCOMPARE(moved.isValid(), false);
+        QCOMPARE(moved.key(), QKnxByteArray());
+    }
+
+    void testSecureWrapperPayloadInPlace()
+    {
+        if (QKnxCryptographicEngine::sslLibraryVersionNumber() < 0x1010000fL)
+            return;
+
+        const auto sessionKey = QKnxByteArray::fromHex("289426c2912535ba98279a4d1843c487");
+        const auto serialNumber = QKnxByteArray::fromHex("00fa12345678");
+        const quint48 sequenceNumber = 0;
+        const quint16 messageTag = 0xaffe;
+
+        const auto payload = QKnxByteArray::fromHex("06100531001229000bc00002000f0100");
+        const auto expected = QKnxCryptographicEngine::decryptSecureWrapperPayload(sessionKey,
+            payload, sequenceNumber, serialNumber, messageTag);
+
+        QKnxSslCipherContext context(sessionKey);
+        auto bytes = payload;
+        auto data = bytes.data();
+        QCOMPARE(QKnxCryptographicEnginePrivate::processPayload(context, data, data, bytes.size(),
+            sequenceNumber, serialNumber, messageTag), true);
+        QCOMPARE(bytes, expected);
+
+        const auto mac = QKnxByteArray::fromHex("3ef3df0eb8e3a7e1d7a45d0e4fbb3a2b");
+        quint8 encMac[QKnxCryptographicEnginePrivate::MacSize];
+        QCOMPARE(QKnxCryptographicEnginePrivate::processMac(context, mac.constData(), encMac,
+            sizeof(encMac), sequenceNumber, serialNumber, messageTag), true);
+        QCOMPARE(QKnxByteArray(encMac, sizeof(encMac)), QKnxCryptographicEngine
+            ::encryptMessageAuthenticationCode(sessionKey, mac, sequenceNumber, serialNumber,
+            messageTag));
+    }
+
+    void testSecureWrapperCodec()
+    {
+        if (QKnxCryptographicEngine::sslLibraryVersionNumber() < 0x1010000fL)
+            return;
+
+        auto sessionAuthenticate = QKnxNetIpSessionAuthenticateProxy::builder()
+            .setUserId(QKnxNetIp::SecureUserId::Management)
+            .setMessageAuthenticationCode(QKnxByteArray::fromHex("1f1d59ea9f12a152e5d9727f08462cde"))
+            .create();
+
+        auto serialNumber = QKnxByteArray::fromHex("00fa12345678");
+        QKnxNetIpSecureWrapperCodec::SecurityInfo info;
+        info.sessionId = 0x0001;
+        info.sequenceNumber = 0x000000000000;
+        info.serialNumber = serialNumber;
+        info.messageTag = 0xaffe;
+
+        QKnxSslCipherContext context(QKnxByteArray::fromHex("289426c2912535ba98279a4d1843c487"));
+
+        const int size = QKnxNetIpSecureWrapperCodec::encodedSize(sessionAuthenticate);
+        QKnxByteArray bytes(size, 0x00);
+        QCOMPARE(QKnxNetIpSecureWrapperCodec::encode(context, sessionAuthenticate, info,
+            bytes.data(), size - 1), 0);
+        QCOMPARE(QKnxNetIpSecureWrapperCodec::encode(context, sessionAuthenticate, info,
+            bytes.data(), size), size);
+
+        const QKnxNetIpSecureWrapperProxy proxy(QKnxNetIpFrame::fromBytes(bytes));
+        QCOMPARE(proxy.isValid(), true);
+        QCOMPARE(proxy.secureSessionId(), info.sessionId);
+        QCOMPARE(proxy.sequenceNumber(), info.sequenceNumber);
+        QCOMPARE(proxy.serialNumber(), serialNumber);
+        QCOMPARE(proxy.messageTag(), info.messageTag);
+        QCOMPARE(proxy.messageAuthenticationCode(),
+            QKnxByteArray::fromHex("52dba8e7e4bd80bd7d868a3ae78749de"));
+        QCOMPARE(proxy.encapsulatedFrame(),
+            QKnxByteArray::fromHex("7915a4f36e6e4208d28b4a207d8f35c0d138c26a7b5e7169"));
+
+        auto tampered = bytes;
+        tampered.set(size - 1, quint8(tampered.at(size - 1) ^ 0x01));
+        QCOMPARE(QKnxNetIpSecureWrapperCodec::decode(context, tampered.data(), size).isEmpty(),
+            true);
+
+        // decrypting into a separate buffer leaves the datagram untouched
+        const auto datagram = bytes;
+        QKnxByteArray plain(size - QKnxNetIpSecureWrapperCodec::Overhead, 0x00);
+        QCOMPARE(QKnxNetIpSecureWrapperCodec::decode(context, datagram, plain.data(),
+            plain.size() - 1).isEmpty(), true);
+        QCOMPARE(QKnxNetIpSecureWrapperCodec::decode(context, datagram, plain.data(),
+            plain.size()).toByteArray(), sessionAuthenticate.bytes());
+        QCOMPARE(datagram, bytes);
+
+        QKnxNetIpSecureWrapperCodec::SecurityInfo decodedInfo;
+        const auto decoded = QKnxNetIpSecureWrapperCodec::decode(context, bytes.data(), size,
+            &decodedInfo);
+        QCOMPARE(decoded.toByteArray(), sessionAuthenticate.bytes());
+        QCOMPARE(decodedInfo.sessionId, info.sessionId);
+        QCOMPARE(decodedInfo.sequenceNumber, info.sequenceNumber);
+        QCOMPARE(decodedInfo.serialNumber.toByteArray(), serialNumber);
+        QCOMPARE(decodedInfo.messageTag, info.messageTag);
     }
 };
 
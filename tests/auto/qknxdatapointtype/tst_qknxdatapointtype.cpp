@@ -46,6 +46,7 @@
 #include <QtKnx/qknxchar.h>
 #include <QtKnx/qknxcharstring.h>
 #include <QtKnx/qknxdatapointtype.h>
+#include <QtKnx/qknxdatapointtypecodec.h>
 #include <QtKnx/qknxdatapointtypefactory.h>
 #include <QtKnx/qknxdatetime.h>
 #include <QtKnx/qknxelectricalenergy.h>
@@ -56,14 +57,22 @@
 #include <QtKnx/qknxutf8string.h>
 #include <QtKnx/qknxvarstring.h>
 #include <QtKnx/qknxutils.h>
+#include <QtCore/qmath.h>
+#include <QtCore/qrandom.h>
 #include <QtTest/qtest.h>
 
+#include <cstring>
+
 class tst_QKnxDatapointType : public QObject
 {
     Q_OBJECT
 
 private slots:
     void datapointType();
+    void datapointTypeMetaData();
+    void datapointTypeFactory();
+    void datapointTypeCodec();
+    void datapointTypeDescriptor();
     void dpt1_1Bit();
     void dpt2_1BitControlled();
     void dpt3_3BitControlled();
@@ -74,6 +83,7 @@ private slots:
     void dpt7_2ByteUnsignedValue();
     void dpt8_2ByteSignedValue();
     void dpt9_2ByteFloat();
+    void dpt9_2ByteFloatCodec();
     void dpt10_TimeOfDay();
     void dpt11_Date();
     void dpt12_4ByteUnsignedValue();
@@ -117,6 +127,214 @@ void tst_QKnxDatapointType::datapointType()
     QCOMPARE(type.type(), QKnxDatapointType::Type::DptColourRGB);
 }
 
+void tst_QKnxDatapointType::datapointTypeMetaData()
+{
+    QKnxTemperatureCelsius first(21.5f);
+    QKnxTemperatureCelsius second(-4.f);
+    QCOMPARE(first.unit(), second.unit());
+    QCOMPARE(first.description(), second.description());
+    QCOMPARE(first.minimum(), second.minimum());
+    QCOMPARE(first.maximum(), second.maximum());
+    QCOMPARE(first.minimumText(), second.minimumText());
+    QCOMPARE(first.maximumText(), second.maximumText());
+    QVERIFY(first != second);
+
+    second.setValue(21.5f);
+    QCOMPARE(first, second);
+
+    second.setUnit(QStringLiteral("K"));
+    second.setRange(QVariant::fromValue(0), QVariant::fromValue(1));
+    QCOMPARE(second.unit(), QStringLiteral("K"));
+    QCOMPARE(second.minimum(), QVariant::fromValue(0));
+    QCOMPARE(second.maximum(), QVariant::fromValue(1));
+    QVERIFY(first != second);
+
+    // changing one instance must not leak into others of the same type
+    QCOMPARE(first.unit(), QKnxTemperatureCelsius().unit());
+    QCOMPARE(first.minimum(), QVariant::fromValue(-273));
+    QCOMPARE(QKnxTemperatureCelsius().maximum(), QVariant::fromValue(670760));
+
+    second.setUnit(first.unit());
+    second.setRange(first.minimum(), first.maximum());
+    QCOMPARE(first, second);
+
+    // instances created after a change still get the metadata of their type
+    first.setDescription(QStringLiteral("Inside"));
+    QCOMPARE(QKnxTemperatureCelsius().description(), second.description());
+    first.setDescription(second.description());
+
+    QKnxDatapointType copy = first;
+    copy.setDescription(QStringLiteral("Outside"));
+    QCOMPARE(copy.description(), QStringLiteral("Outside"));
+    QCOMPARE(first.description(), QKnxTemperatureCelsius().description());
+    QCOMPARE(copy.unit(), first.unit());
+
+    QCOMPARE(QKnxDatapointType::toType(QStringLiteral("DPST-9-1")),
+        QKnxDatapointType::Type::DptTemperatureCelsius);
+    QCOMPARE(QKnxDatapointType::toType(QStringLiteral("dpt-9")),
+        QKnxDatapointType::Type::Dpt9_2ByteFloat);
+    QCOMPARE(QKnxDatapointType::toType(QStringLiteral("DPT-9-")),
+        QKnxDatapointType::Type::Unknown);
+}
+
+void tst_QKnxDatapointType::datapointTypeFactory()
+{
+    auto &factory = QKnxDatapointTypeFactory::instance();
+
+    QCOMPARE(factory.typeSize(9), 2);
+    QCOMPARE(factory.typeSize(29), 8);
+    QCOMPARE(factory.typeSize(-1), 0);
+    QCOMPARE(factory.typeSize(0x10000), 0);
+
+    const auto mainTypes = factory.mainTypes();
+    QVERIFY(mainTypes.contains(1));
+    QVERIFY(mainTypes.contains(29));
+    for (int i = 1; i < mainTypes.size(); ++i)
+        QVERIFY(mainTypes.at(i - 1) < mainTypes.at(i));
+    QCOMPARE(factory.containsMainType(9), true);
+    QCOMPARE(factory.containsMainType(0), false);
+    QCOMPARE(factory.containsMainType(-9), false);
+
+    const auto subTypes = factory.subTypes(9);
+    QVERIFY(subTypes.contains(0));
+    QVERIFY(subTypes.contains(1));
+    QVERIFY(!subTypes.contains(900001));
+    QCOMPARE(factory.subTypes(-1), QList<int>());
+    QCOMPARE(factory.containsSubType(9, 1), true);
+    QCOMPARE(factory.containsSubType(9, 0x10001), false);
+
+    QScopedPointer<QKnxDatapointType> dpt(factory
+        .createType(QKnxDatapointType::Type::DptTemperatureCelsius));
+    QVERIFY(dpt);
+    QCOMPARE(dpt->mainType(), 9);
+    QCOMPARE(dpt->subType(), 1);
+    QCOMPARE(dpt->size(), 2);
+
+    // unknown sub types fall back to the main type
+    dpt.reset(factory.createType(9, 999));
+    QVERIFY(dpt);
+    QCOMPARE(dpt->type(), QKnxDatapointType::Type::Dpt9_2ByteFloat);
+
+    QCOMPARE(factory.createType(QKnxDatapointType::Type::Unknown), nullptr);
+    QCOMPARE(factory.createType(QKnxDatapointType::Type(99999)), nullptr);
+    QCOMPARE(factory.createType(-9, 1), nullptr);
+}
+
+void tst_QKnxDatapointType::datapointTypeCodec()
+{
+    bool ok = false;
+    const quint8 temperature[] = { 0x0c, 0x33 };
+    QCOMPARE(QKnxDatapointTypeCodec::decode<QKnx2ByteFloat>({ temperature, 2 }, &ok), 21.5f);
+    QCOMPARE(ok, true);
+    QCOMPARE(QKnxDatapointTypeCodec::decode<QKnx2ByteFloat>({ temperature, 1 }, &ok), 0.f);
+    QCOMPARE(ok, false);
+
+    quint8 encoded[4] = {};
+    QCOMPARE(QKnxDatapointTypeCodec::encode<QKnx2ByteFloat>(21.5f, encoded), true);
+    QCOMPARE(QKnxByteArray(encoded, 2), QKnxByteArray({ 0x0c, 0x33 }));
+    QCOMPARE(QKnxDatapointTypeCodec::encode<QKnx2ByteFloat>(670761.f, encoded), false);
+
+    for (float value : { -671088.64f, -5.2f, 0.f, 0.01f, 20.48f, 670760.96f }) {
+        QKnx2ByteFloat dpt(value);
+        QCOMPARE(QKnxDatapointTypeCodec::encode<QKnx2ByteFloat>(value, encoded), true);
+        QCOMPARE(QKnxByteArray(encoded, 2), dpt.bytes());
+        QCOMPARE(QKnxDatapointTypeCodec::decode<QKnx2ByteFloat>(dpt.bytes()), dpt.value());
+    }
+
+    QCOMPARE(QKnxDatapointTypeCodec::encode<QKnx4ByteFloat>(-1.5f, encoded), true);
+    QCOMPARE(QKnxDatapointTypeCodec::decode<QKnx4ByteFloat>({ encoded, 4 }), -1.5f);
+    QCOMPARE(QKnxDatapointTypeCodec::encode<QKnx4ByteSignedValue>(-2, encoded), true);
+    QCOMPARE(QKnxByteArray(encoded, 4), QKnxByteArray({ 0xff, 0xff, 0xff, 0xfe }));
+    QCOMPARE(QKnxDatapointTypeCodec::decode<QKnx4ByteSignedValue>({ encoded, 4 }), -2);
+    QCOMPARE(QKnxDatapointTypeCodec::decode<QKnx4ByteUnsignedValue>({ encoded, 4 }),
+        0xfffffffeu);
+    QCOMPARE(QKnxDatapointTypeCodec::decode<QKnx2ByteSignedValue>({ encoded, 2 }), qint16(-1));
+    QCOMPARE(QKnxDatapointTypeCodec::decode<QKnx8BitSignedValue>({ encoded, 1 }), qint8(-1));
+    QCOMPARE(QKnxDatapointTypeCodec::decode<QKnx8BitUnsignedValue>({ encoded, 1 }),
+        quint8(255));
+    QCOMPARE(QKnxDatapointTypeCodec::decode<QKnx1Bit>({ encoded, 1 }, &ok), true);
+    QCOMPARE(ok, false);
+
+    const quint8 scaling[] = { 0xff };
+    const quint8 counter[] = { 0x00, 0x00, 0x01, 0x00 };
+    const QKnxDatapointTypeCodec::Sample samples[] = {
+        { QKnxDatapointType::Type::DptTemperatureCelsius, { temperature, 2 } },
+        { QKnxDatapointType::Type::DptScaling, { scaling, 1 } },
+        { QKnxDatapointType::Type::DptScaling, { scaling, 1 } },
+        { QKnxDatapointType::Type::DptValue4Count, { counter, 4 } },
+        { QKnxDatapointType::Type::DptTemperatureCelsius, { temperature, 1 } },
+        { QKnxDatapointType::Type::DptDate, { counter, 3 } }
+    };
+
+    double values[6] = {};
+    bool valid[6] = {};
+    QCOMPARE(QKnxDatapointTypeCodec::decode(samples, 6, values, valid), 4);
+    QCOMPARE(values[0], double(21.5f));
+    QCOMPARE(values[1], QKnxScaling(100.).value());
+    QCOMPARE(values[2], 100.);
+    QCOMPARE(values[3], 256.);
+    QCOMPARE(values[4], 0.);
+    QCOMPARE(valid[4], false);
+    QCOMPARE(valid[5], false);
+
+    qint64 integers[6] = {};
+    QCOMPARE(QKnxDatapointTypeCodec::decode(samples, 6, integers, valid), 3);
+    QCOMPARE(valid[0], false);
+    QCOMPARE(integers[1], qint64(255));
+    QCOMPARE(integers[3], qint64(256));
+}
+
+void tst_QKnxDatapointType::datapointTypeDescriptor()
+{
+    static_assert(QKnxSwitch::descriptor().mainType == QKnx1Bit::MainType, "");
+    static_assert(QKnxSwitch::descriptor().subType == QKnxSwitch::SubType, "");
+    static_assert(QKnxScaling::descriptor().size == QKnx8BitUnsignedValue::TypeSize, "");
+    static_assert(QKnxScaling::descriptor().maximum == 100., "");
+    static_assert(QKnxPercentV8::descriptor().minimum == -128, "");
+    static_assert(QKnxTariff::descriptor().maximum == 254., "");
+    static_assert(QKnxTemperatureCelsius::descriptor().contains(21.5f), "");
+    static_assert(!QKnxTemperatureCelsius::descriptor().contains(-300.f), "");
+    static_assert(QKnxTemperatureCelsius::descriptor().bounded(-300.f) == -273.f, "");
+    static_assert(QKnxTimePeriod10Msec::descriptor().toEncoded(100.) == 10, "");
+    static_assert(QKnxDeltaTime100Msec::descriptor().toEncoded(-250.) == -3, "");
+
+    constexpr auto angle = QKnxAngle::descriptor();
+    QCOMPARE(angle.toEncoded(angle.toValue(128)), qint64(128));
+    QCOMPARE(angle.toValue(255), 360.);
+
+    auto check = [](const QKnxDatapointType &dpt, const auto &descriptor) {
+        QCOMPARE(dpt.mainType(), descriptor.mainType);
+        QCOMPARE(dpt.subType(), descriptor.subType);
+        QCOMPARE(dpt.size(), descriptor.size);
+        // the range variants keep their historic payload types, e.g. int or double
+        using ValueType = typename std::decay_t<decltype(descriptor)>::ValueType;
+        QCOMPARE(dpt.minimum().value<ValueType>(), descriptor.minimum);
+        QCOMPARE(dpt.maximum().value<ValueType>(), descriptor.maximum);
+        QCOMPARE(dpt.coefficient(), descriptor.coefficient);
+        QCOMPARE(dpt.unit(), QKnxDatapointType::tr(descriptor.unit));
+    };
+
+    check(QKnx1Bit(), QKnx1Bit::descriptor());
+    check(QKnxSwitch(), QKnxSwitch::descriptor());
+    check(QKnx8BitUnsignedValue(), QKnx8BitUnsignedValue::descriptor());
+    check(QKnxScaling(), QKnxScaling::descriptor());
+    check(QKnxTariff(), QKnxTariff::descriptor());
+    check(QKnx8BitSignedValue(), QKnx8BitSignedValue::descriptor());
+    check(QKnxValue1Count(), QKnxValue1Count::descriptor());
+    check(QKnx2ByteUnsignedValue(), QKnx2ByteUnsignedValue::descriptor());
+    check(QKnxTimePeriod100Msec(), QKnxTimePeriod100Msec::descriptor());
+    check(QKnx2ByteSignedValue(), QKnx2ByteSignedValue::descriptor());
+    check(QKnxPercentV16(), QKnxPercentV16::descriptor());
+    check(QKnx2ByteFloat(), QKnx2ByteFloat::descriptor());
+    check(QKnxTemperatureFahrenheit(), QKnxTemperatureFahrenheit::descriptor());
+
+    QCOMPARE(QKnxSwitch().maximum().metaType(), QMetaType::fromType<int>());
+    QCOMPARE(QKnxScaling().maximum().metaType(), QMetaType::fromType<int>());
+    QCOMPARE(QKnxTemperatureCelsius().minimum().metaType(), QMetaType::fromType<int>());
+    QCOMPARE(QKnxPercentV16().minimum().metaType(), QMetaType::fromType<double>());
+    QCOMPARE(QKnxPercentV16().minimum(), QVariant(-327.68));
+}
+
 void tst_QKnxDatapointType::dpt1_1Bit()
 {
     QKnx1Bit dpt1Bit;
@@ -215,6 +433,10 @@ void tst_QKnxDatapointType::dpt2_1BitControlled()
     QKnxSwitchControl sSwitchControlled(QKnxSwitchControl::State::Off, QKnxSwitchControl::Control::NoControl);
     QCOMPARE(sSwitchControlled.mainType(), 2);
     QCOMPARE(sSwitchControlled.subType(), 0x01);
+    QCOMPARE(sSwitchControlled.minimumText(), QString("No control, Off"));
+    QCOMPARE(sSwitchControlled.maximumText(), QString("Controlled, On"));
+    QCOMPARE(sSwitchControlled.description(), QString("Switch control"));
+    QCOMPARE(QKnxBoolControl().minimumText(), QString("No control, False"));
 
     // TODO: Extend.
 }
@@ -571,6 +793,103 @@ void tst_QKnxDatapointType::dpt9_2ByteFloat()
     // TODO: Extend the auto-test.
 }
 
+// The 2-byte float conversion as originally implemented by QKnx2ByteFloat, serves as reference.
+static float referenceDecode(quint16 temp)
+{
+    quint16 encodedM = (temp & 0x87ff);
+    if (encodedM > 2047)
+        encodedM += 0x7800;
+
+    qint16 M = qint16(encodedM);
+    quint8 E = (temp & 0x7800) >> 11;
+    return float(0.01 * (M) * qPow(2, qreal(E)));
+}
+
+static bool referenceEncode(float value, quint16 *raw)
+{
+    if (value < -671088.64f || value > 670760.96f)
+        return false;
+
+    quint8 E = 0;
+    if (qAbs(qreal(value)) > 20.48)
+        E = quint8(qFloor(qLn(qAbs(qreal(value) * 100 / 2048.)) / qLn(2) + 1));
+    qint32 M = qint32(qRound((value*float(qPow(2, -E)) * 100)));
+    if (E > 15 || M > 2047 || M < -2048)
+        return false;
+
+    quint16 encodedM = quint16(M);
+    if (value < 0)
+        encodedM &= 0x87ff;
+    encodedM |= E << 11;
+    *raw = encodedM;
+    return true;
+}
+
+static bool sameFloat(float a, float b)
+{
+    return std::memcmp(&a, &b, sizeof(float)) == 0;
+}
+
+void tst_QKnxDatapointType::dpt9_2ByteFloatCodec()
+{
+    using Codec = QKnxDatapointTypeCodec::Traits<QKnx2ByteFloat>;
+
+    QVector<quint16> raw(0x10000);
+    for (int i = 0; i < raw.size(); ++i)
+        raw[i] = quint16(i);
+
+    QVector<float> values(raw.size());
+    Codec::decode(raw.constData(), values.data(), values.size());
+
+    QVector<quint16> encoded(values.size());
+    const int count = Codec::encode(values.constData(), encoded.data(), encoded.size());
+
+    int expectedCount = 0;
+    for (int i = 0; i < values.size(); ++i) {
+        const float expected = referenceDecode(raw.at(i));
+        const quint8 bytes[] = { quint8(i >> 8), quint8(i) };
+        QVERIFY2(sameFloat(Codec::decode({ bytes, 2 }, nullptr), expected), qPrintable(QString
+            ::number(i, 16)));
+        QVERIFY2(sameFloat(values.at(i), expected), qPrintable(QString::number(i, 16)));
+
+        quint16 reference = 0;
+        const bool ok = referenceEncode(expected, &reference);
+        quint8 out[2] = {};
+        QCOMPARE(Codec::encode(expected, out), ok);
+        if (ok) {
+            QCOMPARE(quint16(out[0] << 8 | out[1]), reference);
+            QCOMPARE(encoded.at(i), reference);
+            ++expectedCount;
+        } else {
+            QCOMPARE(encoded.at(i), quint16(0x7fff));
+        }
+    }
+    QCOMPARE(count, expectedCount);
+
+    // a bulk size that is no multiple of the vector width exercises the scalar tail as well
+    QRandomGenerator generator(2019);
+    QVector<float> samples(100003);
+    for (auto &sample : samples) {
+        const double scale = generator.bounded(2) ? 1. : 1000.;
+        sample = float((generator.bounded(1400000.) - 700000.) / scale);
+    }
+    samples[0] = qQNaN();
+    samples[1] = qInf();
+    samples[2] = -0.f;
+    samples[3] = 20.48f;
+    samples[4] = -671088.64f;
+    samples[5] = 670760.96f;
+
+    encoded.resize(samples.size());
+    Codec::encode(samples.constData(), encoded.data(), encoded.size());
+    for (int i = 0; i < samples.size(); ++i) {
+        quint16 reference = 0x7fff;
+        if (i > 0) // the reference does not handle NaN
+            referenceEncode(samples.at(i), &reference);
+        QCOMPARE(encoded.at(i), reference);
+    }
+}
+
 void tst_QKnxDatapointType::dpt10_TimeOfDay()
 {
 #if defined(Q_CC_MSVC) && Q_CC_MSVC == 1914
@@ -0,0 +1,165 @@
+/******************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtKnx module.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+******************************************************************************/
+
+#include <QtCore/qdebug.h>
+#include <QtCore/qset.h>
+#include <QtKnx/qknxgroupaddressfiltertable.h>
+#include <QtTest/qtest.h>
+
+class tst_QKnxGroupAddressFilterTable : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void testDefaultConstructor();
+    void testInsertRemove();
+    void testRange();
+    void testSetRoundTrip();
+    void benchmarkContains();
+};
+
+void tst_QKnxGroupAddressFilterTable::testDefaultConstructor()
+{
+    QKnxGroupAddressFilterTable table;
+    QCOMPARE(table.isEmpty(), true);
+    QCOMPARE(table.count(), 0);
+    QCOMPARE(table.contains(QKnxAddress::createGroup(0, 0, 0)), false);
+    QCOMPARE(table.contains({}), false);
+    QCOMPARE(table.toSet(), QSet<QKnxAddress>());
+    QCOMPARE(table, QKnxGroupAddressFilterTable());
+}
+
+void tst_QKnxGroupAddressFilterTable::testInsertRemove()
+{
+    QKnxGroupAddressFilterTable table;
+
+    const auto group = QKnxAddress::createGroup(1, 1, 1);
+    table.insert(group);
+    QCOMPARE(table.isEmpty(), false);
+    QCOMPARE(table.count(), 1);
+    QCOMPARE(table.contains(group), true);
+    QCOMPARE(table.contains(QKnxAddress::createGroup(1, 1, 2)), false);
+
+    // individual and invalid addresses are never part of the table
+    const QKnxAddress individual { QKnxAddress::Type::Individual, group.toUInt16() };
+    QCOMPARE(table.contains(individual), false);
+    table.insert(individual);
+    table.insert({});
+    QCOMPARE(table.count(), 1);
+
+    // inserting or removing the same address twice does not change the count
+    table.insert(group);
+    QCOMPARE(table.count(), 1);
+    table.remove(QKnxAddress::createGroup(1, 1, 2));
+    QCOMPARE(table.count(), 1);
+
+    auto copy = table;
+    table.remove(group);
+    QCOMPARE(table.isEmpty(), true);
+    QCOMPARE(table.contains(group), false);
+    QCOMPARE(copy.contains(group), true);
+
+    // an emptied table compares equal to a default constructed one
+    QCOMPARE(table, QKnxGroupAddressFilterTable());
+    QVERIFY(copy != table);
+
+    copy.clear();
+    QCOMPARE(copy.isEmpty(), true);
+    QCOMPARE(copy, table);
+}
+
+void tst_QKnxGroupAddressFilterTable::testRange()
+{
+    QKnxGroupAddressFilterTable table;
+
+    // all group addresses of main group 3
+    table.insert(QKnxAddress::createGroup(3, 0, 0), QKnxAddress::createGroup(3, 7, 255));
+    QCOMPARE(table.count(), 2048);
+    QCOMPARE(table.contains(QKnxAddress::createGroup(3, 0, 0)), true);
+    QCOMPARE(table.contains(QKnxAddress::createGroup(3, 4, 17)), true);
+    QCOMPARE(table.contains(QKnxAddress::createGroup(3, 7, 255)), true);
+    QCOMPARE(table.contains(QKnxAddress::createGroup(2, 7, 255)), false);
+    QCOMPARE(table.contains(QKnxAddress::createGroup(4, 0, 0)), false);
+
+    // reversed bounds describe the same range
+    table.remove(QKnxAddress::createGroup(3, 1, 255), QKnxAddress::createGroup(3, 1, 0));
+    QCOMPARE(table.count(), 2048 - 256);
+    QCOMPARE(table.contains(QKnxAddress::createGroup(3, 1, 128)), false);
+    QCOMPARE(table.contains(QKnxAddress::createGroup(3, 2, 0)), true);
+
+    // overlapping ranges only count the addresses not yet in the table
+    table.insert(QKnxAddress::createGroup(3, 0, 128), QKnxAddress::createGroup(3, 1, 127));
+    QCOMPARE(table.count(), 2048 - 128);
+    table.remove(QKnxAddress::createGroup(3, 1, 0), QKnxAddress::createGroup(3, 2, 127));
+    QCOMPARE(table.count(), 2048 - 256 - 128);
+    table.remove(QKnxAddress::createGroup(3, 1, 0), QKnxAddress::createGroup(3, 1, 255));
+    QCOMPARE(table.count(), 2048 - 256 - 128);
+    QVERIFY(!table.isEmpty());
+
+    // the whole address space
+    table.insert({ QKnxAddress::Type::Group, quint16(0x0000) },
+        { QKnxAddress::Type::Group, quint16(0xffff) });
+    QCOMPARE(table.count(), 65536);
+    QCOMPARE(table.contains(QKnxAddress::Group::Broadcast), true);
+
+    // a range with an individual bound is ignored
+    table.remove(QKnxAddress::createGroup(0, 0, 0), QKnxAddress::createIndividual(1, 1, 1));
+    QCOMPARE(table.count(), 65536);
+}
+
+void tst_QKnxGroupAddressFilterTable::testSetRoundTrip()
+{
+    QSet<QKnxAddress> set;
+    set << QKnxAddress::createGroup(0, 0, 1) << QKnxAddress::createGroup(1, 1, 1)
+        << QKnxAddress::createGroup(31, 7, 255) << QKnxAddress::createIndividual(1, 1, 1);
+
+    const QKnxGroupAddressFilterTable table(set);
+    QCOMPARE(table.count(), 3);
+
+    set.remove(QKnxAddress::createIndividual(1, 1, 1));
+    QCOMPARE(table.toSet(), set);
+    QCOMPARE(QKnxGroupAddressFilterTable(table.toSet()), table);
+}
+
+void tst_QKnxGroupAddressFilterTable::benchmarkContains()
+{
+    QKnxGroupAddressFilterTable table;
+    for (int i = 0; i < 0x10000; i += 7)
+        table.insert({ QKnxAddress::Type::Group, quint16(i) });
+
+    int hits = 0;
+    QBENCHMARK {
+        for (int i = 0; i < 0x10000; ++i)
+            hits += table.contains({ QKnxAddress::Type::Group, quint16(i) });
+    }
+    QVERIFY(hits > 0);
+}
+
+QTEST_APPLESS_MAIN(tst_QKnxGroupAddressFilterTable)
+
+#include "tst_qknxgroupaddressfiltertable.moc"
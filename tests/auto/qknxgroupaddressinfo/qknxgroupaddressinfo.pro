@@ -1,6 +1,6 @@
 TARGET = tst_qknxgroupaddressinfo
 
-QT = core testlib knx network
+QT = core testlib knx knx-private network
 CONFIG += testcase c++11
 
 CONFIG -= app_bundle
@@ -27,10 +27,20 @@
 **
 ******************************************************************************/
 
+#include <QtKnx/qknxgroupaddressfiltertable.h>
 #include <QtKnx/qknxgroupaddressinfos.h>
 #include <QtKnx/qknxgroupaddressinfo.h>
+#include <QtKnx/private/qzipreader_p.h>
+#include <QtKnx/private/qzipwriter_p.h>
+#include <QtCore/qmap.h>
+#include <QtCore/qtemporarydir.h>
 #include <QtTest/qtest.h>
 
+#include <algorithm>
+
+Q_DECLARE_METATYPE(QKnxGroupAddressInfos::ParseMode)
+Q_DECLARE_METATYPE(QZipReader::ReadMode)
+
 class tst_QKnxGroupAddressInfos : public QObject
 {
     Q_OBJECT
@@ -39,6 +49,13 @@ private slots:
     void groupAddressInfo();
     void groupAddressInfosFromXml();
     void groupAddressInfosFromZip();
+    void groupAddressInfosLookup();
+    void groupAddressInfosStreaming_data();
+    void groupAddressInfosStreaming();
+    void groupAddressInfosProjects_data();
+    void groupAddressInfosProjects();
+    void zipReaderEntries_data();
+    void zipReaderEntries();
 
 private:
     QList<QKnxGroupAddressInfo> initGroupAddressInfos(const QString &install = {});
@@ -223,6 +240,13 @@ void tst_QKnxGroupAddressInfos::groupAddressInfosFromXml()
     for (const auto &entry : qAsConst(groupAddressInfos))
         QVERIFY2(entries.contains(entry), entry.name().toLatin1());
 
+    QSet<QKnxAddress> addresses;
+    for (const auto &entry : entries)
+        addresses.insert(entry.address());
+    const QKnxGroupAddressFilterTable filterTable(infos, QString("P-03D9"), installation);
+    QCOMPARE(filterTable.count(), addresses.count());
+    QCOMPARE(filterTable.toSet(), addresses);
+
     QCOMPARE(installations.indexOf(QString("Second")) >= 0, true);
     QCOMPARE(infos.infoCount(QString("P-03D8"), QString("Second")), 95);
     QCOMPARE(infos.addressInfos(QString("P-03D8"), QString("Second")).size(), 95);
@@ -319,6 +343,247 @@ void tst_QKnxGroupAddressInfos::groupAddressInfosFromZip()
     QCOMPARE(infos.infoCount(QString("P-03D9"), ""), 0);
 }
 
+void tst_QKnxGroupAddressInfos::groupAddressInfosLookup()
+{
+    QKnxGroupAddressInfos infos(QString(":/data/0.xml"));
+    QCOMPARE(infos.parse(), true);
+
+    const QString projectId("P-03D8");
+    const QString installation("First");
+    const auto entries = infos.addressInfos(projectId, installation);
+    QCOMPARE(entries.size(), 95);
+
+    for (const auto &entry : entries) {
+        QList<QKnxGroupAddressInfo> byAddress, byType;
+        for (const auto &info : entries) {
+            if (info.address() == entry.address())
+                byAddress.append(info);
+            if (info.datapointType() == entry.datapointType())
+                byType.append(info);
+        }
+        QCOMPARE(infos.addressInfos(entry.address(), projectId, installation), byAddress);
+        QCOMPARE(infos.addressInfos(entry.datapointType(), projectId, installation), byType);
+    }
+
+    const QKnxAddress address(QKnxAddress::Type::Group, 0x0900);
+    QCOMPARE(infos.addressInfos(address, projectId, QString("Fifth")).size(), 0);
+    QCOMPARE(infos.addressInfos(address, QString("P-03D5"), installation).size(), 0);
+    QCOMPARE(infos.addressInfos(QKnxAddress(QKnxAddress::Type::Individual, 0x0900), projectId,
+        installation).size(), 0);
+
+    const auto switches = infos.addressInfos(QKnxDatapointType::Type::DptSwitch, projectId,
+        installation);
+    QCOMPARE(infos.addressInfos(address, projectId, installation).size(), 1);
+
+    infos.add(QString("Second switch"), address, QKnxDatapointType::Type::DptSwitch,
+        QString(), projectId, installation);
+    QCOMPARE(infos.addressInfos(address, projectId, installation).size(), 2);
+    QCOMPARE(infos.addressInfos(address, projectId, installation).last().name(),
+        QString("Second switch"));
+    QCOMPARE(infos.addressInfos(QKnxDatapointType::Type::DptSwitch, projectId, installation)
+        .size(), switches.size() + 1);
+
+    const auto first = infos.addressInfos(address, projectId, installation).first();
+    infos.remove(first, projectId);
+    QCOMPARE(infos.addressInfos(address, projectId, installation).size(), 1);
+    QCOMPARE(infos.addressInfos(address, projectId, installation).first().name(),
+        QString("Second switch"));
+    QCOMPARE(infos.addressInfos(QKnxDatapointType::Type::DptSwitch, projectId, installation)
+        .size(), switches.size());
+    QVERIFY(!infos.addressInfos(QKnxDatapointType::Type::DptSwitch, projectId, installation)
+        .contains(first));
+
+    infos.remove(address, projectId, installation);
+    QCOMPARE(infos.addressInfos(address, projectId, installation).size(), 0);
+    QCOMPARE(infos.addressInfos(QKnxDatapointType::Type::DptSwitch, projectId, installation)
+        .size(), switches.size() - 1);
+    QCOMPARE(infos.infoCount(projectId, installation), 94);
+}
+
+void tst_QKnxGroupAddressInfos::groupAddressInfosStreaming_data()
+{
+    QTest::addColumn<QString>("projectFile");
+
+    QTest::newRow("xml") << QString(":/data/0.xml");
+    QTest::newRow("zip") << QString(":/data/qt.io.knxproj");
+}
+
+void tst_QKnxGroupAddressInfos::groupAddressInfosStreaming()
+{
+    QFETCH(QString, projectFile);
+
+    QKnxGroupAddressInfos validating(projectFile);
+    QCOMPARE(validating.parse(QKnxGroupAddressInfos::ParseMode::Validating), true);
+
+    QKnxGroupAddressInfos streaming(projectFile);
+    QCOMPARE(streaming.parse(QKnxGroupAddressInfos::ParseMode::Streaming), true);
+    QCOMPARE(streaming.status(), QKnxGroupAddressInfos::Status::NoError);
+    QCOMPARE(streaming.errorString(), QString());
+
+    auto projectIds = streaming.projectIds();
+    std::sort(projectIds.begin(), projectIds.end());
+    auto expectedIds = validating.projectIds();
+    std::sort(expectedIds.begin(), expectedIds.end());
+    QCOMPARE(projectIds, expectedIds);
+
+    for (const auto &projectId : qAsConst(projectIds)) {
+        QCOMPARE(streaming.projectName(projectId), validating.projectName(projectId));
+
+        auto installations = streaming.installations(projectId);
+        std::sort(installations.begin(), installations.end());
+        auto expectedInstallations = validating.installations(projectId);
+        std::sort(expectedInstallations.begin(), expectedInstallations.end());
+        QCOMPARE(installations, expectedInstallations);
+
+        for (const auto &installation : qAsConst(installations)) {
+            QCOMPARE(streaming.infoCount(projectId, installation),
+                validating.infoCount(projectId, installation));
+            const auto entries = streaming.addressInfos(projectId, installation);
+            for (const auto &entry : validating.addressInfos(projectId, installation))
+                QVERIFY2(entries.contains(entry), entry.name().toLatin1());
+        }
+    }
+
+    streaming.setProjectFile(QStringLiteral(":/data/nofile.xml"));
+    QCOMPARE(streaming.parse(QKnxGroupAddressInfos::ParseMode::Streaming), false);
+    QCOMPARE(streaming.status(), QKnxGroupAddressInfos::Status::FileError);
+}
+
+void tst_QKnxGroupAddressInfos::groupAddressInfosProjects_data()
+{
+    QTest::addColumn<QKnxGroupAddressInfos::ParseMode>("mode");
+
+    QTest::newRow("validating") << QKnxGroupAddressInfos::ParseMode::Validating;
+    QTest::newRow("streaming") << QKnxGroupAddressInfos::ParseMode::Streaming;
+}
+
+void tst_QKnxGroupAddressInfos::groupAddressInfosProjects()
+{
+    QFETCH(QKnxGroupAddressInfos::ParseMode, mode);
+
+    QKnxGroupAddressInfos infos(QString(":/data/0.xml"));
+    QCOMPARE(infos.parse(mode, QString("P-03D9")), true);
+    QCOMPARE(infos.projectIds(), QList<QString>({ QString("P-03D9") }));
+    QCOMPARE(infos.infoCount(QString("P-03D9"), QString("Third")), 95);
+
+    QCOMPARE(infos.parse(mode, QString("P-03D5")), false);
+    QCOMPARE(infos.status(), QKnxGroupAddressInfos::Status::ProjectError);
+    QCOMPARE(infos.projectIds(), QList<QString>());
+
+    // build an archive that contains several projects
+    QByteArray projectData, projectInfoData;
+    {
+        QZipReader reader(QString(":/data/qt.io.knxproj"));
+        projectData = reader.fileData(QString("P-03D9/0.xml"));
+        projectInfoData = reader.fileData(QString("P-03D9/project.xml"));
+    }
+    QVERIFY(!projectData.isEmpty());
+    QVERIFY(!projectInfoData.isEmpty());
+
+    const QList<QString> projectIds { "P-03D9", "P-03DA", "P-03DB", "P-03DC" };
+
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const auto archive = dir.filePath(QString("projects.knxproj"));
+    {
+        QZipWriter writer(archive);
+        for (const auto &id : projectIds) {
+            writer.addFile(id + QString("/0.xml"), QByteArray(projectData)
+                .replace("P-03D9", id.toLatin1()));
+            writer.addFile(id + QString("/project.xml"), QByteArray(projectInfoData)
+                .replace("P-03D9", id.toLatin1()));
+        }
+        writer.close();
+    }
+
+    infos.setProjectFile(archive);
+    QCOMPARE(infos.parse(mode), true);
+    auto ids = infos.projectIds();
+    std::sort(ids.begin(), ids.end());
+    QCOMPARE(ids, projectIds);
+    for (const auto &id : projectIds) {
+        QCOMPARE(infos.projectName(id), QString("qt.io.test"));
+        QCOMPARE(infos.infoCount(id, QString()), 95);
+    }
+
+    QCOMPARE(infos.parse(mode, QString("P-03DB")), true);
+    QCOMPARE(infos.projectIds(), QList<QString>({ QString("P-03DB") }));
+    QCOMPARE(infos.infoCount(QString("P-03DB"), QString()), 95);
+
+    // the same project stored twice is reported no matter which one is read first
+    const auto duplicate = dir.filePath(QString("duplicate.knxproj"));
+    {
+        QZipWriter writer(duplicate);
+        writer.addFile(QString("P-03D9/0.xml"), projectData);
+        writer.addFile(QString("P-03DA/0.xml"), projectData);
+        writer.close();
+    }
+
+    infos.setProjectFile(duplicate);
+    QCOMPARE(infos.parse(mode), false);
+    QCOMPARE(infos.status(), QKnxGroupAddressInfos::Status::ProjectError);
+    QCOMPARE(infos.errorString(), QString("Project 'P-03D9' exists more than once."));
+    QCOMPARE(infos.projectIds(), QList<QString>());
+}
+
+void tst_QKnxGroupAddressInfos::zipReaderEntries_data()
+{
+    QTest::addColumn<QZipReader::ReadMode>("readMode");
+
+    QTest::newRow("buffered") << QZipReader::Buffered;
+    QTest::newRow("memory mapped") << QZipReader::MemoryMapped;
+}
+
+void tst_QKnxGroupAddressInfos::zipReaderEntries()
+{
+    QFETCH(QZipReader::ReadMode, readMode);
+
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+
+    // many small entries, alternately stored and deflated, and one entry that
+    // is inflated in more than one chunk
+    QMap<QString, QByteArray> entries;
+    for (int i = 0; i < 2000; ++i) {
+        entries.insert(QString("Baggages/%1/entry.xml").arg(i),
+            QByteArray("<Entry Id=\"") + QByteArray::number(i) + QByteArray("\"/>"));
+    }
+    entries.insert(QString("P-03D9/0.xml"), QByteArray(100 * 1024, 'K'));
+
+    const auto archive = dir.filePath(QString("entries.knxproj"));
+    {
+        QZipWriter writer(archive);
+        bool compress = true;
+        for (auto it = entries.cbegin(); it != entries.cend(); ++it) {
+            writer.setCompressionPolicy(compress ? QZipWriter::AlwaysCompress
+                : QZipWriter::NeverCompress);
+            writer.addFile(it.key(), it.value());
+            compress = !compress;
+        }
+        writer.close();
+    }
+
+    QZipReader reader(archive);
+    QCOMPARE(reader.setReadMode(readMode), true);
+    QCOMPARE(reader.readMode(), readMode);
+    QCOMPARE(reader.count(), entries.size());
+
+    for (auto it = entries.cbegin(); it != entries.cend(); ++it) {
+        QCOMPARE(reader.fileData(it.key()), it.value());
+
+        QScopedPointer<QIODevice> device(reader.fileDevice(it.key()));
+        QVERIFY(device);
+        QCOMPARE(device->readAll(), it.value());
+    }
+
+    QCOMPARE(reader.fileData(QString("P-03DA/0.xml")), QByteArray());
+    QVERIFY(!reader.fileDevice(QString("P-03DA/0.xml")));
+
+    QCOMPARE(reader.setReadMode(QZipReader::Buffered), true);
+    QCOMPARE(reader.readMode(), QZipReader::Buffered);
+    QCOMPARE(reader.fileData(QString("P-03D9/0.xml")), entries.value(QString("P-03D9/0.xml")));
+}
+
 QTEST_MAIN(tst_QKnxGroupAddressInfos)
 
 #include "tst_qknxgroupaddressinfo.moc"
@@ -0,0 +1,243 @@
+/******************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtKnx module.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+******************************************************************************/
+
+#include <QtCore/qdebug.h>
+#include <QtCore/qrandom.h>
+#include <QtCore/qvector.h>
+#include <QtKnx/qknxnetipframe.h>
+#include <QtKnx/qknxnetipframeheader.h>
+#include <QtKnx/private/qknxnetipframereassembler_p.h>
+#include <QtTest/qtest.h>
+
+class tst_QKnxNetIpFrameReassembler : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void init();
+    void testDefaultConstructor();
+    void testSingleFrame();
+    void testSplitAtEveryOffset();
+    void testCoalescedFrames();
+    void testRandomChunks();
+    void testWrapAround();
+    void testInvalidHeader();
+    void testFrameTooLarge();
+    void testFreeSpace();
+
+private:
+    QKnxByteArray stream() const;
+
+private:
+    QVector<QKnxNetIpFrame> m_frames;
+};
+
+void tst_QKnxNetIpFrameReassembler::init()
+{
+    m_frames = {
+        { QKnxNetIp::ServiceType::RoutingIndication,
+            QKnxByteArray::fromHex("2900bce011020a0a010081") },
+        { QKnxNetIp::ServiceType::RoutingBusy, QKnxByteArray::fromHex("06000064ffff") },
+        { QKnxNetIp::ServiceType::RoutingLostMessage, QKnxByteArray::fromHex("04000005") },
+        { QKnxNetIp::ServiceType::RoutingIndication,
+            QKnxByteArray::fromHex("2900bce011020a0a020080") }
+    };
+}
+
+QKnxByteArray tst_QKnxNetIpFrameReassembler::stream() const
+{
+    QKnxByteArray bytes;
+    for (const auto &frame : qAsConst(m_frames))
+        bytes += frame.bytes();
+    return bytes;
+}
+
+void tst_QKnxNetIpFrameReassembler::testDefaultConstructor()
+{
+    QKnxNetIpFrameReassembler reassembler;
+    QCOMPARE(reassembler.capacity(), int(QKnxNetIpFrameReassembler::DefaultCapacity));
+    QCOMPARE(reassembler.size(), 0);
+    QCOMPARE(reassembler.freeSpace(), reassembler.capacity());
+    QCOMPARE(reassembler.hasError(), false);
+    QCOMPARE(reassembler.error(), QKnxNetIpFrameReassembler::Error::None);
+
+    QKnxNetIpFrame frame;
+    QCOMPARE(reassembler.takeFrame(&frame), false);
+    QCOMPARE(reassembler.takeFrame(nullptr), false);
+}
+
+void tst_QKnxNetIpFrameReassembler::testSingleFrame()
+{
+    const auto bytes = m_frames.first().bytes();
+
+    QKnxNetIpFrameReassembler reassembler;
+    QCOMPARE(reassembler.append(bytes), bytes.size());
+    QCOMPARE(reassembler.size(), bytes.size());
+
+    QKnxNetIpFrame frame;
+    QCOMPARE(reassembler.takeFrame(&frame), true);
+    QCOMPARE(frame, m_frames.first());
+    QCOMPARE(reassembler.size(), 0);
+    QCOMPARE(reassembler.takeFrame(&frame), false);
+    QCOMPARE(reassembler.hasError(), false);
+}
+
+void tst_QKnxNetIpFrameReassembler::testSplitAtEveryOffset()
+{
+    const auto bytes = stream();
+    for (int split = 0; split <= bytes.size(); ++split) {
+        QKnxNetIpFrameReassembler reassembler;
+        QVector<QKnxNetIpFrame> frames;
+        QKnxNetIpFrame frame;
+
+        reassembler.append(bytes.mid(0, split));
+        while (reassembler.takeFrame(&frame))
+            frames.append(frame);
+        reassembler.append(bytes.mid(split));
+        while (reassembler.takeFrame(&frame))
+            frames.append(frame);
+
+        QCOMPARE(frames, m_frames);
+        QCOMPARE(reassembler.size(), 0);
+        QCOMPARE(reassembler.hasError(), false);
+    }
+}
+
+void tst_QKnxNetIpFrameReassembler::testCoalescedFrames()
+{
+    const auto bytes = stream();
+
+    QKnxNetIpFrameReassembler reassembler;
+    QCOMPARE(reassembler.append(bytes), bytes.size());
+
+    QVector<QKnxNetIpFrame> frames;
+    QKnxNetIpFrame frame;
+    while (reassembler.takeFrame(&frame))
+        frames.append(frame);
+
+    QCOMPARE(frames, m_frames);
+    QCOMPARE(reassembler.size(), 0);
+}
+
+void tst_QKnxNetIpFrameReassembler::testRandomChunks()
+{
+    const auto bytes = stream();
+    QRandomGenerator generator(0x4b4e58);
+
+    for (int round = 0; round < 100; ++round) {
+        QKnxNetIpFrameReassembler reassembler(32);
+        QVector<QKnxNetIpFrame> frames;
+        QKnxNetIpFrame frame;
+
+        int offset = 0;
+        while (offset < bytes.size()) {
+            const int chunk = generator.bounded(1, 12);
+            offset += reassembler.append(bytes.mid(offset, chunk));
+            while (reassembler.takeFrame(&frame))
+                frames.append(frame);
+        }
+
+        QCOMPARE(frames, m_frames);
+        QCOMPARE(reassembler.size(), 0);
+        QCOMPARE(reassembler.hasError(), false);
+    }
+}
+
+void tst_QKnxNetIpFrameReassembler::testWrapAround()
+{
+    const auto first = m_frames.at(1).bytes(); // 12 bytes
+    const auto second = m_frames.at(0).bytes(); // 17 bytes
+
+    QKnxNetIpFrameReassembler reassembler(24);
+    QCOMPARE(reassembler.append(first), first.size());
+    QCOMPARE(reassembler.append(second.mid(0, 4)), 4);
+
+    QKnxNetIpFrame frame;
+    QCOMPARE(reassembler.takeFrame(&frame), true);
+    QCOMPARE(frame, m_frames.at(1));
+
+    // the remaining bytes of the second frame wrap around the buffer end
+    QCOMPARE(reassembler.append(second.mid(4)), second.size() - 4);
+    QCOMPARE(reassembler.takeFrame(&frame), true);
+    QCOMPARE(frame, m_frames.at(0));
+    QCOMPARE(reassembler.size(), 0);
+}
+
+void tst_QKnxNetIpFrameReassembler::testInvalidHeader()
+{
+    QKnxNetIpFrameReassembler reassembler;
+    reassembler.append(QKnxByteArray::fromHex("0520053000110000"));
+
+    QKnxNetIpFrame frame;
+    QCOMPARE(reassembler.takeFrame(&frame), false);
+    QCOMPARE(reassembler.error(), QKnxNetIpFrameReassembler::Error::InvalidHeader);
+
+    // the error state sticks until cleared
+    QCOMPARE(reassembler.takeFrame(&frame), false);
+
+    reassembler.clear();
+    QCOMPARE(reassembler.hasError(), false);
+    QCOMPARE(reassembler.size(), 0);
+
+    const auto bytes = m_frames.first().bytes();
+    reassembler.append(bytes);
+    QCOMPARE(reassembler.takeFrame(&frame), true);
+    QCOMPARE(frame, m_frames.first());
+}
+
+void tst_QKnxNetIpFrameReassembler::testFrameTooLarge()
+{
+    QKnxNetIpFrameReassembler reassembler(16);
+    reassembler.append(m_frames.first().bytes()); // 17 bytes, only 16 fit
+
+    QKnxNetIpFrame frame;
+    QCOMPARE(reassembler.takeFrame(&frame), false);
+    QCOMPARE(reassembler.error(), QKnxNetIpFrameReassembler::Error::FrameTooLarge);
+}
+
+void tst_QKnxNetIpFrameReassembler::testFreeSpace()
+{
+    const auto bytes = stream();
+
+    QKnxNetIpFrameReassembler reassembler(20);
+    QCOMPARE(reassembler.append(bytes), 20);
+    QCOMPARE(reassembler.size(), 20);
+    QCOMPARE(reassembler.freeSpace(), 0);
+    QCOMPARE(reassembler.append(bytes.mid(20)), 0);
+
+    QKnxNetIpFrame frame;
+    QCOMPARE(reassembler.takeFrame(&frame), true);
+    QCOMPARE(reassembler.freeSpace(), 17);
+
+    QKnxNetIpFrameReassembler tiny(1);
+    QCOMPARE(tiny.capacity(), int(QKnxNetIpFrameHeader::HeaderSize10));
+}
+
+QTEST_APPLESS_MAIN(tst_QKnxNetIpFrameReassembler)
+
+#include "tst_qknxnetipframereassembler.moc"
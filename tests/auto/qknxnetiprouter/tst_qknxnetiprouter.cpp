@@ -35,6 +35,7 @@
 #include <QtKnx/qknxnetiproutinglostmessage.h>
 #include <QtKnx/qknxnetiproutingsystembroadcast.h>
 
+#include <QtKnx/private/qknxnetipdatagramreader_p.h>
 #include <QtKnx/private/qknxnetiprouter_p.h>
 #include <QtKnx/private/qknxnetiptestrouter_p.h>
 #include <QtKnx/private/qknxtpdufactory_p.h>
@@ -60,10 +61,13 @@ private slots:
     void initTestCase();
     void cleanup();
     void test_udp_sockets();
+    void test_datagram_reader();
+    void test_datagram_reader_data();
     void test_network_interface();
     void test_multicast_address();
     void test_routing();
     void test_routing_sends_indications();
+    void test_routing_sends_indication_batch();
     void test_routing_receives_indications();
     void test_routing_receives_busy();
     void test_routing_busy_sent_packets_same_individual_address();
@@ -71,6 +75,7 @@ private slots:
     void test_routing_interface_receives_system_broadcast();
     void test_routing_filter();
     void test_routing_filter_data();
+    void test_group_address_filter_table();
 
 private:
     void simulateFramesReceived(const QKnxNetIpFrame &netIpFrame, int numFrames = 1);
@@ -196,6 +201,63 @@ void tst_QKnxNetIpRouter::test_multicast_address()
     }
 }
 
+void tst_QKnxNetIpRouter::test_datagram_reader()
+{
+    QFETCH(bool, batched);
+
+    QUdpSocket receiver;
+    QVERIFY(receiver.bind(QHostAddress(QHostAddress::LocalHost), 0));
+
+    QUdpSocket sender;
+    QVERIFY(sender.bind(QHostAddress(QHostAddress::LocalHost), 0));
+
+    // more datagrams than fit into a single batch, one of them bigger than an
+    // Ethernet frame
+    const int datagramCount = 3 * QKnxNetIpDatagramReader::DefaultBatchSize / 2;
+    const int oversized = 5;
+    const int oversizedSize = 4096;
+    for (int i = 0; i < datagramCount; ++i) {
+        const int size = (i == oversized ? oversizedSize : 6 + i);
+        QCOMPARE(sender.writeDatagram(QByteArray(size, char(i)), receiver.localAddress(),
+            receiver.localPort()), qint64(size));
+    }
+    QVERIFY(receiver.waitForReadyRead(1000));
+
+    QKnxNetIpDatagramReader reader;
+    reader.setBatchedReceiveEnabled(batched);
+    QCOMPARE(reader.isBatchedReceiveEnabled(),
+        batched && QKnxNetIpDatagramReader::isBatchedReceiveSupported());
+
+    int expected = 0;
+    for (int retries = 0; expected < datagramCount && retries < 100; ++retries) {
+        while (reader.readDatagrams(&receiver) > 0) {
+            QVERIFY(reader.count() <= (reader.isBatchedReceiveEnabled()
+                ? int(QKnxNetIpDatagramReader::DefaultBatchSize) : 1));
+            for (int i = 0; i < reader.count(); ++i) {
+                const auto data = reader.data(i);
+                QCOMPARE(data.size(), expected == oversized ? oversizedSize : 6 + expected);
+                QCOMPARE(int(data.at(0)), expected);
+                QCOMPARE(int(data.at(data.size() - 1)), expected);
+                QCOMPARE(reader.senderAddress(i), sender.localAddress());
+                QCOMPARE(reader.senderPort(i), sender.localPort());
+                ++expected;
+            }
+        }
+        if (expected < datagramCount)
+            receiver.waitForReadyRead(10);
+    }
+    QCOMPARE(expected, datagramCount);
+    QCOMPARE(receiver.hasPendingDatagrams(), false);
+}
+
+void tst_QKnxNetIpRouter::test_datagram_reader_data()
+{
+    QTest::addColumn<bool>("batched");
+
+    QTest::newRow("QUdpSocket") << false;
+    QTest::newRow("batched") << true;
+}
+
 void tst_QKnxNetIpRouter::test_udp_sockets()
 {
     if (!runTests)
@@ -303,6 +365,47 @@ void tst_QKnxNetIpRouter::test_routing_sends_indications()
     QVERIFY(stateChangedEmitted);
 }
 
+void tst_QKnxNetIpRouter::test_routing_sends_indication_batch()
+{
+    if (!runTests)
+        return;
+
+    m_router.start();
+
+    QList<QKnxLinkLayerFrame> frames;
+    for (int i = 0; i < 100; ++i) {
+        frames << QKnxLinkLayerFrame::builder()
+            .setData(QKnxByteArray::fromHex("2900b4e00000")
+                + QKnxUtils::QUint16::bytes(quint16(i)) + QKnxByteArray::fromHex("010000"))
+            .setMedium(QKnx::MediumType::NetIP)
+            .createFrame();
+    }
+    // not a data indication, skipped by the router
+    frames.insert(50, QKnxLinkLayerFrame::builder()
+        .setData(QKnxByteArray::fromHex("1100b4e000000002010000"))
+        .setMedium(QKnx::MediumType::NetIP)
+        .createFrame());
+    // too short to hold a cEMI data frame, skipped by the router
+    frames.insert(20, QKnxLinkLayerFrame::builder()
+        .setData(QKnxByteArray::fromHex("2900b4e0"))
+        .setMedium(QKnx::MediumType::NetIP)
+        .createFrame());
+
+    QList<QKnxLinkLayerFrame> framesSent;
+    QObject::connect(&m_router, &QKnxNetIpRouter::routingIndicationSent, [&](QKnxNetIpFrame frame) {
+        QKnxNetIpRoutingIndicationProxy indicationSent(frame);
+        QVERIFY(indicationSent.isValid());
+        framesSent << indicationSent.cemi();
+    });
+    m_router.sendRoutingIndications(frames);
+
+    frames.removeAt(51);
+    frames.removeAt(20);
+    QCOMPARE(framesSent.size(), frames.size());
+    for (int i = 0; i < frames.size(); ++i)
+        QCOMPARE(framesSent.at(i).bytes(), frames.at(i).bytes());
+}
+
 QKnxNetIpFrame dummyRoutingIndication(QKnxAddress dst, quint8 hopCount = 6)
 {
     auto tpdu = QKnxTpduFactory::Multicast::createGroupValueReadTpdu();
@@ -496,9 +599,19 @@ void tst_QKnxNetIpRouter::test_routing_filter()
             receivedIndication = true;
     });
 
+    bool receivedCemi = false;
+    QObject::connect(&m_router, &QKnxNetIpRouter::routingIndicationCemiReceived,
+        [&](QKnxLinkLayerFrame cemi, QKnxNetIpRouter::FilterAction routingAction) {
+            QCOMPARE(routingAction, expectedRoutingAction);
+            QCOMPARE(cemi.destinationAddress(), dst);
+            QCOMPARE(cemi.extendedControlField().hopCount(), quint8(hopCount));
+            receivedCemi = true;
+    });
+
     auto frame = dummyRoutingIndication(dst, hopCount);
     simulateFramesReceived(frame);
     QVERIFY(receivedIndication);
+    QVERIFY(receivedCemi);
 }
 
 void tst_QKnxNetIpRouter::test_routing_filter_data()
@@ -554,6 +667,30 @@ void tst_QKnxNetIpRouter::test_routing_filter_data()
         << filterTable;
 }
 
+void tst_QKnxNetIpRouter::test_group_address_filter_table()
+{
+    QKnxNetIpRouter router;
+
+    QKnxNetIpRouter::KnxAddressWhitelist whitelist;
+    whitelist << QKnxAddress::createIndividual(1, 1, 1) << QKnxAddress::createGroup(1, 1, 1);
+    router.setFilterTable(whitelist);
+    QCOMPARE(router.filterTable(), whitelist);
+
+    // group entries are replaced, individual entries are kept
+    QKnxGroupAddressFilterTable groupTable;
+    groupTable.insert(QKnxAddress::createGroup(2, 0, 0), QKnxAddress::createGroup(2, 0, 3));
+    router.setGroupAddressFilterTable(groupTable);
+
+    QKnxNetIpRouter::KnxAddressWhitelist expected = groupTable.toSet();
+    expected << QKnxAddress::createIndividual(1, 1, 1);
+    QCOMPARE(router.filterTable(), expected);
+    QCOMPARE(router.filterTable().size(), 5);
+
+    router.setGroupAddressFilterTable({});
+    expected = { QKnxAddress::createIndividual(1, 1, 1) };
+    QCOMPARE(router.filterTable(), expected);
+}
+
 //TODO: test threshold for sending busy after incoming queue is
 //      filled with 10 packets (queue should be able to hold until 30 messages)
 
@@ -0,0 +1,8 @@
+TARGET = tst_qknxnetipsecureconfiguration
+
+QT = core testlib knx knx-private
+CONFIG += testcase c++11
+
+CONFIG -= app_bundle
+RESOURCES += keyring.qrc
+SOURCES += tst_qknxnetipsecureconfiguration.cpp
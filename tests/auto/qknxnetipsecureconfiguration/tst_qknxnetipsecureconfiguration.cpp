@@ -0,0 +1,128 @@
+/******************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtKnx module.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+******************************************************************************/
+
+
+#include <QtCore/qdebug.h>
+#include <QtKnx/qknxcryptographicengine.h>
+#include <QtKnx/qknxnetipsecureconfiguration.h>
+#include <QtKnx/private/qknxnetipsecureconfiguration_p.h>
+#include <QtTest/qtest.h>
+
+class tst_QKnxNetIpSecureConfiguration : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void testFromKeyring();
+    void testKeyDerivation();
+};
+
+void tst_QKnxNetIpSecureConfiguration::testFromKeyring()
+{
+    if (QKnxCryptographicEngine::sslLibraryVersionNumber() < 0x1010000fL)
+        return;
+
+    const QString keyring { QStringLiteral(":/data/tunneling.knxkeys") };
+    const QByteArray password { "qt.io" };
+    const auto tunneling = QKnxNetIpSecureConfiguration::Type::Tunneling;
+    const auto management = QKnxNetIpSecureConfiguration::Type::DeviceManagement;
+
+    // the keyring has no valid signature and contains only tunneling interfaces
+    QCOMPARE(QKnxNetIpSecureConfiguration::fromKeyring(tunneling, keyring, password, true)
+        .size(), 0);
+    QCOMPARE(QKnxNetIpSecureConfiguration::fromKeyring(management, keyring, password, false)
+        .size(), 0);
+
+    const auto configurations = QKnxNetIpSecureConfiguration::fromKeyring(tunneling, keyring,
+        password, false);
+    QCOMPARE(configurations.size(), 3);
+
+    // the entries are prepared on a thread pool, but keep the keyring order
+    for (int i = 0; i < configurations.size(); ++i) {
+        const auto &configuration = configurations.at(i);
+        QCOMPARE(configuration.isValid(), true);
+        QCOMPARE(configuration.host(), QKnxAddress::createIndividual(1, 1, 1));
+        QCOMPARE(configuration.individualAddress(), QKnxAddress::createIndividual(1, 1, i + 2));
+        QCOMPARE(configuration.userId(), QKnxNetIp::SecureUserId(i + 2));
+        QCOMPARE(configuration.userPassword(), QByteArray("user-") + QByteArray::number(i + 2));
+        QCOMPARE(configuration.deviceAuthenticationCode(), QByteArray("device-auth"));
+    }
+
+    const auto configuration = QKnxNetIpSecureConfiguration::fromKeyring(tunneling,
+        QKnxAddress::createIndividual(1, 1, 3), keyring, password, false);
+    QCOMPARE(configuration.userPassword(), QByteArray("user-3"));
+}
+
+void tst_QKnxNetIpSecureConfiguration::testKeyDerivation()
+{
+    if (QKnxCryptographicEngine::sslLibraryVersionNumber() < 0x1010000fL)
+        return;
+
+    const QString keyring { QStringLiteral(":/data/tunneling.knxkeys") };
+    const QByteArray password { "qt.io" };
+
+    auto lazy = QKnxNetIpSecureConfiguration::fromKeyring(
+        QKnxNetIpSecureConfiguration::Type::Tunneling, keyring, password, false,
+        QKnxNetIpSecureConfiguration::KeyDerivation::Lazy);
+    const auto precomputed = QKnxNetIpSecureConfiguration::fromKeyring(
+        QKnxNetIpSecureConfiguration::Type::Tunneling, keyring, password, false,
+        QKnxNetIpSecureConfiguration::KeyDerivation::Precompute);
+    QCOMPARE(lazy.size(), 3);
+    QCOMPARE(precomputed.size(), lazy.size());
+
+    for (int i = 0; i < lazy.size(); ++i) {
+        auto &configuration = lazy[i];
+        const auto &expected = precomputed.at(i);
+
+        // private keys are generated for each configuration, everything else matches
+        QVERIFY(configuration.setPrivateKey(expected.privateKey()));
+        QCOMPARE(configuration, expected);
+
+        const auto expectedD = QKnxNetIpSecureConfigurationPrivate::get(expected);
+        QCOMPARE(expectedD->m_userPasswordHash,
+            QKnxCryptographicEngine::userPasswordHash(expected.userPassword()));
+        QCOMPARE(expectedD->m_deviceAuthenticationCodeHash,
+            QKnxCryptographicEngine::deviceAuthenticationCodeHash(expected
+                .deviceAuthenticationCode()));
+
+        // lazily loaded configurations derive the same hashes on demand
+        QCOMPARE(QKnxNetIpSecureConfigurationPrivate::get(configuration)->m_userPasswordHash
+            .isEmpty(), true);
+        QCOMPARE(QKnxNetIpSecureConfigurationPrivate::get(configuration)
+            ->m_deviceAuthenticationCodeHash.isEmpty(), true);
+
+        configuration.precomputePasswordHashes();
+        const auto d = QKnxNetIpSecureConfigurationPrivate::get(configuration);
+        QCOMPARE(d->m_userPasswordHash, expectedD->m_userPasswordHash);
+        QCOMPARE(d->m_deviceAuthenticationCodeHash, expectedD->m_deviceAuthenticationCodeHash);
+    }
+}
+
+QTEST_APPLESS_MAIN(tst_QKnxNetIpSecureConfiguration)
+
+#include "tst_qknxnetipsecureconfiguration.moc"
@@ -59,6 +59,32 @@ private slots:
 
         QCOMPARE(test.data().size(), quint16(0));
         QCOMPARE(test.data(), QKnxByteArray {});
+
+        quint8 buffer[8] {};
+        QCOMPARE(test.serialize(buffer, sizeof(buffer)), 0);
+
+        QKnxByteArray out;
+        test.writeTo(out);
+        QCOMPARE(out, QKnxByteArray {});
+    }
+
+    void testSerializeInvalidHeader()
+    {
+        const QKnxByteArray payload { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05 };
+        QKnxNetIpHpai test(QKnxNetIpStructHeader<QKnxNetIp::HostProtocol>(), payload);
+        QCOMPARE(test.isValid(), false);
+
+        quint8 buffer[16] {};
+        QCOMPARE(test.serialize(buffer, sizeof(buffer)), 0);
+        QCOMPARE(QKnxByteArray(buffer, sizeof(buffer)), QKnxByteArray(sizeof(buffer), 0x00));
+
+        test = QKnxNetIpHpai(QKnxNetIp::HostProtocol::Unknown, payload);
+        QCOMPARE(test.header().isValid(), false);
+        QCOMPARE(test.serialize(buffer, sizeof(buffer)), 0);
+
+        QKnxByteArray out { 0xff };
+        test.writeTo(out);
+        QCOMPARE(out, QKnxByteArray { 0xff });
     }
 
     void testConstructor_Code()
@@ -141,6 +167,16 @@ private slots:
         payload = test.data();
         QCOMPARE(payload.size(), quint16(0x06));
         QCOMPARE(payload, QKnxByteArray({ 0x00, 0x01, 0x02, 0x03, 0x04, 0x05 }));
+
+        quint8 buffer[8] {};
+        QCOMPARE(test.serialize(buffer, 7), 0);
+        QCOMPARE(test.serialize(buffer, sizeof(buffer)), 8);
+        QCOMPARE(QKnxByteArray(buffer, 8), test.bytes());
+
+        QKnxByteArray out;
+        test.writeTo(out);
+        header.writeTo(out);
+        QCOMPARE(out, test.bytes() + header.bytes());
     }
 
     void testHeaderSize()
@@ -0,0 +1,7 @@
+TARGET = tst_qknxnetiptunnel
+
+QT = core testlib knx network
+CONFIG += testcase c++11
+
+CONFIG -= app_bundle
+SOURCES += tst_qknxnetiptunnel.cpp
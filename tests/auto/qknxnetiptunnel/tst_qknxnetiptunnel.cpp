@@ -0,0 +1,338 @@
+/******************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtKnx module.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+******************************************************************************/
+
+
+#include <QtCore/qdebug.h>
+#include <QtKnx/qknxlinklayerframebuilder.h>
+#include <QtKnx/qknxnetipconnectresponse.h>
+#include <QtKnx/qknxnetipcrd.h>
+#include <QtKnx/qknxnetipdisconnectresponse.h>
+#include <QtKnx/qknxnetiphpai.h>
+#include <QtKnx/qknxnetiptunnel.h>
+#include <QtKnx/qknxnetiptunnelingacknowledge.h>
+#include <QtKnx/qknxnetiptunnelingrequest.h>
+#include <QtKnx/qknxutils.h>
+#include <QtNetwork/qnetworkdatagram.h>
+#include <QtNetwork/qudpsocket.h>
+#include <QtTest/qtest.h>
+
+Q_DECLARE_METATYPE(QKnxNetIpTunnel::QueueOverflowPolicy)
+
+static QKnxLinkLayerFrame dummyFrame(quint16 destination)
+{
+    return QKnxLinkLayerFrame::builder()
+        .setData(QKnxByteArray::fromHex("1100b4e00000") + QKnxUtils::QUint16::bytes(destination)
+            + QKnxByteArray::fromHex("010080"))
+        .setMedium(QKnx::MediumType::NetIP)
+        .createFrame();
+}
+
+static QList<QKnxByteArray> toBytes(const QList<QKnxLinkLayerFrame> &frames)
+{
+    QList<QKnxByteArray> bytes;
+    for (const auto &frame : frames)
+        bytes.append(frame.bytes());
+    return bytes;
+}
+
+class tst_QKnxNetIpTunnel : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void init();
+    void cleanup();
+    void testQueueDisabled();
+    void testQueueOverflow();
+    void testQueueOverflow_data();
+    void testShrinkAndClearQueue();
+    void testDisconnectFailsFrames();
+
+private:
+    bool connectTunnel(QKnxNetIpTunnel &tunnel);
+    void trackFrames(QKnxNetIpTunnel &tunnel);
+    QKnxNetIpFrame readFrame(QKnxNetIp::ServiceType type);
+    void writeFrame(const QKnxNetIpFrame &frame);
+    void acknowledge(const QKnxNetIpFrame &request);
+
+    // minimal KNXnet/IP server, acknowledges tunneling requests on demand
+    QUdpSocket *m_server { nullptr };
+    QHostAddress m_clientAddress;
+    quint16 m_clientPort { 0 };
+
+    QList<QKnxLinkLayerFrame> m_queued;
+    QList<QKnxLinkLayerFrame> m_sent;
+    QList<QKnxLinkLayerFrame> m_acknowledged;
+    QList<QKnxLinkLayerFrame> m_failed;
+};
+
+void tst_QKnxNetIpTunnel::init()
+{
+    m_server = new QUdpSocket(this);
+    QVERIFY(m_server->bind(QHostAddress(QHostAddress::LocalHost), 0));
+
+    m_queued.clear();
+    m_sent.clear();
+    m_acknowledged.clear();
+    m_failed.clear();
+}
+
+void tst_QKnxNetIpTunnel::cleanup()
+{
+    delete m_server;
+    m_server = nullptr;
+}
+
+void tst_QKnxNetIpTunnel::testQueueDisabled()
+{
+    QKnxNetIpTunnel tunnel;
+    trackFrames(tunnel);
+    QCOMPARE(tunnel.sendQueueDepth(), 0);
+    QCOMPARE(tunnel.sendQueueOverflowPolicy(), QKnxNetIpTunnel::QueueOverflowPolicy::RejectNew);
+    QVERIFY(connectTunnel(tunnel));
+
+    // without a queue, frames are rejected while the previous one is not acknowledged
+    QCOMPARE(tunnel.sendFrame(dummyFrame(0x0901)), true);
+    QCOMPARE(tunnel.sendFrame(dummyFrame(0x0902)), false);
+    QCOMPARE(tunnel.sendQueueSize(), 0);
+    QCOMPARE(m_queued.size(), 0);
+    QCOMPARE(m_failed.size(), 0);
+    QCOMPARE(toBytes(m_sent), toBytes({ dummyFrame(0x0901) }));
+    QCOMPARE(tunnel.sendRate(), 0.);
+    QCOMPARE(tunnel.averageAcknowledgeTime(), 0.);
+
+    const auto request = readFrame(QKnxNetIp::ServiceType::TunnelingRequest);
+    QVERIFY(request.isValid());
+    QCOMPARE(QKnxNetIpTunnelingRequestProxy(request).cemi().bytes(), dummyFrame(0x0901).bytes());
+    acknowledge(request);
+    QTRY_COMPARE(m_acknowledged.size(), 1);
+    QCOMPARE(toBytes(m_acknowledged), toBytes({ dummyFrame(0x0901) }));
+
+    QCOMPARE(tunnel.sendFrame(dummyFrame(0x0902)), true);
+    QCOMPARE(m_sent.size(), 2);
+}
+
+void tst_QKnxNetIpTunnel::testQueueOverflow()
+{
+    QFETCH(QKnxNetIpTunnel::QueueOverflowPolicy, policy);
+    QFETCH(bool, accepted);
+    QFETCH(QList<quint16>, failed);
+    QFETCH(QList<quint16>, transmitted);
+
+    QKnxNetIpTunnel tunnel;
+    trackFrames(tunnel);
+    tunnel.setSendQueueDepth(2);
+    tunnel.setSendQueueOverflowPolicy(policy);
+    QCOMPARE(tunnel.sendQueueDepth(), 2);
+    QCOMPARE(tunnel.sendQueueOverflowPolicy(), policy);
+    QVERIFY(connectTunnel(tunnel));
+
+    // the first frame is sent right away, the next two fill up the queue
+    QCOMPARE(tunnel.sendFrame(dummyFrame(0)), true);
+    QCOMPARE(tunnel.sendFrame(dummyFrame(1)), true);
+    QCOMPARE(tunnel.sendFrame(dummyFrame(2)), true);
+    QCOMPARE(tunnel.sendQueueSize(), 2);
+    QCOMPARE(toBytes(m_sent), toBytes({ dummyFrame(0) }));
+    QCOMPARE(toBytes(m_queued), toBytes({ dummyFrame(1), dummyFrame(2) }));
+
+    // the queue is full now
+    QCOMPARE(tunnel.sendFrame(dummyFrame(3)), accepted);
+    QCOMPARE(tunnel.sendQueueSize(), 2);
+    QList<QKnxLinkLayerFrame> expectedFailed;
+    for (auto destination : qAsConst(failed))
+        expectedFailed.append(dummyFrame(destination));
+    QCOMPARE(toBytes(m_failed), toBytes(expectedFailed));
+    QCOMPARE(m_queued.size(), accepted ? 3 : 2);
+
+    // every acknowledgment sends the next queued frame
+    QList<QKnxLinkLayerFrame> expected;
+    for (auto destination : qAsConst(transmitted)) {
+        expected.append(dummyFrame(destination));
+
+        const auto request = readFrame(QKnxNetIp::ServiceType::TunnelingRequest);
+        QVERIFY(request.isValid());
+        QCOMPARE(QKnxNetIpTunnelingRequestProxy(request).cemi().bytes(),
+            expected.last().bytes());
+        acknowledge(request);
+        QTRY_COMPARE(m_acknowledged.size(), expected.size());
+    }
+
+    QCOMPARE(tunnel.sendQueueSize(), 0);
+    QCOMPARE(toBytes(m_sent), toBytes(expected));
+    QCOMPARE(toBytes(m_acknowledged), toBytes(expected));
+    QCOMPARE(m_failed.size(), failed.size());
+
+    QVERIFY(tunnel.sendRate() > 0.);
+    QVERIFY(tunnel.averageAcknowledgeTime() >= 0.);
+}
+
+void tst_QKnxNetIpTunnel::testQueueOverflow_data()
+{
+    QTest::addColumn<QKnxNetIpTunnel::QueueOverflowPolicy>("policy");
+    QTest::addColumn<bool>("accepted");
+    QTest::addColumn<QList<quint16>>("failed");
+    QTest::addColumn<QList<quint16>>("transmitted");
+
+    QTest::newRow("RejectNew") << QKnxNetIpTunnel::QueueOverflowPolicy::RejectNew << false
+        << QList<quint16>() << QList<quint16> { 0, 1, 2 };
+    QTest::newRow("DropOldest") << QKnxNetIpTunnel::QueueOverflowPolicy::DropOldest << true
+        << QList<quint16> { 1 } << QList<quint16> { 0, 2, 3 };
+}
+
+void tst_QKnxNetIpTunnel::testShrinkAndClearQueue()
+{
+    QKnxNetIpTunnel tunnel;
+    trackFrames(tunnel);
+    tunnel.setSendQueueDepth(3);
+    QVERIFY(connectTunnel(tunnel));
+
+    for (quint16 destination = 0; destination < 4; ++destination)
+        QCOMPARE(tunnel.sendFrame(dummyFrame(destination)), true);
+    QCOMPARE(tunnel.sendQueueSize(), 3);
+
+    // frames exceeding the new depth are dropped from the front
+    tunnel.setSendQueueDepth(1);
+    QCOMPARE(tunnel.sendQueueSize(), 1);
+    QCOMPARE(toBytes(m_failed), toBytes({ dummyFrame(1), dummyFrame(2) }));
+
+    // the frame waiting for its acknowledgment is not affected
+    tunnel.clearSendQueue();
+    QCOMPARE(tunnel.sendQueueSize(), 0);
+    QCOMPARE(toBytes(m_failed), toBytes({ dummyFrame(1), dummyFrame(2), dummyFrame(3) }));
+
+    acknowledge(readFrame(QKnxNetIp::ServiceType::TunnelingRequest));
+    QTRY_COMPARE(m_acknowledged.size(), 1);
+    QCOMPARE(toBytes(m_acknowledged), toBytes({ dummyFrame(0) }));
+    QCOMPARE(m_sent.size(), 1);
+}
+
+void tst_QKnxNetIpTunnel::testDisconnectFailsFrames()
+{
+    QKnxNetIpTunnel tunnel;
+    trackFrames(tunnel);
+    tunnel.setSendQueueDepth(1);
+    QVERIFY(connectTunnel(tunnel));
+
+    QCOMPARE(tunnel.sendFrame(dummyFrame(0)), true);
+    QCOMPARE(tunnel.sendFrame(dummyFrame(1)), true);
+
+    tunnel.disconnectFromHost();
+    const auto request = readFrame(QKnxNetIp::ServiceType::DisconnectRequest);
+    QVERIFY(request.isValid());
+    writeFrame(QKnxNetIpDisconnectResponseProxy::builder()
+        .setChannelId(request.channelId())
+        .setStatus(QKnxNetIp::Error::None)
+        .create());
+
+    // the unacknowledged frame and the queued frame fail
+    QTRY_COMPARE(tunnel.state(), QKnxNetIpEndpointConnection::State::Disconnected);
+    QCOMPARE(toBytes(m_failed), toBytes({ dummyFrame(0), dummyFrame(1) }));
+    QCOMPARE(m_acknowledged.size(), 0);
+    QCOMPARE(tunnel.sendQueueSize(), 0);
+}
+
+bool tst_QKnxNetIpTunnel::connectTunnel(QKnxNetIpTunnel &tunnel)
+{
+    tunnel.connectToHost(m_server->localAddress(), m_server->localPort());
+
+    const auto request = readFrame(QKnxNetIp::ServiceType::ConnectRequest);
+    if (!request.isValid())
+        return false;
+
+    writeFrame(QKnxNetIpConnectResponseProxy::builder()
+        .setChannelId(1)
+        .setStatus(QKnxNetIp::Error::None)
+        .setDataEndpoint(QKnxNetIpHpaiProxy::builder()
+            .setHostAddress(m_server->localAddress())
+            .setPort(m_server->localPort())
+            .create())
+        .setResponseData(QKnxNetIpCrdProxy::builder()
+            .setIndividualAddress(QKnxAddress::createIndividual(1, 1, 10))
+            .create())
+        .create());
+
+    return QTest::qWaitFor([&]() {
+        return tunnel.state() == QKnxNetIpEndpointConnection::State::Connected;
+    });
+}
+
+void tst_QKnxNetIpTunnel::trackFrames(QKnxNetIpTunnel &tunnel)
+{
+    QObject::connect(&tunnel, &QKnxNetIpTunnel::frameQueued, [&](QKnxLinkLayerFrame frame) {
+        m_queued.append(frame);
+    });
+    QObject::connect(&tunnel, &QKnxNetIpTunnel::frameSent, [&](QKnxLinkLayerFrame frame) {
+        m_sent.append(frame);
+    });
+    QObject::connect(&tunnel, &QKnxNetIpTunnel::frameAcknowledged, [&](QKnxLinkLayerFrame frame) {
+        m_acknowledged.append(frame);
+    });
+    QObject::connect(&tunnel, &QKnxNetIpTunnel::frameFailed, [&](QKnxLinkLayerFrame frame) {
+        m_failed.append(frame);
+    });
+}
+
+QKnxNetIpFrame tst_QKnxNetIpTunnel::readFrame(QKnxNetIp::ServiceType type)
+{
+    QKnxNetIpFrame frame;
+    QTest::qWaitFor([&]() {
+        while (m_server->hasPendingDatagrams()) {
+            const auto datagram = m_server->receiveDatagram();
+            const auto data = QKnxByteArray::fromByteArray(datagram.data());
+            const auto received = QKnxNetIpFrame::fromBytes(data);
+            if (received.serviceType() != type)
+                continue; // connection state requests and the like
+
+            m_clientAddress = datagram.senderAddress();
+            m_clientPort = quint16(datagram.senderPort());
+            frame = received;
+            return true;
+        }
+        return false;
+    });
+    return frame;
+}
+
+void tst_QKnxNetIpTunnel::writeFrame(const QKnxNetIpFrame &frame)
+{
+    m_server->writeDatagram(frame.bytes().toByteArray(), m_clientAddress, m_clientPort);
+}
+
+void tst_QKnxNetIpTunnel::acknowledge(const QKnxNetIpFrame &request)
+{
+    const QKnxNetIpTunnelingRequestProxy proxy(request);
+    writeFrame(QKnxNetIpTunnelingAcknowledgeProxy::builder()
+        .setChannelId(proxy.channelId())
+        .setSequenceNumber(proxy.sequenceNumber())
+        .setStatus(QKnxNetIp::Error::None)
+        .create());
+}
+
+QTEST_MAIN(tst_QKnxNetIpTunnel)
+
+#include "tst_qknxnetiptunnel.moc"
@@ -48,6 +48,7 @@ private slots:
     void testDefaultConstructor();
     void testConstructor();
     void testValidationTunnelingRequest();
+    void testSerialize();
     void testDebugStream();
 };
 
@@ -158,6 +159,46 @@ void tst_QKnxNetIpTunnelingRequest::testValidationTunnelingRequest()
     }
 }
 
+void tst_QKnxNetIpTunnelingRequest::testSerialize()
+{
+    static const auto bytes = QKnxByteArray::fromHex("1100b4e000000002010000");
+    auto cemi = QKnxLinkLayerFrame::builder()
+                .setData(bytes)
+                .setMedium(QKnx::MediumType::NetIP)
+                .createFrame();
+    QCOMPARE(cemi.size(), quint16(bytes.size()));
+
+    quint8 buffer[64] {};
+    QCOMPARE(cemi.serialize(buffer, cemi.size() - 1), 0);
+    QCOMPARE(cemi.serialize(buffer, sizeof(buffer)), int(cemi.size()));
+    QCOMPARE(QKnxByteArray(buffer, cemi.size()), bytes);
+
+    const auto tpdu = cemi.tpdu();
+    QCOMPARE(tpdu.serialize(buffer, sizeof(buffer)), int(tpdu.size()));
+    QCOMPARE(QKnxByteArray(buffer, tpdu.size()), tpdu.bytes());
+
+    auto reqFrame = QKnxNetIpTunnelingRequestProxy::builder()
+                    .setChannelId(15)
+                    .setSequenceNumber(10)
+                    .setCemi(cemi)
+                    .create();
+    QCOMPARE(reqFrame.size(), quint16(21));
+    QCOMPARE(reqFrame.serialize(buffer, reqFrame.size() - 1), 0);
+    QCOMPARE(reqFrame.serialize(buffer, sizeof(buffer)), int(reqFrame.size()));
+    QCOMPARE(QKnxByteArray(buffer, reqFrame.size()), reqFrame.bytes());
+    QCOMPARE(QKnxByteArray(buffer, reqFrame.size()),
+        QKnxByteArray::fromHex("061004200015040f0a00") + bytes);
+
+    QKnxByteArray out { 0xff };
+    reqFrame.writeTo(out);
+    cemi.writeTo(out);
+    QCOMPARE(out, QKnxByteArray { 0xff } + reqFrame.bytes() + bytes);
+
+    QCOMPARE(QKnxNetIpFrame().serialize(buffer, sizeof(buffer)), 0);
+    QCOMPARE(QKnxLinkLayerFrame().serialize(buffer, sizeof(buffer)), 0);
+    QCOMPARE(QKnxLinkLayerFrame().size(), quint16(0));
+}
+
 void tst_QKnxNetIpTunnelingRequest::testDebugStream()
 {
     struct DebugHandler
@@ -26,7 +26,10 @@
 **
 ******************************************************************************/
 
+#include <QtCore/qendian.h>
+#include <QtCore/qtemporarydir.h>
 #include <QtCore/qxmlstream.h>
+#include <QtKnx/qknxgroupaddressinfos.h>
 #include <QtKnx/private/qknxprojectroot_p.h>
 #include <QtTest/qtest.h>
 
@@ -35,6 +38,18 @@ class tst_QKnxProject : public QObject
     Q_OBJECT
 
 private Q_SLOTS:
+    void initTestCase()
+    {
+        QVERIFY(m_dir.isValid());
+
+        QFile resource(":/data/qt.io.knxproj");
+        QCOMPARE(resource.open(QIODevice::ReadOnly), true);
+
+        QFile file(m_dir.filePath("qt.io.knxproj"));
+        QCOMPARE(file.open(QIODevice::WriteOnly), true);
+        QCOMPARE(file.write(resource.readAll()), resource.size());
+    }
+
     void testProjectInformation()
     {
         QFile file(":/data/projectinformation.xml");
@@ -943,6 +958,122 @@ private Q_SLOTS:
         QCOMPARE(channel.Name, QLatin1String("Name2"));
         QCOMPARE(channel.RefId, QLatin1String("RefId0997872"));
     }
+
+    void testGroupAddressInfosSnapshot()
+    {
+        const auto projectFile = m_dir.filePath("qt.io.knxproj");
+        const auto snapshotFile = m_dir.filePath("qt.io.snapshot");
+
+        QKnxGroupAddressInfos infos(projectFile);
+        QCOMPARE(infos.parse(), true);
+        QCOMPARE(infos.saveSnapshot(snapshotFile), true);
+
+        QKnxGroupAddressInfos snapshot(projectFile);
+        QCOMPARE(snapshot.loadSnapshot(snapshotFile), true);
+        QCOMPARE(snapshot.status(), QKnxGroupAddressInfos::Status::NoError);
+        QCOMPARE(snapshot == infos, true);
+        QCOMPARE(snapshot.projectIds().size(), 1);
+        QCOMPARE(snapshot.projectName("P-03D9"), QString("qt.io.test"));
+
+        for (const auto &projectId : infos.projectIds()) {
+            for (const auto &installation : infos.installations(projectId)) {
+                const auto addressInfos = infos.addressInfos(projectId, installation);
+                QCOMPARE(snapshot.addressInfos(projectId, installation), addressInfos);
+                for (const auto &info : addressInfos) {
+                    QCOMPARE(snapshot.addressInfos(info.address(), projectId, installation),
+                        infos.addressInfos(info.address(), projectId, installation));
+                    QCOMPARE(snapshot.addressInfos(info.datapointType(), projectId, installation),
+                        infos.addressInfos(info.datapointType(), projectId, installation));
+                }
+            }
+        }
+
+        QFile file(snapshotFile);
+        QCOMPARE(file.open(QIODevice::ReadOnly), true);
+        const auto data = file.readAll();
+
+        QFile truncated(m_dir.filePath("truncated.snapshot"));
+        QCOMPARE(truncated.open(QIODevice::WriteOnly), true);
+        truncated.write(data.left(data.size() - 1));
+        truncated.close();
+
+        QKnxGroupAddressInfos other(projectFile);
+        QCOMPARE(other.loadSnapshot(truncated.fileName()), false);
+        QCOMPARE(other.loadSnapshot(m_dir.filePath("missing.snapshot")), false);
+        QCOMPARE(other.projectIds().size(), 0);
+
+        // a snapshot does not apply to a different project file
+        QFile changed(m_dir.filePath("changed.knxproj"));
+        QCOMPARE(QFile::copy(projectFile, changed.fileName()), true);
+        QCOMPARE(changed.open(QIODevice::Append), true);
+        changed.write("\0", 1);
+        changed.close();
+
+        other.setProjectFile(changed.fileName());
+        QCOMPARE(other.loadSnapshot(snapshotFile), false);
+        QCOMPARE(other.projectIds().size(), 0);
+
+        // a snapshot needs a successful parse, and is keyed at parse time
+        QCOMPARE(QKnxGroupAddressInfos(projectFile).saveSnapshot(snapshotFile), false);
+        QKnxGroupAddressInfos missing(m_dir.filePath("missing.knxproj"));
+        QCOMPARE(missing.parse(), false);
+        QCOMPARE(missing.saveSnapshot(snapshotFile), false);
+
+        QKnxGroupAddressInfos stale(m_dir.filePath("stale.knxproj"));
+        QCOMPARE(QFile::copy(projectFile, stale.projectFile()), true);
+        QCOMPARE(stale.parse(), true);
+        QFile staleFile(stale.projectFile());
+        QCOMPARE(staleFile.open(QIODevice::Append), true);
+        staleFile.write("\0", 1);
+        staleFile.close();
+        QCOMPARE(stale.saveSnapshot(m_dir.filePath("stale.snapshot")), true);
+        QCOMPARE(stale.loadSnapshot(m_dir.filePath("stale.snapshot")), false);
+
+        // an address kind other than none, individual or group is rejected
+        const auto begin = reinterpret_cast<const uchar *>(data.constData());
+        const auto infosBegin = 72 + qFromLittleEndian<quint32>(begin + 12) * 16
+            + qFromLittleEndian<quint32>(begin + 16) * 12;
+        QCOMPARE(qFromLittleEndian<quint32>(begin + 20) > 0, true);
+
+        auto corrupted = data;
+        corrupted[int(infosBegin + 14)] = 3;
+        QFile invalidKind(m_dir.filePath("kind.snapshot"));
+        QCOMPARE(invalidKind.open(QIODevice::WriteOnly), true);
+        invalidKind.write(corrupted);
+        invalidKind.close();
+
+        QKnxGroupAddressInfos kind(projectFile);
+        QCOMPARE(kind.loadSnapshot(invalidKind.fileName()), false);
+        QCOMPARE(kind.projectIds().size(), 0);
+    }
+
+    void benchmarkGroupAddressInfosColdStart()
+    {
+        QKnxGroupAddressInfos infos(m_dir.filePath("qt.io.knxproj"));
+        QBENCHMARK {
+            infos.parse();
+        }
+        QCOMPARE(infos.status(), QKnxGroupAddressInfos::Status::NoError);
+    }
+
+    void benchmarkGroupAddressInfosWarmStart()
+    {
+        const auto projectFile = m_dir.filePath("qt.io.knxproj");
+        const auto snapshotFile = m_dir.filePath("warm.snapshot");
+
+        QKnxGroupAddressInfos infos(projectFile);
+        QCOMPARE(infos.parse(), true);
+        QCOMPARE(infos.saveSnapshot(snapshotFile), true);
+
+        QKnxGroupAddressInfos snapshot(projectFile);
+        QBENCHMARK {
+            snapshot.loadSnapshot(snapshotFile);
+        }
+        QCOMPARE(snapshot == infos, true);
+    }
+
+private:
+    QTemporaryDir m_dir;
 };
 
 QTEST_APPLESS_MAIN(tst_QKnxProject)